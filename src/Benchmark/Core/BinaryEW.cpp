@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+
+// Contiguous inputs take the vectorized fast path; strided inputs (every other
+// element of a {n, 2} tensor) take the generic Indexer path.
+static const int64_t kBinaryEWNumElements = 1LL << 24;
+
+static void BinaryEWAddContiguousCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{kBinaryEWNumElements};
+    Tensor lhs = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+static void BinaryEWAddScalarCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor lhs = Tensor::Ones({kBinaryEWNumElements}, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones({1}, Dtype::Float32, device);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+static void BinaryEWAddStridedCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{kBinaryEWNumElements, 2};
+    Tensor lhs = Tensor::Ones(shape, Dtype::Float32, device).Slice(1, 0, 1);
+    Tensor rhs = Tensor::Ones(shape, Dtype::Float32, device).Slice(1, 0, 1);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+// Broadcasting a row to every point, e.g. translating a point cloud.
+static void BinaryEWAddBroadcastCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor lhs = Tensor::Ones({kBinaryEWNumElements / 3, 3}, Dtype::Float32,
+                              device);
+    Tensor rhs = Tensor::Ones({3}, Dtype::Float32, device);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+// A transposed 3D input, which the Indexer cannot coalesce to fewer dims.
+static void BinaryEWAddTransposedCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    SizeVector shape{1 << 8, 1 << 8, 1 << 8};
+    Tensor lhs = Tensor::Ones(shape, Dtype::Float32, device).Permute({2, 0, 1});
+    Tensor rhs = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+BENCHMARK(BinaryEWAddContiguousCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(BinaryEWAddScalarCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(BinaryEWAddStridedCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(BinaryEWAddBroadcastCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(BinaryEWAddTransposedCPU)->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
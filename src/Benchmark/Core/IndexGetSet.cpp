@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/AdvancedIndexing.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Kernel/Kernel.h"
+#include "Open3D/Core/MemoryManager.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+
+static const int64_t kNumRows = 1 << 22;
+static const int64_t kNumBins = 1 << 16;
+
+static Tensor MakeRowIndex(int64_t num_indices,
+                           int64_t num_rows,
+                           const Device& device) {
+    std::vector<int64_t> index(num_indices);
+    for (int64_t i = 0; i < num_indices; ++i) {
+        index[i] = (i * 7919) % num_rows;
+    }
+    return Tensor(index, {num_indices}, Dtype::Int64, device);
+}
+
+static void IndexGetRowsCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Ones({kNumRows, 3}, Dtype::Float32, device);
+    Tensor index = MakeRowIndex(kNumRows, kNumRows, device);
+    Tensor warm_up = src.IndexGet({index});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.IndexGet({index});
+    }
+}
+
+// The generic advanced indexing path, for comparison with IndexGetRowsCPU.
+static void IndexGetGenericCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Ones({kNumRows, 3}, Dtype::Float32, device);
+    Tensor index = MakeRowIndex(kNumRows, kNumRows, device);
+    AdvancedIndexPreprocessor aip(src, {index});
+    Tensor dst(aip.GetOutputShape(), src.GetDtype(), device);
+    for (auto _ : state) {
+        kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
+                         aip.GetIndexedShape(), aip.GetIndexedStrides());
+    }
+}
+
+static void IndexAddRowsCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Ones({kNumRows, 3}, Dtype::Float32, device);
+    Tensor index = MakeRowIndex(kNumRows, kNumBins, device);
+    Tensor dst = Tensor::Zeros({kNumBins, 3}, Dtype::Float32, device);
+    dst.IndexAdd_(index, src);
+    for (auto _ : state) {
+        dst.IndexAdd_(index, src);
+    }
+}
+
+BENCHMARK(IndexGetRowsCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(IndexGetGenericCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(IndexAddRowsCPU)->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
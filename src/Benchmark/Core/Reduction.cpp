@@ -52,6 +52,71 @@ static void ReductionCPU(benchmark::State& state) {
 // https://github.com/google/benchmark/issues/498
 BENCHMARK(ReductionCPU)->Unit(benchmark::kMillisecond);
 
+// Contiguous inputs use the vectorized pairwise engine. The strided inputs
+// hold the same values but go through the generic Indexer-based engine.
+static Tensor MakeReductionInput(const SizeVector& shape, bool contiguous) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Full(shape, 0.5f, Dtype::Float32, device);
+    if (contiguous) {
+        return src;
+    }
+    SizeVector reversed_shape(shape.rbegin(), shape.rend());
+    SizeVector dims(shape.size());
+    for (size_t i = 0; i < dims.size(); ++i) {
+        dims[i] = dims.size() - 1 - i;
+    }
+    Tensor strided = Tensor::Empty(reversed_shape, Dtype::Float32, device)
+                             .Permute(dims);
+    strided.AsRvalue() = src;
+    return strided;
+}
+
+static void ReductionSumFloat32(benchmark::State& state,
+                                const SizeVector& shape,
+                                const SizeVector& dims,
+                                bool contiguous) {
+    Tensor src = MakeReductionInput(shape, contiguous);
+    Tensor warm_up = src.Sum(dims);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sum(dims);
+    }
+    state.SetBytesProcessed(state.iterations() * src.NumElements() *
+                            sizeof(float));
+}
+
+static void ReductionSumAllCPU(benchmark::State& state) {
+    ReductionSumFloat32(state, {1 << 26}, {0}, true);
+}
+
+static void ReductionSumAllStridedCPU(benchmark::State& state) {
+    ReductionSumFloat32(state, {1 << 13, 1 << 13}, {0, 1}, false);
+}
+
+// E.g. the centroid of a point cloud.
+static void ReductionSumOuterCPU(benchmark::State& state) {
+    ReductionSumFloat32(state, {1 << 24, 3}, {0}, true);
+}
+
+static void ReductionSumOuterStridedCPU(benchmark::State& state) {
+    ReductionSumFloat32(state, {1 << 24, 3}, {0}, false);
+}
+
+static void ReductionSumInnerCPU(benchmark::State& state) {
+    ReductionSumFloat32(state, {1 << 16, 1 << 10}, {1}, true);
+}
+
+static void ReductionSumInnerStridedCPU(benchmark::State& state) {
+    ReductionSumFloat32(state, {1 << 16, 1 << 10}, {1}, false);
+}
+
+BENCHMARK(ReductionSumAllCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReductionSumAllStridedCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReductionSumOuterCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReductionSumOuterStridedCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReductionSumInnerCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReductionSumInnerStridedCPU)->Unit(benchmark::kMillisecond);
+
 #ifdef BUILD_CUDA_MODULE
 
 static void ReductionCUDA(benchmark::State& state) {
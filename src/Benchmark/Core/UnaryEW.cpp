@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+
+// Contiguous inputs take the contiguous fast path; strided inputs (every other
+// element of a {n, 2} tensor) take the generic Indexer path.
+static const int64_t kUnaryEWNumElements = 1LL << 24;
+
+static void UnaryEWSqrtContiguousCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Ones({kUnaryEWNumElements}, Dtype::Float32, device);
+    Tensor warm_up = src.Sqrt();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sqrt();
+    }
+}
+
+static void UnaryEWSqrtStridedCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Ones({kUnaryEWNumElements, 2}, Dtype::Float32, device)
+                         .Slice(1, 0, 1);
+    Tensor warm_up = src.Sqrt();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sqrt();
+    }
+}
+
+static void UnaryEWConvertContiguousCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Ones({kUnaryEWNumElements}, Dtype::Int32, device);
+    Tensor warm_up = src.To(Dtype::Float32);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.To(Dtype::Float32);
+    }
+}
+
+static void UnaryEWConvertStridedCPU(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor src = Tensor::Ones({kUnaryEWNumElements, 2}, Dtype::Int32, device)
+                         .Slice(1, 0, 1);
+    Tensor warm_up = src.To(Dtype::Float32);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.To(Dtype::Float32);
+    }
+}
+
+BENCHMARK(UnaryEWSqrtContiguousCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(UnaryEWSqrtStridedCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(UnaryEWConvertContiguousCPU)->Unit(benchmark::kMillisecond);
+BENCHMARK(UnaryEWConvertStridedCPU)->Unit(benchmark::kMillisecond);
+
+}  // namespace open3d
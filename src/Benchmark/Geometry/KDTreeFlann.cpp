@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <iterator>
+
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
@@ -94,3 +97,221 @@ BENCHMARK(BM_TestKDTreeLine0)->Args({1 << 5, 1 << 10})->Args({1 << 9, 1 << 11});
 BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
+
+// Random cloud in the unit cube, queried with its own points, for comparing
+// single and batched queries on double and single precision trees.
+class TestKDTreeRandom {
+public:
+    void setup(int size) {
+        if (int(pc_.points_.size()) == size) return;
+        utility::LogInfo("setup random KDTree size={:d}", size);
+        pc_.points_.resize(size);
+        for (auto& point : pc_.points_) {
+            point = (Vector3d::Random() + Vector3d::Ones()) / 2.0;
+        }
+        kdtree_.SetGeometry(pc_);
+        kdtree_float_.SetGeometry(pc_, true);
+    }
+
+    void build(bool use_float32) {
+        geometry::KDTreeFlann kdtree(pc_, use_float32);
+        benchmark::DoNotOptimize(kdtree);
+    }
+
+    // One query per point, as done by e.g. PointCloud::EstimateNormals.
+    void search(const geometry::KDTreeSearchParam& param, bool use_float32) {
+        const geometry::KDTreeFlann& kdtree =
+                use_float32 ? kdtree_float_ : kdtree_;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(pc_.points_.size()); ++i) {
+            vector<int> indices;
+            vector<double> distance2;
+            kdtree.Search(pc_.points_[i], param, indices, distance2);
+        }
+    }
+
+    void searchBatch(const geometry::KDTreeSearchParam& param,
+                     bool use_float32) {
+        const geometry::KDTreeFlann& kdtree =
+                use_float32 ? kdtree_float_ : kdtree_;
+        kdtree.SearchBatch(queries(), param, offsets_, indices_, distance2_);
+    }
+
+    // Fraction of the neighbors found by the double precision tree that the
+    // single precision tree finds as well.
+    double float32Recall(const geometry::KDTreeSearchParam& param) {
+        vector<int64_t> offsets, offsets_float;
+        vector<int> indices, indices_float;
+        vector<double> distance2;
+        kdtree_.SearchBatch(queries(), param, offsets, indices, distance2);
+        kdtree_float_.SearchBatch(queries(), param, offsets_float,
+                                  indices_float, distance2);
+        int64_t matches = 0;
+        vector<int> row, row_float, common;
+        for (size_t i = 0; i < pc_.points_.size(); ++i) {
+            row.assign(indices.begin() + offsets[i],
+                       indices.begin() + offsets[i + 1]);
+            row_float.assign(indices_float.begin() + offsets_float[i],
+                             indices_float.begin() + offsets_float[i + 1]);
+            sort(row.begin(), row.end());
+            sort(row_float.begin(), row_float.end());
+            common.clear();
+            set_intersection(row.begin(), row.end(), row_float.begin(),
+                             row_float.end(), back_inserter(common));
+            matches += common.size();
+        }
+        return indices.empty() ? 1.0 : double(matches) / indices.size();
+    }
+
+private:
+    Map<const MatrixXd> queries() const {
+        return Map<const MatrixXd>((const double*)pc_.points_.data(), 3,
+                                   pc_.points_.size());
+    }
+
+    geometry::PointCloud pc_;
+    geometry::KDTreeFlann kdtree_;
+    geometry::KDTreeFlann kdtree_float_;
+    vector<int64_t> offsets_;
+    vector<int> indices_;
+    vector<double> distance2_;
+};
+TestKDTreeRandom testKDTreeRandom;
+
+// state.range(0) is the number of points, state.range(1) the number of
+// neighbors for KNN and hybrid search.
+static void BM_TestKDTreeRandomKNN(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    geometry::KDTreeSearchParamKNN param(state.range(1));
+    for (auto _ : state) {
+        testKDTreeRandom.search(param, false);
+    }
+}
+
+static void BM_TestKDTreeRandomKNNBatch(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    geometry::KDTreeSearchParamKNN param(state.range(1));
+    for (auto _ : state) {
+        testKDTreeRandom.searchBatch(param, false);
+    }
+}
+
+static void BM_TestKDTreeRandomHybrid(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    geometry::KDTreeSearchParamHybrid param(0.05, state.range(1));
+    for (auto _ : state) {
+        testKDTreeRandom.search(param, false);
+    }
+}
+
+static void BM_TestKDTreeRandomHybridBatch(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    geometry::KDTreeSearchParamHybrid param(0.05, state.range(1));
+    for (auto _ : state) {
+        testKDTreeRandom.searchBatch(param, false);
+    }
+}
+
+static void BM_TestKDTreeRandomRadius(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    geometry::KDTreeSearchParamRadius param(0.05);
+    for (auto _ : state) {
+        testKDTreeRandom.search(param, false);
+    }
+}
+
+static void BM_TestKDTreeRandomRadiusBatch(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    geometry::KDTreeSearchParamRadius param(0.05);
+    for (auto _ : state) {
+        testKDTreeRandom.searchBatch(param, false);
+    }
+}
+
+BENCHMARK(BM_TestKDTreeRandomKNN)
+        ->Args({1 << 17, 8})
+        ->Args({1 << 17, 32})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomKNNBatch)
+        ->Args({1 << 17, 8})
+        ->Args({1 << 17, 32})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomHybrid)
+        ->Args({1 << 17, 30})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomHybridBatch)
+        ->Args({1 << 17, 30})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomRadius)
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomRadiusBatch)
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
+
+// Single precision trees, with the recall against the double precision tree
+// reported as a counter.
+static void BM_TestKDTreeRandomBuild(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    for (auto _ : state) {
+        testKDTreeRandom.build(state.range(1) != 0);
+    }
+}
+
+static void BM_TestKDTreeRandomKNNFloat32(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    geometry::KDTreeSearchParamKNN param(state.range(1));
+    for (auto _ : state) {
+        testKDTreeRandom.search(param, true);
+    }
+    state.counters["recall"] = testKDTreeRandom.float32Recall(param);
+}
+
+static void BM_TestKDTreeRandomKNNBatchFloat32(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    geometry::KDTreeSearchParamKNN param(state.range(1));
+    for (auto _ : state) {
+        testKDTreeRandom.searchBatch(param, true);
+    }
+    state.counters["recall"] = testKDTreeRandom.float32Recall(param);
+}
+
+static void BM_TestKDTreeRandomHybridBatchFloat32(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    geometry::KDTreeSearchParamHybrid param(0.05, state.range(1));
+    for (auto _ : state) {
+        testKDTreeRandom.searchBatch(param, true);
+    }
+    state.counters["recall"] = testKDTreeRandom.float32Recall(param);
+}
+
+static void BM_TestKDTreeRandomRadiusBatchFloat32(benchmark::State& state) {
+    testKDTreeRandom.setup(state.range(0));
+    geometry::KDTreeSearchParamRadius param(0.05);
+    for (auto _ : state) {
+        testKDTreeRandom.searchBatch(param, true);
+    }
+    state.counters["recall"] = testKDTreeRandom.float32Recall(param);
+}
+
+// state.range(1) selects the single precision tree.
+BENCHMARK(BM_TestKDTreeRandomBuild)
+        ->Args({1 << 17, 0})
+        ->Args({1 << 17, 1})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomKNNFloat32)
+        ->Args({1 << 17, 8})
+        ->Args({1 << 17, 32})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomKNNBatchFloat32)
+        ->Args({1 << 17, 8})
+        ->Args({1 << 17, 32})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomHybridBatchFloat32)
+        ->Args({1 << 17, 30})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TestKDTreeRandomRadiusBatchFloat32)
+        ->Args({1 << 17})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,64 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <random>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+class VoxelDownSampleFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        if (!pcd.points_.empty()) return;
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        for (int i = 0; i < 1000000; i++) {
+            pcd.points_.push_back({dist(rng), dist(rng), dist(rng)});
+            pcd.normals_.push_back({dist(rng), dist(rng), dist(rng)});
+            pcd.colors_.push_back({dist(rng), dist(rng), dist(rng)});
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    open3d::geometry::PointCloud pcd;
+};
+
+// Voxel size in units of 1e-4 of the unit cube the points are sampled from.
+BENCHMARK_DEFINE_F(VoxelDownSampleFixture, VoxelSize)
+(benchmark::State& state) {
+    double voxel_size = double(state.range(0)) * 1e-4;
+    for (auto _ : state) {
+        pcd.VoxelDownSample(voxel_size);
+    }
+}
+
+BENCHMARK_REGISTER_F(VoxelDownSampleFixture, VoxelSize)
+        ->Args({25})
+        ->Args({100})
+        ->Args({1000})
+        ->Unit(benchmark::kMillisecond);
@@ -76,6 +76,18 @@ DLManagedTensor* ToDLPack(const Tensor& t) {
         case Dtype::UInt8:
             dl_data_type.code = DLDataTypeCode::kDLUInt;
             break;
+        case Dtype::Float16:
+            dl_data_type.code = DLDataTypeCode::kDLFloat;
+            break;
+        case Dtype::Int8:
+            dl_data_type.code = DLDataTypeCode::kDLInt;
+            break;
+        case Dtype::Int16:
+            dl_data_type.code = DLDataTypeCode::kDLInt;
+            break;
+        case Dtype::UInt16:
+            dl_data_type.code = DLDataTypeCode::kDLUInt;
+            break;
         default:
             utility::LogError("Unsupported data type");
     }
@@ -132,6 +144,9 @@ Tensor FromDLPack(const DLManagedTensor* src) {
                 case 8:
                     dtype = Dtype::UInt8;
                     break;
+                case 16:
+                    dtype = Dtype::UInt16;
+                    break;
                 default:
                     utility::LogError("Unsupported kDLUInt bits {}",
                                       src->dl_tensor.dtype.bits);
@@ -139,6 +154,12 @@ Tensor FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLInt:
             switch (src->dl_tensor.dtype.bits) {
+                case 8:
+                    dtype = Dtype::Int8;
+                    break;
+                case 16:
+                    dtype = Dtype::Int16;
+                    break;
                 case 32:
                     dtype = Dtype::Int32;
                     break;
@@ -152,6 +173,9 @@ Tensor FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (src->dl_tensor.dtype.bits) {
+                case 16:
+                    dtype = Dtype::Float16;
+                    break;
                 case 32:
                     dtype = Dtype::Float32;
                     break;
@@ -44,6 +44,10 @@
 ///        func<scalar_t>(args);
 ///     });
 ///
+/// Float16 dispatches to open3d::Half, which converts implicitly to and from
+/// float. Kernels written for the other dtypes therefore also compute Float16
+/// in float precision and round once when the result is stored.
+///
 /// Inspired by:
 ///     https://github.com/pytorch/pytorch/blob/master/aten/src/ATen/Dispatch.h
 #define DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, ...)               \
@@ -69,6 +73,22 @@
                 using scalar_t = uint8_t;                    \
                 return __VA_ARGS__();                        \
             }                                                \
+            case open3d::Dtype::Float16: {                   \
+                using scalar_t = open3d::Half;               \
+                return __VA_ARGS__();                        \
+            }                                                \
+            case open3d::Dtype::Int8: {                      \
+                using scalar_t = int8_t;                     \
+                return __VA_ARGS__();                        \
+            }                                                \
+            case open3d::Dtype::Int16: {                     \
+                using scalar_t = int16_t;                    \
+                return __VA_ARGS__();                        \
+            }                                                \
+            case open3d::Dtype::UInt16: {                    \
+                using scalar_t = uint16_t;                   \
+                return __VA_ARGS__();                        \
+            }                                                \
             default:                                         \
                 utility::LogError("Unsupported data type."); \
         }                                                    \
@@ -83,3 +103,22 @@
             DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__); \
         }                                                   \
     }()
+
+/// Float-only variant of DISPATCH_DTYPE_TO_TEMPLATE, for ops that are only
+/// defined for floating point types (e.g. linear algebra).
+#define DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(DTYPE, ...)                         \
+    [&] {                                                                    \
+        switch (DTYPE) {                                                     \
+            case open3d::Dtype::Float32: {                                   \
+                using scalar_t = float;                                      \
+                return __VA_ARGS__();                                        \
+            }                                                                \
+            case open3d::Dtype::Float64: {                                   \
+                using scalar_t = double;                                     \
+                return __VA_ARGS__();                                        \
+            }                                                                \
+            default:                                                         \
+                utility::LogError("Unsupported data type, only Float32 and " \
+                                  "Float64 are supported.");                 \
+        }                                                                    \
+    }()
@@ -29,6 +29,7 @@
 #include "string"
 
 #include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Half.h"
 #include "Open3D/Utility/Console.h"
 
 static_assert(sizeof(float) == 4,
@@ -43,6 +44,12 @@ static_assert(sizeof(int64_t) == 8,
 static_assert(sizeof(uint8_t) == 1,
               "Unsupported platform: uint8_t must be 1 byte");
 static_assert(sizeof(bool) == 1, "Unsupported platform: bool must be 1 byte");
+static_assert(sizeof(int8_t) == 1,
+              "Unsupported platform: int8_t must be 1 byte");
+static_assert(sizeof(int16_t) == 2,
+              "Unsupported platform: int16_t must be 2 bytes");
+static_assert(sizeof(uint16_t) == 2,
+              "Unsupported platform: uint16_t must be 2 bytes");
 
 namespace open3d {
 
@@ -54,6 +61,10 @@ enum class Dtype {
     Int64,
     UInt8,
     Bool,
+    Float16,
+    Int8,
+    Int16,
+    UInt16,
 };
 
 class DtypeUtil {
@@ -79,6 +90,18 @@ public:
             case Dtype::Bool:
                 byte_size = 1;
                 break;
+            case Dtype::Float16:
+                byte_size = 2;
+                break;
+            case Dtype::Int8:
+                byte_size = 1;
+                break;
+            case Dtype::Int16:
+                byte_size = 2;
+                break;
+            case Dtype::UInt16:
+                byte_size = 2;
+                break;
             default:
                 utility::LogError("Unsupported data type");
         }
@@ -118,6 +141,18 @@ public:
             case Dtype::Bool:
                 str = "Bool";
                 break;
+            case Dtype::Float16:
+                str = "Float16";
+                break;
+            case Dtype::Int8:
+                str = "Int8";
+                break;
+            case Dtype::Int16:
+                str = "Int16";
+                break;
+            case Dtype::UInt16:
+                str = "UInt16";
+                break;
             default:
                 utility::LogError("Unsupported data type");
         }
@@ -155,4 +190,24 @@ inline Dtype DtypeUtil::FromType<bool>() {
     return Dtype::Bool;
 }
 
+template <>
+inline Dtype DtypeUtil::FromType<Half>() {
+    return Dtype::Float16;
+}
+
+template <>
+inline Dtype DtypeUtil::FromType<int8_t>() {
+    return Dtype::Int8;
+}
+
+template <>
+inline Dtype DtypeUtil::FromType<int16_t>() {
+    return Dtype::Int16;
+}
+
+template <>
+inline Dtype DtypeUtil::FromType<uint16_t>() {
+    return Dtype::UInt16;
+}
+
 }  // namespace open3d
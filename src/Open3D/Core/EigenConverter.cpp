@@ -0,0 +1,55 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Core/EigenConverter.h"
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace eigen_converter {
+
+void AssertEigenMappable(const Tensor& tensor, Dtype dtype) {
+    if (tensor.GetDtype() != dtype) {
+        utility::LogError("Cannot map {} tensor as Eigen matrix of {}.",
+                          DtypeUtil::ToString(tensor.GetDtype()),
+                          DtypeUtil::ToString(dtype));
+    }
+    if (tensor.NumDims() != 2) {
+        utility::LogError("Only 2D tensors can be mapped, but got {}D.",
+                          tensor.NumDims());
+    }
+    if (tensor.GetDevice().GetType() != Device::DeviceType::CPU) {
+        utility::LogError("Only CPU tensors can be mapped, but got {}.",
+                          tensor.GetDevice().ToString());
+    }
+    if (!tensor.IsContiguous()) {
+        utility::LogError("Only contiguous tensors can be mapped.");
+    }
+}
+
+}  // namespace eigen_converter
+}  // namespace open3d
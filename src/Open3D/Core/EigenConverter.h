@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Open3D/Core/Blob.h"
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace eigen_converter {
+
+/// Row-major Eigen::Map types returned by AsEigenMap.
+template <typename T>
+using EigenMatrixMap = Eigen::Map<
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+template <typename T>
+using ConstEigenMatrixMap = Eigen::Map<const Eigen::
+                Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+
+/// Throws unless \p tensor is a contiguous 2D CPU tensor of \p dtype.
+void AssertEigenMappable(const Tensor& tensor, Dtype dtype);
+
+namespace detail {
+
+/// Shared implementation of FromEigenVectorArray. \p owner keeps the vector
+/// alive, or is nullptr if the caller manages its lifetime.
+template <typename T, int Dim, typename Alloc>
+Tensor FromEigenVectorArray(
+        std::vector<Eigen::Matrix<T, Dim, 1>, Alloc>& vectors,
+        const std::shared_ptr<void>& owner) {
+    static_assert(Dim > 0, "Only fixed-size Eigen vectors are supported.");
+    static_assert(sizeof(Eigen::Matrix<T, Dim, 1>) == Dim * sizeof(T),
+                  "Eigen vectors must be tightly packed.");
+    Device device("CPU:0");
+    void* data_ptr = static_cast<void*>(vectors.data());
+    // The no-op deleter keeps Blob from freeing memory it does not own.
+    auto blob = std::make_shared<Blob>(device, data_ptr,
+                                       [owner](void*) { (void)owner; });
+    SizeVector shape{static_cast<int64_t>(vectors.size()), Dim};
+    return Tensor(shape, Tensor::DefaultStrides(shape), data_ptr,
+                  DtypeUtil::FromType<T>(), blob);
+}
+
+}  // namespace detail
+
+/// Aliases an array of fixed-size Eigen vectors, e.g. `PointCloud::points_`,
+/// as an (N, dim) CPU tensor without copying. The tensor does not own the
+/// memory: \p vectors must outlive the tensor and all of its views, and must
+/// not be resized while they are in use. Writes through the tensor are
+/// visible in \p vectors and vice versa.
+template <typename T, int Dim, typename Alloc>
+Tensor FromEigenVectorArray(
+        std::vector<Eigen::Matrix<T, Dim, 1>, Alloc>& vectors) {
+    return detail::FromEigenVectorArray(vectors, nullptr);
+}
+
+/// Moves an array of fixed-size Eigen vectors into an (N, dim) CPU tensor
+/// without copying. The vector's buffer is owned by the tensor's Blob and
+/// released with the last tensor referring to it.
+template <typename T, int Dim, typename Alloc>
+Tensor FromEigenVectorArray(
+        std::vector<Eigen::Matrix<T, Dim, 1>, Alloc>&& vectors) {
+    auto owner = std::make_shared<std::vector<Eigen::Matrix<T, Dim, 1>, Alloc>>(
+            std::move(vectors));
+    return detail::FromEigenVectorArray(*owner, owner);
+}
+
+/// Views a contiguous 2D CPU tensor as a row-major Eigen matrix without
+/// copying, so that Eigen expressions can read and write the tensor in place.
+/// For an (N, 3) tensor, `AsEigenMap<double>(tensor).row(i)` is point i. The
+/// map is invalidated when the tensor's memory is released.
+template <typename T>
+EigenMatrixMap<T> AsEigenMap(Tensor& tensor) {
+    AssertEigenMappable(tensor, DtypeUtil::FromType<T>());
+    return EigenMatrixMap<T>(static_cast<T*>(tensor.GetDataPtr()),
+                             tensor.GetShape(0), tensor.GetShape(1));
+}
+
+template <typename T>
+ConstEigenMatrixMap<T> AsEigenMap(const Tensor& tensor) {
+    AssertEigenMappable(tensor, DtypeUtil::FromType<T>());
+    return ConstEigenMatrixMap<T>(static_cast<const T*>(tensor.GetDataPtr()),
+                                  tensor.GetShape(0), tensor.GetShape(1));
+}
+
+}  // namespace eigen_converter
+}  // namespace open3d
@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+/// IEEE 754 half precision floating point value, the element type of
+/// Dtype::Float16 tensors.
+///
+/// Only the storage is 16 bits wide. Half converts implicitly to and from
+/// float, so arithmetic on Half promotes to float and rounds the result back
+/// to the nearest Half when it is stored, e.g. `Half c = a + b`.
+class Half {
+public:
+    Half() = default;
+    OPEN3D_HOST_DEVICE Half(float value) : bits_(FloatToBits(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const { return BitsToFloat(bits_); }
+
+    OPEN3D_HOST_DEVICE Half& operator+=(float value) {
+        return *this = Half(float(*this) + value);
+    }
+    OPEN3D_HOST_DEVICE Half& operator-=(float value) {
+        return *this = Half(float(*this) - value);
+    }
+    OPEN3D_HOST_DEVICE Half& operator*=(float value) {
+        return *this = Half(float(*this) * value);
+    }
+    OPEN3D_HOST_DEVICE Half& operator/=(float value) {
+        return *this = Half(float(*this) / value);
+    }
+
+    /// Returns the Half with the given IEEE 754 binary16 bits.
+    OPEN3D_HOST_DEVICE static Half FromBits(uint16_t bits) {
+        Half h;
+        h.bits_ = bits;
+        return h;
+    }
+    OPEN3D_HOST_DEVICE uint16_t GetBits() const { return bits_; }
+
+private:
+    /// Rounds to the nearest binary16 value, ties to even. Values beyond the
+    /// binary16 range become infinity and NaNs stay NaN.
+    OPEN3D_HOST_DEVICE static uint16_t FloatToBits(float value) {
+        uint32_t x;
+        std::memcpy(&x, &value, sizeof(x));
+        uint32_t sign = x & 0x80000000u;
+        x ^= sign;
+        uint16_t bits;
+        if (x >= 0x47800000u) {
+            // Overflow, infinity or NaN.
+            bits = x > 0x7F800000u ? 0x7E00 : 0x7C00;
+        } else if (x < 0x38800000u) {
+            // Subnormal or zero in binary16. Adding 0.5f aligns the 10
+            // mantissa bits at the bottom of the float, and the addition
+            // itself rounds to nearest even.
+            float f;
+            std::memcpy(&f, &x, sizeof(f));
+            f += 0.5f;
+            std::memcpy(&x, &f, sizeof(x));
+            bits = static_cast<uint16_t>(x - 0x3F000000u);
+        } else {
+            // Rebias the exponent and round the 13 dropped mantissa bits.
+            uint32_t mantissa_odd = (x >> 13) & 1;
+            x += 0xC8000FFFu + mantissa_odd;
+            bits = static_cast<uint16_t>(x >> 13);
+        }
+        return static_cast<uint16_t>(bits | (sign >> 16));
+    }
+
+    OPEN3D_HOST_DEVICE static float BitsToFloat(uint16_t bits) {
+        uint32_t sign = static_cast<uint32_t>(bits & 0x8000) << 16;
+        uint32_t exponent = (bits >> 10) & 0x1F;
+        uint32_t mantissa = bits & 0x3FF;
+        float f;
+        if (exponent == 0) {
+            // Zero or subnormal, mantissa * 2^-24 is exact in float.
+            f = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+            return sign ? -f : f;
+        }
+        uint32_t x;
+        if (exponent == 0x1F) {
+            x = sign | 0x7F800000u | (mantissa << 13);
+        } else {
+            x = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        }
+        std::memcpy(&f, &x, sizeof(f));
+        return f;
+    }
+
+    uint16_t bits_;
+};
+
+static_assert(sizeof(Half) == 2, "Half must be 2 bytes");
+
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::Half> {
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr int max_exponent = 16;
+    static constexpr int min_exponent = -13;
+
+    static open3d::Half min() { return open3d::Half::FromBits(0x0400); }
+    static open3d::Half lowest() { return open3d::Half::FromBits(0xFBFF); }
+    static open3d::Half max() { return open3d::Half::FromBits(0x7BFF); }
+    static open3d::Half epsilon() { return open3d::Half::FromBits(0x1400); }
+    static open3d::Half infinity() { return open3d::Half::FromBits(0x7C00); }
+    static open3d::Half quiet_NaN() { return open3d::Half::FromBits(0x7E00); }
+    static open3d::Half denorm_min() { return open3d::Half::FromBits(0x0001); }
+};
+
+}  // namespace std
+
+namespace fmt {
+
+/// Formats Half as the float it represents.
+template <>
+struct formatter<open3d::Half> : formatter<float> {
+    template <typename FormatContext>
+    auto format(const open3d::Half& h, FormatContext& ctx)
+            -> decltype(ctx.out()) {
+        return formatter<float>::format(static_cast<float>(h), ctx);
+    }
+};
+
+}  // namespace fmt
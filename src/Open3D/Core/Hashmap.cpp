@@ -0,0 +1,203 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Hashmap.h"
+
+#include <algorithm>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+static SizeVector BatchShape(int64_t n, const SizeVector& element_shape) {
+    SizeVector shape{n};
+    shape.insert(shape.end(), element_shape.begin(), element_shape.end());
+    return shape;
+}
+
+Hashmap::Hashmap(int64_t init_capacity,
+                 Dtype key_dtype,
+                 const SizeVector& key_element_shape,
+                 Dtype value_dtype,
+                 const SizeVector& value_element_shape,
+                 const Device& device)
+    : key_dtype_(key_dtype),
+      key_element_shape_(key_element_shape),
+      value_dtype_(value_dtype),
+      value_element_shape_(value_element_shape),
+      device_(device) {
+    if (device_.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("Hashmap: Unimplemented device {}.",
+                          device_.ToString());
+    }
+    if (init_capacity < 0) {
+        utility::LogError("Hashmap: capacity must be non-negative, but got {}.",
+                          init_capacity);
+    }
+    capacity_ = init_capacity;
+    key_buffer_ = Tensor::Empty(BatchShape(capacity_, key_element_shape_),
+                                key_dtype_, device_);
+    value_buffer_ = Tensor::Empty(BatchShape(capacity_, value_element_shape_),
+                                  value_dtype_, device_);
+    ResetSlots(capacity_);
+}
+
+void Hashmap::Rehash(int64_t capacity) {
+    if (capacity < size_) {
+        utility::LogError(
+                "Hashmap::Rehash: capacity {} is smaller than the number of "
+                "entries {}.",
+                capacity, size_);
+    }
+    if (device_.GetType() == Device::DeviceType::CPU) {
+        RehashCPU(capacity, true);
+    } else {
+        utility::LogError("Hashmap::Rehash: Unimplemented device");
+    }
+}
+
+void Hashmap::Reserve(int64_t num_new_entries) {
+    int64_t capacity = capacity_;
+    if (size_ + num_new_entries > capacity_) {
+        capacity = std::max(2 * capacity_, size_ + num_new_entries);
+    } else if ((size_ + num_new_entries + num_erased_slots_) * 2 <=
+               num_slots_) {
+        return;
+    }
+    // Either the arena is full or too many erased slots lengthen the probe
+    // sequences. Unlike Rehash, entries keep their addresses.
+    if (device_.GetType() == Device::DeviceType::CPU) {
+        RehashCPU(capacity, false);
+    } else {
+        utility::LogError("Hashmap::Reserve: Unimplemented device");
+    }
+}
+
+Tensor Hashmap::PrepareKeys(const Tensor& keys) const {
+    if (keys.GetDevice() != device_) {
+        utility::LogError("Hashmap: keys are on device {}, but expected {}.",
+                          keys.GetDevice().ToString(), device_.ToString());
+    }
+    if (keys.GetDtype() != key_dtype_) {
+        utility::LogError("Hashmap: keys have dtype {}, but expected {}.",
+                          DtypeUtil::ToString(keys.GetDtype()),
+                          DtypeUtil::ToString(key_dtype_));
+    }
+    if (keys.NumDims() == 0 ||
+        keys.GetShape() != BatchShape(keys.GetShape()[0], key_element_shape_)) {
+        utility::LogError(
+                "Hashmap: keys have shape {}, but expected (N, *{}).",
+                keys.GetShape(), key_element_shape_);
+    }
+    return keys.Contiguous();
+}
+
+std::pair<Tensor, Tensor> Hashmap::Insert(const Tensor& keys,
+                                          const Tensor& values) {
+    Tensor keys_contiguous = PrepareKeys(keys);
+    int64_t n = keys.GetShape()[0];
+    if (values.GetDevice() != device_) {
+        utility::LogError(
+                "Hashmap::Insert: values are on device {}, but expected {}.",
+                values.GetDevice().ToString(), device_.ToString());
+    }
+    if (values.GetDtype() != value_dtype_) {
+        utility::LogError(
+                "Hashmap::Insert: values have dtype {}, but expected {}.",
+                DtypeUtil::ToString(values.GetDtype()),
+                DtypeUtil::ToString(value_dtype_));
+    }
+    if (values.GetShape() != BatchShape(n, value_element_shape_)) {
+        utility::LogError(
+                "Hashmap::Insert: values have shape {}, but expected {}.",
+                values.GetShape(), BatchShape(n, value_element_shape_));
+    }
+    Tensor values_contiguous = values.Contiguous();
+
+    Reserve(n);
+    Tensor addrs = Tensor::Empty({n}, Dtype::Int64, device_);
+    Tensor masks = Tensor::Empty({n}, Dtype::Bool, device_);
+    if (device_.GetType() == Device::DeviceType::CPU) {
+        InsertCPU(keys_contiguous, &values_contiguous, addrs, masks);
+    } else {
+        utility::LogError("Hashmap::Insert: Unimplemented device");
+    }
+    return std::make_pair(addrs, masks);
+}
+
+std::pair<Tensor, Tensor> Hashmap::Activate(const Tensor& keys) {
+    Tensor keys_contiguous = PrepareKeys(keys);
+    int64_t n = keys.GetShape()[0];
+
+    Reserve(n);
+    Tensor addrs = Tensor::Empty({n}, Dtype::Int64, device_);
+    Tensor masks = Tensor::Empty({n}, Dtype::Bool, device_);
+    if (device_.GetType() == Device::DeviceType::CPU) {
+        InsertCPU(keys_contiguous, nullptr, addrs, masks);
+    } else {
+        utility::LogError("Hashmap::Activate: Unimplemented device");
+    }
+    return std::make_pair(addrs, masks);
+}
+
+std::pair<Tensor, Tensor> Hashmap::Find(const Tensor& keys) const {
+    Tensor keys_contiguous = PrepareKeys(keys);
+    int64_t n = keys.GetShape()[0];
+
+    Tensor addrs = Tensor::Empty({n}, Dtype::Int64, device_);
+    Tensor masks = Tensor::Empty({n}, Dtype::Bool, device_);
+    if (device_.GetType() == Device::DeviceType::CPU) {
+        FindCPU(keys_contiguous, addrs, masks);
+    } else {
+        utility::LogError("Hashmap::Find: Unimplemented device");
+    }
+    return std::make_pair(addrs, masks);
+}
+
+Tensor Hashmap::Erase(const Tensor& keys) {
+    Tensor keys_contiguous = PrepareKeys(keys);
+    int64_t n = keys.GetShape()[0];
+
+    Tensor masks = Tensor::Empty({n}, Dtype::Bool, device_);
+    if (device_.GetType() == Device::DeviceType::CPU) {
+        EraseCPU(keys_contiguous, masks);
+    } else {
+        utility::LogError("Hashmap::Erase: Unimplemented device");
+    }
+    return masks;
+}
+
+Tensor Hashmap::GetActiveIndices() const {
+    if (device_.GetType() == Device::DeviceType::CPU) {
+        std::vector<int64_t> indices = GetActiveIndicesCPU();
+        return Tensor(indices, {static_cast<int64_t>(indices.size())},
+                      Dtype::Int64, device_);
+    } else {
+        utility::LogError("Hashmap::GetActiveIndices: Unimplemented device");
+    }
+}
+
+}  // namespace open3d
@@ -0,0 +1,187 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+
+/// A hash map with fixed-shape Tensor keys and values, e.g. Int32 (3,) voxel
+/// coordinates mapped to Float32 (3,) accumulated colors.
+///
+/// Keys and values are stored in flat buffers of shape
+/// (capacity, *element_shape), which we call the arena. An entry is referred
+/// to by its address, i.e. its row index in the arena. Lookups go through an
+/// open-addressing table with linear probing that stores the addresses, so
+/// that batched operations can run in parallel without locks.
+///
+/// Keys are compared bitwise, e.g. for Float32 keys, 0.0 and -0.0 are
+/// different keys.
+///
+/// Typical use cases:
+/// - Voxel hashing: Int32 (3,) keys
+/// - Sparse voxel blocks: Int32 (3,) keys, Float32 (8, 8, 8) values
+class Hashmap {
+public:
+    /// Constructor for creating an empty hash map.
+    ///
+    /// \param init_capacity Number of entries to reserve. The map grows
+    /// automatically when an Insert exceeds the capacity.
+    /// \param key_dtype Dtype of the keys, e.g. Dtype::Int32.
+    /// \param key_element_shape Shape of a single key, e.g. (3) for voxel
+    /// coordinates.
+    /// \param value_dtype Dtype of the values.
+    /// \param value_element_shape Shape of a single value.
+    /// \param device Device to store the keys and values. e.g. "CPU:0".
+    Hashmap(int64_t init_capacity,
+            Dtype key_dtype,
+            const SizeVector& key_element_shape,
+            Dtype value_dtype,
+            const SizeVector& value_element_shape,
+            const Device& device = Device("CPU:0"));
+
+    /// Resizes the arena to \p capacity entries and rebuilds the table.
+    /// Active entries are compacted to the front of the arena, keeping their
+    /// relative order. Addresses therefore stay valid unless entries have
+    /// been erased since the last Rehash.
+    void Rehash(int64_t capacity);
+
+    /// Inserts a batch of keys of shape (N, *key_element_shape) with values of
+    /// shape (N, *value_element_shape). Existing keys keep their values. If
+    /// \p keys contains duplicates, exactly one of them is inserted. The
+    /// arena grows as needed, keeping the addresses of existing entries.
+    ///
+    /// \return A pair of Int64 (N,) addresses of the entries of the keys, and
+    /// Bool (N,) masks which are true where a new entry was inserted.
+    std::pair<Tensor, Tensor> Insert(const Tensor& keys, const Tensor& values);
+
+    /// Same as Insert, but without values. The values of newly inserted
+    /// entries are zero-initialized and can be written through
+    /// GetValueTensor() with the returned addresses.
+    std::pair<Tensor, Tensor> Activate(const Tensor& keys);
+
+    /// Looks up a batch of keys of shape (N, *key_element_shape).
+    ///
+    /// \return A pair of Int64 (N,) addresses, and Bool (N,) masks which are
+    /// true where the key is found. Addresses of missing keys are undefined.
+    std::pair<Tensor, Tensor> Find(const Tensor& keys) const;
+
+    /// Erases a batch of keys of shape (N, *key_element_shape). The arena
+    /// rows of erased entries are reused by later insertions.
+    ///
+    /// \return Bool (N,) masks which are true where an entry was erased.
+    Tensor Erase(const Tensor& keys);
+
+    /// Returns the Int64 addresses of all entries in ascending order.
+    Tensor GetActiveIndices() const;
+
+    /// Returns the key arena of shape (capacity, *key_element_shape) with
+    /// shared memory. Only rows at active addresses are meaningful.
+    Tensor GetKeyTensor() const { return key_buffer_; }
+
+    /// Returns the value arena of shape (capacity, *value_element_shape) with
+    /// shared memory. Only rows at active addresses are meaningful.
+    Tensor GetValueTensor() const { return value_buffer_; }
+
+    /// Number of entries in the map.
+    int64_t Size() const { return size_; }
+
+    /// Number of entries the arena can hold before the next Rehash.
+    int64_t GetCapacity() const { return capacity_; }
+
+    Dtype GetKeyDtype() const { return key_dtype_; }
+
+    Dtype GetValueDtype() const { return value_dtype_; }
+
+    SizeVector GetKeyElementShape() const { return key_element_shape_; }
+
+    SizeVector GetValueElementShape() const { return value_element_shape_; }
+
+    Device GetDevice() const { return device_; }
+
+protected:
+    /// Checks that \p keys is a (N, *key_element_shape) tensor on the map's
+    /// device and returns it contiguous.
+    Tensor PrepareKeys(const Tensor& keys) const;
+
+    /// Grows or cleans up the arena and table, such that \p num_new_entries
+    /// entries can be inserted without exceeding the capacity or the maximum
+    /// load factor of the table. Entries keep their addresses.
+    void Reserve(int64_t num_new_entries);
+
+    /// Allocates a table of at least 2 * capacity slots, all empty.
+    void ResetSlots(int64_t capacity);
+
+    /// CPU implementations. \p values may be nullptr for Activate.
+    /// Without \p compact, entries keep their addresses, and capacity must
+    /// not be smaller than arena_top_.
+    void RehashCPU(int64_t capacity, bool compact);
+    void InsertCPU(const Tensor& keys,
+                   const Tensor* values,
+                   Tensor& addrs,
+                   Tensor& masks);
+    void FindCPU(const Tensor& keys, Tensor& addrs, Tensor& masks) const;
+    void EraseCPU(const Tensor& keys, Tensor& masks);
+    std::vector<int64_t> GetActiveIndicesCPU() const;
+
+protected:
+    Dtype key_dtype_;
+    SizeVector key_element_shape_;
+    Dtype value_dtype_;
+    SizeVector value_element_shape_;
+    Device device_;
+
+    /// Key arena of shape (capacity, *key_element_shape).
+    Tensor key_buffer_;
+    /// Value arena of shape (capacity, *value_element_shape).
+    Tensor value_buffer_;
+
+    /// Open-addressing table. Each slot holds an address, or one of the
+    /// kEmpty/kBusy/kErased markers defined in the implementation.
+    std::unique_ptr<std::atomic<int64_t>[]> slots_;
+    /// Number of slots, a power of 2.
+    int64_t num_slots_ = 0;
+    /// Number of slots holding the kErased marker.
+    int64_t num_erased_slots_ = 0;
+
+    /// Addresses of erased entries, reused before addresses >= arena_top_.
+    std::vector<int64_t> free_addrs_;
+    /// Addresses >= arena_top_ have never been used since the last Rehash.
+    int64_t arena_top_ = 0;
+    int64_t capacity_ = 0;
+    int64_t size_ = 0;
+};
+
+}  // namespace open3d
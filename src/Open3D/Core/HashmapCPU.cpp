@@ -0,0 +1,325 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Hashmap.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Open3D/Core/ParallelUtil.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+/// Slot markers. Valid addresses are non-negative.
+static constexpr int64_t kEmpty = -1;
+/// A thread has claimed the slot and is writing the key to the arena.
+static constexpr int64_t kBusy = -2;
+/// The entry has been erased. Probe sequences continue past erased slots.
+static constexpr int64_t kErased = -3;
+
+/// Batches are split into chunks of at least this many keys.
+static constexpr int64_t kHashmapGrainSize = 1 << 14;
+
+/// Calls \p func(i) for every i in [0, n) in parallel.
+template <typename func_t>
+static void ParallelForKeys(int64_t n, const func_t& func) {
+    kernel::parallel_util::ParallelFor(
+            0, n, kHashmapGrainSize, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    func(i);
+                }
+            });
+}
+
+/// FNV-1a over the key bytes, followed by the splitmix64 finalizer such that
+/// the low bits selecting the slot depend on all bytes of the key.
+static inline uint64_t HashKey(const uint8_t* key, int64_t byte_size) {
+    uint64_t hash = 14695981039346656037ULL;
+    int64_t i = 0;
+    for (; i + 4 <= byte_size; i += 4) {
+        uint32_t word;
+        std::memcpy(&word, key + i, 4);
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+    for (; i < byte_size; ++i) {
+        hash = (hash ^ key[i]) * 1099511628211ULL;
+    }
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    return hash ^ (hash >> 31);
+}
+
+void Hashmap::ResetSlots(int64_t capacity) {
+    int64_t num_slots = 16;
+    while (num_slots < 2 * capacity) {
+        num_slots *= 2;
+    }
+    slots_.reset(new std::atomic<int64_t>[num_slots]);
+    for (int64_t i = 0; i < num_slots; ++i) {
+        slots_[i].store(kEmpty, std::memory_order_relaxed);
+    }
+    num_slots_ = num_slots;
+    num_erased_slots_ = 0;
+}
+
+void Hashmap::RehashCPU(int64_t capacity, bool compact) {
+    const int64_t key_byte_size =
+            DtypeUtil::ByteSize(key_dtype_) * key_element_shape_.NumElements();
+    const int64_t value_byte_size = DtypeUtil::ByteSize(value_dtype_) *
+                                    value_element_shape_.NumElements();
+
+    std::vector<int64_t> active_addrs = GetActiveIndicesCPU();
+    const int64_t n = static_cast<int64_t>(active_addrs.size());
+    if (compact || capacity != capacity_) {
+        SizeVector key_shape = key_buffer_.GetShape();
+        SizeVector value_shape = value_buffer_.GetShape();
+        key_shape[0] = capacity;
+        value_shape[0] = capacity;
+        Tensor new_key_buffer = Tensor::Empty(key_shape, key_dtype_, device_);
+        Tensor new_value_buffer =
+                Tensor::Empty(value_shape, value_dtype_, device_);
+        const uint8_t* old_keys =
+                static_cast<const uint8_t*>(key_buffer_.GetDataPtr());
+        const uint8_t* old_values =
+                static_cast<const uint8_t*>(value_buffer_.GetDataPtr());
+        uint8_t* new_keys = static_cast<uint8_t*>(new_key_buffer.GetDataPtr());
+        uint8_t* new_values =
+                static_cast<uint8_t*>(new_value_buffer.GetDataPtr());
+        if (compact) {
+            // Compact the active entries to the front of the new arena.
+            ParallelForKeys(n, [&](int64_t i) {
+                std::memcpy(new_keys + i * key_byte_size,
+                            old_keys + active_addrs[i] * key_byte_size,
+                            key_byte_size);
+                std::memcpy(new_values + i * value_byte_size,
+                            old_values + active_addrs[i] * value_byte_size,
+                            value_byte_size);
+            });
+            for (int64_t i = 0; i < n; ++i) {
+                active_addrs[i] = i;
+            }
+            free_addrs_.clear();
+            arena_top_ = n;
+        } else if (arena_top_ > 0) {
+            std::memcpy(new_keys, old_keys, arena_top_ * key_byte_size);
+            std::memcpy(new_values, old_values, arena_top_ * value_byte_size);
+        }
+        key_buffer_ = new_key_buffer;
+        value_buffer_ = new_value_buffer;
+        capacity_ = capacity;
+    }
+
+    // Keys are unique, so each only needs an empty slot.
+    ResetSlots(capacity);
+    const uint8_t* keys = static_cast<const uint8_t*>(key_buffer_.GetDataPtr());
+    std::atomic<int64_t>* slots = slots_.get();
+    const uint64_t slot_mask = static_cast<uint64_t>(num_slots_ - 1);
+    ParallelForKeys(n, [&](int64_t i) {
+        const int64_t addr = active_addrs[i];
+        uint64_t slot = HashKey(keys + addr * key_byte_size, key_byte_size) &
+                        slot_mask;
+        while (true) {
+            int64_t expected = kEmpty;
+            if (slots[slot].compare_exchange_strong(
+                        expected, addr, std::memory_order_relaxed)) {
+                break;
+            }
+            slot = (slot + 1) & slot_mask;
+        }
+    });
+}
+
+void Hashmap::InsertCPU(const Tensor& keys,
+                        const Tensor* values,
+                        Tensor& addrs,
+                        Tensor& masks) {
+    const int64_t n = keys.GetShape()[0];
+    const int64_t key_byte_size =
+            DtypeUtil::ByteSize(key_dtype_) * key_element_shape_.NumElements();
+    const int64_t value_byte_size = DtypeUtil::ByteSize(value_dtype_) *
+                                    value_element_shape_.NumElements();
+    const uint8_t* key_ptr = static_cast<const uint8_t*>(keys.GetDataPtr());
+    const uint8_t* value_ptr =
+            values ? static_cast<const uint8_t*>(values->GetDataPtr())
+                   : nullptr;
+    uint8_t* key_arena = static_cast<uint8_t*>(key_buffer_.GetDataPtr());
+    uint8_t* value_arena = static_cast<uint8_t*>(value_buffer_.GetDataPtr());
+    int64_t* addr_ptr = static_cast<int64_t*>(addrs.GetDataPtr());
+    bool* mask_ptr = static_cast<bool*>(masks.GetDataPtr());
+    std::atomic<int64_t>* slots = slots_.get();
+    const uint64_t slot_mask = static_cast<uint64_t>(num_slots_ - 1);
+
+    // The k-th new entry takes the k-th address from the back of the free
+    // list, and then the addresses from arena_top_ upwards. Reserve() has
+    // made sure that these are within the capacity.
+    const int64_t* free_addrs = free_addrs_.data();
+    const int64_t num_free = static_cast<int64_t>(free_addrs_.size());
+    const int64_t arena_top = arena_top_;
+    std::atomic<int64_t> num_inserted(0);
+
+    ParallelForKeys(n, [&](int64_t i) {
+        const uint8_t* key = key_ptr + i * key_byte_size;
+        uint64_t slot = HashKey(key, key_byte_size) & slot_mask;
+        while (true) {
+            int64_t addr = slots[slot].load(std::memory_order_acquire);
+            if (addr == kEmpty) {
+                if (!slots[slot].compare_exchange_strong(
+                            addr, kBusy, std::memory_order_acq_rel)) {
+                    // Lost the race for the slot, re-examine it.
+                    continue;
+                }
+                int64_t k =
+                        num_inserted.fetch_add(1, std::memory_order_relaxed);
+                addr = k < num_free ? free_addrs[num_free - 1 - k]
+                                    : arena_top + k - num_free;
+                std::memcpy(key_arena + addr * key_byte_size, key,
+                            key_byte_size);
+                if (value_ptr) {
+                    std::memcpy(value_arena + addr * value_byte_size,
+                                value_ptr + i * value_byte_size,
+                                value_byte_size);
+                } else {
+                    std::memset(value_arena + addr * value_byte_size, 0,
+                                value_byte_size);
+                }
+                slots[slot].store(addr, std::memory_order_release);
+                addr_ptr[i] = addr;
+                mask_ptr[i] = true;
+                break;
+            }
+            if (addr == kBusy) {
+                // Wait until the key of the slot has been written.
+                continue;
+            }
+            if (addr >= 0 && std::memcmp(key_arena + addr * key_byte_size, key,
+                                         key_byte_size) == 0) {
+                addr_ptr[i] = addr;
+                mask_ptr[i] = false;
+                break;
+            }
+            slot = (slot + 1) & slot_mask;
+        }
+    });
+
+    const int64_t num_new = num_inserted.load();
+    const int64_t num_reused = std::min(num_new, num_free);
+    free_addrs_.resize(num_free - num_reused);
+    arena_top_ += num_new - num_reused;
+    size_ += num_new;
+}
+
+void Hashmap::FindCPU(const Tensor& keys, Tensor& addrs, Tensor& masks) const {
+    const int64_t n = keys.GetShape()[0];
+    const int64_t key_byte_size =
+            DtypeUtil::ByteSize(key_dtype_) * key_element_shape_.NumElements();
+    const uint8_t* key_ptr = static_cast<const uint8_t*>(keys.GetDataPtr());
+    const uint8_t* key_arena =
+            static_cast<const uint8_t*>(key_buffer_.GetDataPtr());
+    int64_t* addr_ptr = static_cast<int64_t*>(addrs.GetDataPtr());
+    bool* mask_ptr = static_cast<bool*>(masks.GetDataPtr());
+    const std::atomic<int64_t>* slots = slots_.get();
+    const uint64_t slot_mask = static_cast<uint64_t>(num_slots_ - 1);
+
+    ParallelForKeys(n, [&](int64_t i) {
+        const uint8_t* key = key_ptr + i * key_byte_size;
+        uint64_t slot = HashKey(key, key_byte_size) & slot_mask;
+        addr_ptr[i] = kEmpty;
+        mask_ptr[i] = false;
+        while (true) {
+            int64_t addr = slots[slot].load(std::memory_order_relaxed);
+            if (addr == kEmpty) {
+                break;
+            }
+            if (addr >= 0 && std::memcmp(key_arena + addr * key_byte_size, key,
+                                         key_byte_size) == 0) {
+                addr_ptr[i] = addr;
+                mask_ptr[i] = true;
+                break;
+            }
+            slot = (slot + 1) & slot_mask;
+        }
+    });
+}
+
+void Hashmap::EraseCPU(const Tensor& keys, Tensor& masks) {
+    const int64_t n = keys.GetShape()[0];
+    const int64_t key_byte_size =
+            DtypeUtil::ByteSize(key_dtype_) * key_element_shape_.NumElements();
+    const uint8_t* key_ptr = static_cast<const uint8_t*>(keys.GetDataPtr());
+    const uint8_t* key_arena =
+            static_cast<const uint8_t*>(key_buffer_.GetDataPtr());
+    bool* mask_ptr = static_cast<bool*>(masks.GetDataPtr());
+    std::atomic<int64_t>* slots = slots_.get();
+    const uint64_t slot_mask = static_cast<uint64_t>(num_slots_ - 1);
+    std::vector<int64_t> erased_addrs(n, kEmpty);
+
+    ParallelForKeys(n, [&](int64_t i) {
+        const uint8_t* key = key_ptr + i * key_byte_size;
+        uint64_t slot = HashKey(key, key_byte_size) & slot_mask;
+        mask_ptr[i] = false;
+        while (true) {
+            int64_t addr = slots[slot].load(std::memory_order_relaxed);
+            if (addr == kEmpty) {
+                break;
+            }
+            if (addr >= 0 && std::memcmp(key_arena + addr * key_byte_size, key,
+                                         key_byte_size) == 0) {
+                // Of several equal keys in the batch, only one succeeds.
+                if (slots[slot].compare_exchange_strong(
+                            addr, kErased, std::memory_order_relaxed)) {
+                    erased_addrs[i] = addr;
+                    mask_ptr[i] = true;
+                }
+                break;
+            }
+            slot = (slot + 1) & slot_mask;
+        }
+    });
+
+    for (int64_t addr : erased_addrs) {
+        if (addr >= 0) {
+            free_addrs_.push_back(addr);
+            ++num_erased_slots_;
+            --size_;
+        }
+    }
+}
+
+std::vector<int64_t> Hashmap::GetActiveIndicesCPU() const {
+    std::vector<int64_t> active_addrs;
+    active_addrs.reserve(size_);
+    for (int64_t i = 0; i < num_slots_; ++i) {
+        int64_t addr = slots_[i].load(std::memory_order_relaxed);
+        if (addr >= 0) {
+            active_addrs.push_back(addr);
+        }
+    }
+    std::sort(active_addrs.begin(), active_addrs.end());
+    return active_addrs;
+}
+
+}  // namespace open3d
@@ -386,6 +386,102 @@ int64_t Indexer::NumOutputElements() const {
     return num_output_elements;
 }
 
+bool Indexer::IsInputScalar(int64_t i) const {
+    const TensorRef& input = GetInput(i);
+    for (int64_t dim = 0; dim < ndims_; ++dim) {
+        if (input.byte_strides_[dim] != 0 && master_shape_[dim] > 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Indexer::IsContiguousInMasterOrder(const TensorRef& tr) const {
+    int64_t expected_byte_stride = tr.dtype_byte_size_;
+    for (int64_t dim = ndims_ - 1; dim >= 0; --dim) {
+        if (master_shape_[dim] == 1) {
+            continue;
+        }
+        if (tr.byte_strides_[dim] != expected_byte_stride) {
+            return false;
+        }
+        expected_byte_stride *= master_shape_[dim];
+    }
+    return true;
+}
+
+Indexer Indexer::GetCoalescedIndexer() const {
+    Indexer coalesced(*this);
+    auto can_merge = [&](const TensorRef& tr, int64_t outer, int64_t inner) {
+        return tr.byte_strides_[outer] ==
+               master_shape_[inner] * tr.byte_strides_[inner];
+    };
+
+    // prev_dim is the last dimension of this Indexer that was copied or
+    // merged into dimension ndims - 1 of the coalesced Indexer.
+    int64_t ndims = 0;
+    int64_t prev_dim = -1;
+    for (int64_t dim = 0; dim < ndims_; ++dim) {
+        // Size-1 dimensions do not contribute to any offset.
+        if (master_shape_[dim] == 1) {
+            continue;
+        }
+        bool merge = prev_dim >= 0;
+        for (int64_t i = 0; merge && i < num_inputs_; ++i) {
+            merge = can_merge(inputs_[i], prev_dim, dim);
+        }
+        for (int64_t i = 0; merge && i < num_outputs_; ++i) {
+            merge = can_merge(outputs_[i], prev_dim, dim);
+        }
+
+        // A merged dimension takes the strides of its inner dimension.
+        int64_t dst_dim = merge ? ndims - 1 : ndims++;
+        coalesced.master_shape_[dst_dim] =
+                merge ? coalesced.master_shape_[dst_dim] * master_shape_[dim]
+                      : master_shape_[dim];
+        for (int64_t i = 0; i < num_inputs_; ++i) {
+            coalesced.inputs_[i].byte_strides_[dst_dim] =
+                    inputs_[i].byte_strides_[dim];
+        }
+        for (int64_t i = 0; i < num_outputs_; ++i) {
+            coalesced.outputs_[i].byte_strides_[dst_dim] =
+                    outputs_[i].byte_strides_[dim];
+        }
+        prev_dim = dim;
+    }
+
+    // A single workload, e.g. of a 0-dim tensor.
+    if (ndims == 0) {
+        ndims = 1;
+        coalesced.master_shape_[0] = 1;
+        for (int64_t i = 0; i < num_inputs_; ++i) {
+            coalesced.inputs_[i].byte_strides_[0] = 0;
+        }
+        for (int64_t i = 0; i < num_outputs_; ++i) {
+            coalesced.outputs_[i].byte_strides_[0] = 0;
+        }
+    }
+
+    // Broadcasted and reduced dimensions keep stride 0 and shape 1.
+    auto update_shape = [&](TensorRef& tr) {
+        tr.ndims_ = ndims;
+        for (int64_t dim = 0; dim < ndims; ++dim) {
+            tr.shape_[dim] = tr.byte_strides_[dim] == 0
+                                     ? 1
+                                     : coalesced.master_shape_[dim];
+        }
+    };
+    for (int64_t i = 0; i < num_inputs_; ++i) {
+        update_shape(coalesced.inputs_[i]);
+    }
+    for (int64_t i = 0; i < num_outputs_; ++i) {
+        update_shape(coalesced.outputs_[i]);
+    }
+    coalesced.ndims_ = ndims;
+    coalesced.UpdateMasterStrides();
+    return coalesced;
+}
+
 void Indexer::CoalesceDimensions() {
     if (ndims_ <= 1) {
         return;
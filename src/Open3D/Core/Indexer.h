@@ -292,6 +292,14 @@ public:
     /// single output.
     Indexer GetPerOutputIndexer(int64_t output_idx) const;
 
+    /// Returns a copy of the Indexer with size-1 dimensions removed and
+    /// adjacent dimensions merged wherever every operand is contiguous across
+    /// them. Workload i refers to the same elements in both Indexers. E.g. a
+    /// contiguous (N, H, W) op has one dimension, and (N, 3) + (3,) has two.
+    /// Unlike CoalesceDimensions, the iteration order is preserved, so it also
+    /// applies to element-wise ops.
+    Indexer GetCoalescedIndexer() const;
+
     bool ShouldAccumulate() const { return accumulate_; }
 
     bool IsFinalOutput() const { return final_output_; }
@@ -393,6 +401,23 @@ public:
         return outputs_[0].byte_strides_[dim] == 0 && master_shape_[dim] > 1;
     }
 
+    /// Returns true if the \p i -th input is laid out contiguously in the
+    /// Indexer's iteration order, i.e. workload_idx maps to element
+    /// workload_idx of the input's data pointer.
+    bool IsInputContiguous(int64_t i) const {
+        return IsContiguousInMasterOrder(GetInput(i));
+    }
+
+    /// Returns true if the \p i -th output is laid out contiguously in the
+    /// Indexer's iteration order.
+    bool IsOutputContiguous(int64_t i = 0) const {
+        return IsContiguousInMasterOrder(GetOutput(i));
+    }
+
+    /// Returns true if the \p i -th input is broadcasted from a single
+    /// element, i.e. all workloads read the same input element.
+    bool IsInputScalar(int64_t i) const;
+
     /// Get input Tensor data pointer based on \p workload_idx.
     ///
     /// \param input_idx Input tensor index.
@@ -428,6 +453,11 @@ protected:
     // thread coalescing.
     void ReorderDimensions(const SizeVector& reduction_dims);
 
+    /// Returns true if \p tr 's byte strides are the default strides of
+    /// master_shape_ in units of its dtype size. Size-1 dimensions are
+    /// ignored.
+    bool IsContiguousInMasterOrder(const TensorRef& tr) const;
+
     /// Update master_strides_ based on master_shape_.
     void UpdateMasterStrides();
 
@@ -526,6 +556,128 @@ protected:
     bool accumulate_ = false;
 };
 
+/// Maximum number of dimensions of a StaticIndexer. Coalesced Indexers of
+/// nearly all ops have at most 3 dimensions.
+static constexpr int64_t MAX_STATIC_DIMS = 3;
+
+/// Offset computation of an Indexer's inputs and first output with the
+/// number of dimensions and inputs known at compile time, for CPU launchers.
+///
+/// ForEach computes the multi-index of the first workload once, then advances
+/// the pointers by the innermost strides and carries into the outer
+/// dimensions at the end of each row. This replaces the per-element division
+/// loop of Indexer::GetInputPtr and Indexer::GetOutputPtr.
+template <int NDIMS, int NINPUTS>
+class StaticIndexer {
+public:
+    /// \param indexer An Indexer with NDIMS dimensions and NINPUTS inputs,
+    /// typically from Indexer::GetCoalescedIndexer.
+    explicit StaticIndexer(const Indexer& indexer) {
+        if (indexer.NumDims() != NDIMS || indexer.NumInputs() != NINPUTS) {
+            utility::LogError(
+                    "Internal error: expected {} dims and {} inputs, but got "
+                    "{} dims and {} inputs.",
+                    NDIMS, NINPUTS, indexer.NumDims(), indexer.NumInputs());
+        }
+        for (int i = 0; i < NINPUTS; ++i) {
+            input_ptrs_[i] = static_cast<char*>(indexer.GetInput(i).data_ptr_);
+        }
+        output_ptr_ = static_cast<char*>(indexer.GetOutput(0).data_ptr_);
+        for (int dim = 0; dim < NDIMS; ++dim) {
+            shape_[dim] = indexer.GetMasterShape()[dim];
+            for (int i = 0; i < NINPUTS; ++i) {
+                input_strides_[i][dim] = indexer.GetInput(i).byte_strides_[dim];
+            }
+            output_strides_[dim] = indexer.GetOutput(0).byte_strides_[dim];
+        }
+    }
+
+    /// Calls \p func(input_ptrs, output_ptr) for the workloads in
+    /// [begin, end) in order, where input_ptrs is a `char* const*` of NINPUTS
+    /// pointers.
+    template <typename func_t>
+    void ForEach(int64_t begin, int64_t end, func_t func) const {
+        if (begin >= end) {
+            return;
+        }
+        int64_t index[NDIMS];
+        int64_t remainder = begin;
+        for (int dim = NDIMS - 1; dim > 0; --dim) {
+            index[dim] = remainder % shape_[dim];
+            remainder /= shape_[dim];
+        }
+        index[0] = remainder;
+
+        char* input_ptrs[NINPUTS];
+        int64_t workload_idx = begin;
+        while (true) {
+            // Pointers to the first workload of the row.
+            char* output_ptr = output_ptr_;
+            for (int dim = 0; dim < NDIMS; ++dim) {
+                output_ptr += index[dim] * output_strides_[dim];
+            }
+            for (int i = 0; i < NINPUTS; ++i) {
+                input_ptrs[i] = input_ptrs_[i];
+                for (int dim = 0; dim < NDIMS; ++dim) {
+                    input_ptrs[i] += index[dim] * input_strides_[i][dim];
+                }
+            }
+
+            int64_t row_end = std::min(
+                    end, workload_idx + shape_[NDIMS - 1] - index[NDIMS - 1]);
+            for (; workload_idx < row_end; ++workload_idx) {
+                func(input_ptrs, output_ptr);
+                for (int i = 0; i < NINPUTS; ++i) {
+                    input_ptrs[i] += input_strides_[i][NDIMS - 1];
+                }
+                output_ptr += output_strides_[NDIMS - 1];
+            }
+            if (workload_idx >= end) {
+                break;
+            }
+
+            // Carry into the outer dimensions.
+            index[NDIMS - 1] = 0;
+            for (int dim = NDIMS - 2; dim >= 0; --dim) {
+                if (++index[dim] < shape_[dim] || dim == 0) {
+                    break;
+                }
+                index[dim] = 0;
+            }
+        }
+    }
+
+private:
+    char* input_ptrs_[NINPUTS];
+    char* output_ptr_;
+    int64_t shape_[NDIMS];
+    int64_t input_strides_[NINPUTS][NDIMS];
+    int64_t output_strides_[NDIMS];
+};
+
+/// Coalesces \p indexer and calls \p func(static_indexer) with the matching
+/// StaticIndexer<NDIMS, NINPUTS> for NDIMS <= MAX_STATIC_DIMS.
+///
+/// \return false if the coalesced Indexer has more dimensions, in which case
+/// \p func is not called and the caller shall fall back to the Indexer.
+template <int NINPUTS, typename func_t>
+bool DispatchStaticIndexer(const Indexer& indexer, const func_t& func) {
+    Indexer coalesced = indexer.GetCoalescedIndexer();
+    switch (coalesced.NumDims()) {
+        case 1:
+            func(StaticIndexer<1, NINPUTS>(coalesced));
+            return true;
+        case 2:
+            func(StaticIndexer<2, NINPUTS>(coalesced));
+            return true;
+        case 3:
+            func(StaticIndexer<3, NINPUTS>(coalesced));
+            return true;
+        default:
+            return false;
+    }
+}
+
 class IndexerIterator {
 public:
     struct Iterator {
@@ -28,6 +28,7 @@
 
 #include <vector>
 
+#include "Open3D/Core/Profiler.h"
 #include "Open3D/Core/ShapeUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
@@ -44,10 +45,50 @@ const std::unordered_set<BinaryEWOpCode, utility::hash_enum_class::hash>
                 BinaryEWOpCode::Ne,
         };
 
+static const char* GetOpName(BinaryEWOpCode op_code) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            return "Add";
+        case BinaryEWOpCode::Sub:
+            return "Sub";
+        case BinaryEWOpCode::Mul:
+            return "Mul";
+        case BinaryEWOpCode::Div:
+            return "Div";
+        case BinaryEWOpCode::Maximum:
+            return "Maximum";
+        case BinaryEWOpCode::Minimum:
+            return "Minimum";
+        case BinaryEWOpCode::Pow:
+            return "Pow";
+        case BinaryEWOpCode::LogicalAnd:
+            return "LogicalAnd";
+        case BinaryEWOpCode::LogicalOr:
+            return "LogicalOr";
+        case BinaryEWOpCode::LogicalXor:
+            return "LogicalXor";
+        case BinaryEWOpCode::Gt:
+            return "Gt";
+        case BinaryEWOpCode::Lt:
+            return "Lt";
+        case BinaryEWOpCode::Ge:
+            return "Ge";
+        case BinaryEWOpCode::Le:
+            return "Le";
+        case BinaryEWOpCode::Eq:
+            return "Eq";
+        case BinaryEWOpCode::Ne:
+            return "Ne";
+    }
+    return "BinaryEW";
+}
+
 void BinaryEW(const Tensor& lhs,
               const Tensor& rhs,
               Tensor& dst,
               BinaryEWOpCode op_code) {
+    ProfilerScope scope(GetOpName(op_code), {lhs, rhs, dst});
+
     // lhs, rhs and dst must be on the same device.
     for (auto device :
          std::vector<Device>({rhs.GetDevice(), dst.GetDevice()})) {
@@ -40,6 +40,9 @@ enum class BinaryEWOpCode {
     Sub,
     Mul,
     Div,
+    Maximum,
+    Minimum,
+    Pow,
     LogicalAnd,
     LogicalOr,
     LogicalXor,
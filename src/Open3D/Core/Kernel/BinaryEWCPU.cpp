@@ -26,6 +26,8 @@
 
 #include "Open3D/Core/Kernel/BinaryEW.h"
 
+#include <cmath>
+
 #include "Open3D/Core/Dispatch.h"
 #include "Open3D/Core/Dtype.h"
 #include "Open3D/Core/Kernel/CPULauncher.h"
@@ -61,6 +63,108 @@ static void CPUDivElementKernel(const void* lhs, const void* rhs, void* dst) {
                                    *static_cast<const scalar_t*>(rhs);
 }
 
+template <typename scalar_t>
+static void CPUMaximumElementKernel(const void* lhs,
+                                    const void* rhs,
+                                    void* dst) {
+    scalar_t lhs_val = *static_cast<const scalar_t*>(lhs);
+    scalar_t rhs_val = *static_cast<const scalar_t*>(rhs);
+    *static_cast<scalar_t*>(dst) = lhs_val > rhs_val ? lhs_val : rhs_val;
+}
+
+template <typename scalar_t>
+static void CPUMinimumElementKernel(const void* lhs,
+                                    const void* rhs,
+                                    void* dst) {
+    scalar_t lhs_val = *static_cast<const scalar_t*>(lhs);
+    scalar_t rhs_val = *static_cast<const scalar_t*>(rhs);
+    *static_cast<scalar_t*>(dst) = lhs_val < rhs_val ? lhs_val : rhs_val;
+}
+
+template <typename scalar_t>
+static void CPUPowElementKernel(const void* lhs, const void* rhs, void* dst) {
+    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
+            std::pow(static_cast<double>(*static_cast<const scalar_t*>(lhs)),
+                     static_cast<double>(*static_cast<const scalar_t*>(rhs))));
+}
+
+// Element-wise operators for the vectorized contiguous fast path. Each functor
+// works on both scalar_t and simd::Vec<scalar_t>.
+struct CPUAddFunctor {
+    template <typename T>
+    T operator()(const T& lhs, const T& rhs) const {
+        return static_cast<T>(lhs + rhs);
+    }
+};
+
+struct CPUSubFunctor {
+    template <typename T>
+    T operator()(const T& lhs, const T& rhs) const {
+        return static_cast<T>(lhs - rhs);
+    }
+};
+
+struct CPUMulFunctor {
+    template <typename T>
+    T operator()(const T& lhs, const T& rhs) const {
+        return static_cast<T>(lhs * rhs);
+    }
+};
+
+struct CPUDivFunctor {
+    template <typename T>
+    T operator()(const T& lhs, const T& rhs) const {
+        return static_cast<T>(lhs / rhs);
+    }
+};
+
+struct CPUMaximumFunctor {
+    template <typename scalar_t>
+    scalar_t operator()(scalar_t lhs, scalar_t rhs) const {
+        return lhs > rhs ? lhs : rhs;
+    }
+    template <typename scalar_t>
+    simd::Vec<scalar_t> operator()(const simd::Vec<scalar_t>& lhs,
+                                   const simd::Vec<scalar_t>& rhs) const {
+        return lhs.Max(rhs);
+    }
+};
+
+struct CPUMinimumFunctor {
+    template <typename scalar_t>
+    scalar_t operator()(scalar_t lhs, scalar_t rhs) const {
+        return lhs < rhs ? lhs : rhs;
+    }
+    template <typename scalar_t>
+    simd::Vec<scalar_t> operator()(const simd::Vec<scalar_t>& lhs,
+                                   const simd::Vec<scalar_t>& rhs) const {
+        return lhs.Min(rhs);
+    }
+};
+
+// There is no vector pow instruction, so the lanes are computed one by one.
+// This still takes the contiguous and broadcasted-scalar fast paths.
+struct CPUPowFunctor {
+    template <typename scalar_t>
+    scalar_t operator()(scalar_t lhs, scalar_t rhs) const {
+        return static_cast<scalar_t>(std::pow(static_cast<double>(lhs),
+                                              static_cast<double>(rhs)));
+    }
+    template <typename scalar_t>
+    simd::Vec<scalar_t> operator()(const simd::Vec<scalar_t>& lhs,
+                                   const simd::Vec<scalar_t>& rhs) const {
+        using Vec = simd::Vec<scalar_t>;
+        scalar_t lhs_vals[Vec::size];
+        scalar_t rhs_vals[Vec::size];
+        lhs.Store(lhs_vals);
+        rhs.Store(rhs_vals);
+        for (int64_t i = 0; i < Vec::size; ++i) {
+            lhs_vals[i] = (*this)(lhs_vals[i], rhs_vals[i]);
+        }
+        return Vec::Load(lhs_vals);
+    }
+};
+
 template <typename src_t, typename dst_t>
 static void CPULogicalAndElementKernel(const void* lhs,
                                        const void* rhs,
@@ -206,20 +310,53 @@ void BinaryEWCPU(const Tensor& lhs,
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUAddElementKernel<scalar_t>);
+                    if (!CPULauncher::TryLaunchBinaryEWKernelVectorized<
+                                scalar_t>(indexer, CPUAddFunctor())) {
+                        CPULauncher::LaunchBinaryEWKernel(
+                                indexer, CPUAddElementKernel<scalar_t>);
+                    }
                     break;
                 case BinaryEWOpCode::Sub:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUSubElementKernel<scalar_t>);
+                    if (!CPULauncher::TryLaunchBinaryEWKernelVectorized<
+                                scalar_t>(indexer, CPUSubFunctor())) {
+                        CPULauncher::LaunchBinaryEWKernel(
+                                indexer, CPUSubElementKernel<scalar_t>);
+                    }
                     break;
                 case BinaryEWOpCode::Mul:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUMulElementKernel<scalar_t>);
+                    if (!CPULauncher::TryLaunchBinaryEWKernelVectorized<
+                                scalar_t>(indexer, CPUMulFunctor())) {
+                        CPULauncher::LaunchBinaryEWKernel(
+                                indexer, CPUMulElementKernel<scalar_t>);
+                    }
                     break;
                 case BinaryEWOpCode::Div:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUDivElementKernel<scalar_t>);
+                    if (!CPULauncher::TryLaunchBinaryEWKernelVectorized<
+                                scalar_t>(indexer, CPUDivFunctor())) {
+                        CPULauncher::LaunchBinaryEWKernel(
+                                indexer, CPUDivElementKernel<scalar_t>);
+                    }
+                    break;
+                case BinaryEWOpCode::Maximum:
+                    if (!CPULauncher::TryLaunchBinaryEWKernelVectorized<
+                                scalar_t>(indexer, CPUMaximumFunctor())) {
+                        CPULauncher::LaunchBinaryEWKernel(
+                                indexer, CPUMaximumElementKernel<scalar_t>);
+                    }
+                    break;
+                case BinaryEWOpCode::Minimum:
+                    if (!CPULauncher::TryLaunchBinaryEWKernelVectorized<
+                                scalar_t>(indexer, CPUMinimumFunctor())) {
+                        CPULauncher::LaunchBinaryEWKernel(
+                                indexer, CPUMinimumElementKernel<scalar_t>);
+                    }
+                    break;
+                case BinaryEWOpCode::Pow:
+                    if (!CPULauncher::TryLaunchBinaryEWKernelVectorized<
+                                scalar_t>(indexer, CPUPowFunctor())) {
+                        CPULauncher::LaunchBinaryEWKernel(
+                                indexer, CPUPowElementKernel<scalar_t>);
+                    }
                     break;
                 default:
                     break;
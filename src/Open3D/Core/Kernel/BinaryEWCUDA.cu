@@ -67,6 +67,33 @@ static OPEN3D_HOST_DEVICE void CUDADivElementKernel(const void* lhs,
                                    *static_cast<const scalar_t*>(rhs);
 }
 
+template <typename scalar_t>
+static OPEN3D_HOST_DEVICE void CUDAMaximumElementKernel(const void* lhs,
+                                                        const void* rhs,
+                                                        void* dst) {
+    scalar_t lhs_val = *static_cast<const scalar_t*>(lhs);
+    scalar_t rhs_val = *static_cast<const scalar_t*>(rhs);
+    *static_cast<scalar_t*>(dst) = lhs_val > rhs_val ? lhs_val : rhs_val;
+}
+
+template <typename scalar_t>
+static OPEN3D_HOST_DEVICE void CUDAMinimumElementKernel(const void* lhs,
+                                                        const void* rhs,
+                                                        void* dst) {
+    scalar_t lhs_val = *static_cast<const scalar_t*>(lhs);
+    scalar_t rhs_val = *static_cast<const scalar_t*>(rhs);
+    *static_cast<scalar_t*>(dst) = lhs_val < rhs_val ? lhs_val : rhs_val;
+}
+
+template <typename scalar_t>
+static OPEN3D_HOST_DEVICE void CUDAPowElementKernel(const void* lhs,
+                                                    const void* rhs,
+                                                    void* dst) {
+    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
+            pow(static_cast<double>(*static_cast<const scalar_t*>(lhs)),
+                static_cast<double>(*static_cast<const scalar_t*>(rhs))));
+}
+
 template <typename src_t, typename dst_t>
 static OPEN3D_HOST_DEVICE void CUDALogicalAndElementKernel(const void* lhs,
                                                            const void* rhs,
@@ -291,6 +318,32 @@ void BinaryEWCUDA(const Tensor& lhs,
                                 CUDADivElementKernel<scalar_t>(lhs, rhs, dst);
                             });
                     break;
+                case BinaryEWOpCode::Maximum:
+                    CUDALauncher::LaunchBinaryEWKernel(
+                            indexer,
+                            [] OPEN3D_HOST_DEVICE(const void* lhs, void* rhs,
+                                                  void* dst) {
+                                CUDAMaximumElementKernel<scalar_t>(lhs, rhs,
+                                                                   dst);
+                            });
+                    break;
+                case BinaryEWOpCode::Minimum:
+                    CUDALauncher::LaunchBinaryEWKernel(
+                            indexer,
+                            [] OPEN3D_HOST_DEVICE(const void* lhs, void* rhs,
+                                                  void* dst) {
+                                CUDAMinimumElementKernel<scalar_t>(lhs, rhs,
+                                                                   dst);
+                            });
+                    break;
+                case BinaryEWOpCode::Pow:
+                    CUDALauncher::LaunchBinaryEWKernel(
+                            indexer,
+                            [] OPEN3D_HOST_DEVICE(const void* lhs, void* rhs,
+                                                  void* dst) {
+                                CUDAPowElementKernel<scalar_t>(lhs, rhs, dst);
+                            });
+                    break;
                 default:
                     break;
             }
@@ -26,11 +26,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
 #include "Open3D/Core/AdvancedIndexing.h"
 #include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/Kernel/SIMD.h"
 #include "Open3D/Core/ParallelUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
@@ -43,41 +45,226 @@ public:
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        LaunchIndexerKernel<1>(indexer,
+                               [&](char* const* input_ptrs, char* output_ptr) {
+                                   element_kernel(input_ptrs[0], output_ptr);
+                               });
     }
 
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+        LaunchIndexerKernel<2>(indexer,
+                               [&](char* const* input_ptrs, char* output_ptr) {
+                                   element_kernel(input_ptrs[0], input_ptrs[1],
+                                                  output_ptr);
+                               });
+    }
+
+    /// Calls \p workload_kernel(input_ptrs, output_ptr) for every workload of
+    /// \p indexer in parallel, where input_ptrs holds NINPUTS pointers.
+    /// Indexers that coalesce to at most MAX_STATIC_DIMS dimensions use a
+    /// StaticIndexer, others compute the offsets of every element.
+    template <int NINPUTS, typename func_t>
+    static void LaunchIndexerKernel(const Indexer& indexer,
+                                    func_t workload_kernel) {
+        int64_t num_workloads = indexer.NumWorkloads();
+        if (num_workloads == 0) {
+            return;
         }
+        bool launched = DispatchStaticIndexer<NINPUTS>(
+                indexer, [&](const auto& static_indexer) {
+                    parallel_util::ParallelFor(
+                            0, num_workloads, kDefaultGrainSize,
+                            [&](int64_t start, int64_t end) {
+                                static_indexer.ForEach(start, end,
+                                                       workload_kernel);
+                            });
+                });
+        if (launched) {
+            return;
+        }
+        parallel_util::ParallelFor(
+                0, num_workloads, kDefaultGrainSize,
+                [&](int64_t start, int64_t end) {
+                    char* input_ptrs[NINPUTS];
+                    for (int64_t workload_idx = start; workload_idx < end;
+                         ++workload_idx) {
+                        for (int i = 0; i < NINPUTS; ++i) {
+                            input_ptrs[i] =
+                                    indexer.GetInputPtr(i, workload_idx);
+                        }
+                        workload_kernel(input_ptrs,
+                                        indexer.GetOutputPtr(workload_idx));
+                    }
+                });
+    }
+
+    /// Contiguous fast path for unary element-wise kernels. \p element_op is
+    /// called as `dst_t element_op(src_t)` on raw values instead of going
+    /// through the Indexer's per-element offset computation.
+    ///
+    /// \return false if the input or output is not contiguous in the
+    /// Indexer's iteration order, in which case nothing is launched and the
+    /// caller shall fall back to LaunchUnaryEWKernel.
+    template <typename src_t, typename dst_t, typename func_t>
+    static bool TryLaunchUnaryEWKernelContiguous(const Indexer& indexer,
+                                                 func_t element_op) {
+        if (!indexer.IsInputContiguous(0) || !indexer.IsOutputContiguous()) {
+            return false;
+        }
+        const src_t* src =
+                reinterpret_cast<const src_t*>(indexer.GetInputPtr(0, 0));
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
+        LaunchContiguousChunks(
+                indexer.NumWorkloads(), [&](int64_t start, int64_t end) {
+                    for (int64_t i = start; i < end; ++i) {
+                        dst[i] = element_op(src[i]);
+                    }
+                });
+        return true;
+    }
+
+    /// Vectorized variant of TryLaunchUnaryEWKernelContiguous. \p element_op
+    /// must be callable on both scalar_t and simd::Vec<scalar_t>.
+    template <typename scalar_t, typename func_t>
+    static bool TryLaunchUnaryEWKernelVectorized(const Indexer& indexer,
+                                                 func_t element_op) {
+        if (!indexer.IsInputContiguous(0) || !indexer.IsOutputContiguous()) {
+            return false;
+        }
+        using Vec = simd::Vec<scalar_t>;
+        const scalar_t* src =
+                reinterpret_cast<const scalar_t*>(indexer.GetInputPtr(0, 0));
+        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
+        LaunchContiguousChunks(
+                indexer.NumWorkloads(), [&](int64_t start, int64_t end) {
+                    int64_t i = start;
+                    for (; i + Vec::size <= end; i += Vec::size) {
+                        element_op(Vec::Load(src + i)).Store(dst + i);
+                    }
+                    for (; i < end; ++i) {
+                        dst[i] = element_op(src[i]);
+                    }
+                });
+        return true;
+    }
+
+    /// Vectorized fast path for binary element-wise kernels with identical
+    /// input and output dtypes. Each input must either be contiguous in the
+    /// Indexer's iteration order or be a broadcasted single element (e.g.
+    /// `tensor + scalar_tensor`), and the output must be contiguous.
+    /// \p element_op must be callable on both scalar_t and
+    /// simd::Vec<scalar_t>.
+    ///
+    /// \return false if the layout is not supported, in which case nothing is
+    /// launched and the caller shall fall back to LaunchBinaryEWKernel.
+    template <typename scalar_t, typename func_t>
+    static bool TryLaunchBinaryEWKernelVectorized(const Indexer& indexer,
+                                                  func_t element_op) {
+        if (!indexer.IsOutputContiguous()) {
+            return false;
+        }
+        bool lhs_contiguous = indexer.IsInputContiguous(0);
+        bool rhs_contiguous = indexer.IsInputContiguous(1);
+        bool lhs_scalar = !lhs_contiguous && indexer.IsInputScalar(0);
+        bool rhs_scalar = !rhs_contiguous && indexer.IsInputScalar(1);
+        if (!(lhs_contiguous || lhs_scalar) ||
+            !(rhs_contiguous || rhs_scalar)) {
+            return false;
+        }
+
+        const scalar_t* lhs =
+                reinterpret_cast<const scalar_t*>(indexer.GetInputPtr(0, 0));
+        const scalar_t* rhs =
+                reinterpret_cast<const scalar_t*>(indexer.GetInputPtr(1, 0));
+        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
+        int64_t num_workloads = indexer.NumWorkloads();
+        if (lhs_scalar) {
+            LaunchContiguousChunks(num_workloads, [&](int64_t start,
+                                                      int64_t end) {
+                BinaryContiguousLoop<scalar_t, true, false>(lhs, rhs, dst,
+                                                            start, end,
+                                                            element_op);
+            });
+        } else if (rhs_scalar) {
+            LaunchContiguousChunks(num_workloads, [&](int64_t start,
+                                                      int64_t end) {
+                BinaryContiguousLoop<scalar_t, false, true>(lhs, rhs, dst,
+                                                            start, end,
+                                                            element_op);
+            });
+        } else {
+            LaunchContiguousChunks(num_workloads, [&](int64_t start,
+                                                      int64_t end) {
+                BinaryContiguousLoop<scalar_t, false, false>(lhs, rhs, dst,
+                                                             start, end,
+                                                             element_op);
+            });
+        }
+        return true;
+    }
+
+    /// Contiguous fast path for ternary element-wise kernels. Each input must
+    /// either be contiguous in the Indexer's iteration order or be a
+    /// broadcasted single element, and the output must be contiguous.
+    /// \p element_op is called as `dst_t element_op(t0, t1, t2)` on raw
+    /// values.
+    ///
+    /// \return false if the layout is not supported, in which case nothing is
+    /// launched and the caller shall fall back to LaunchIndexerKernel<3>.
+    template <typename t0_t,
+              typename t1_t,
+              typename t2_t,
+              typename dst_t,
+              typename func_t>
+    static bool TryLaunchTernaryEWKernelContiguous(const Indexer& indexer,
+                                                   func_t element_op) {
+        if (!indexer.IsOutputContiguous()) {
+            return false;
+        }
+        // Steps are 1 for contiguous inputs and 0 for broadcasted elements.
+        int64_t steps[3];
+        for (int64_t i = 0; i < 3; ++i) {
+            if (indexer.IsInputContiguous(i)) {
+                steps[i] = 1;
+            } else if (indexer.IsInputScalar(i)) {
+                steps[i] = 0;
+            } else {
+                return false;
+            }
+        }
+
+        const t0_t* src0 =
+                reinterpret_cast<const t0_t*>(indexer.GetInputPtr(0, 0));
+        const t1_t* src1 =
+                reinterpret_cast<const t1_t*>(indexer.GetInputPtr(1, 0));
+        const t2_t* src2 =
+                reinterpret_cast<const t2_t*>(indexer.GetInputPtr(2, 0));
+        dst_t* dst = reinterpret_cast<dst_t*>(indexer.GetOutputPtr(0));
+        LaunchContiguousChunks(
+                indexer.NumWorkloads(), [&](int64_t start, int64_t end) {
+                    for (int64_t i = start; i < end; ++i) {
+                        dst[i] = element_op(src0[i * steps[0]],
+                                            src1[i * steps[1]],
+                                            src2[i * steps[2]]);
+                    }
+                });
+        return true;
     }
 
     template <typename func_t>
     static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                             func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        parallel_util::ParallelFor(
+                0, indexer.NumWorkloads(), kDefaultGrainSize,
+                [&](int64_t start, int64_t end) {
+                    for (int64_t workload_idx = start; workload_idx < end;
+                         ++workload_idx) {
+                        element_kernel(indexer.GetInputPtr(workload_idx),
+                                       indexer.GetOutputPtr(workload_idx));
+                    }
+                });
     }
 
     template <typename scalar_t, typename func_t>
@@ -107,10 +294,7 @@ public:
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        parallel_util::ParallelForChunks(num_threads, [&](int64_t thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
             for (int64_t workload_idx = start; workload_idx < end;
@@ -118,7 +302,7 @@ public:
                 element_kernel(indexer.GetInputPtr(0, workload_idx),
                                &thread_results[thread_idx]);
             }
-        }
+        });
         void* output_ptr = indexer.GetOutputPtr(0);
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             element_kernel(&thread_results[thread_idx], output_ptr);
@@ -153,13 +337,54 @@ public:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
+        parallel_util::ParallelFor(
+                0, indexer_shape[best_dim], 1, [&](int64_t start, int64_t end) {
+                    for (int64_t i = start; i < end; ++i) {
+                        Indexer sub_indexer(indexer);
+                        sub_indexer.ShrinkDim(best_dim, i, 1);
+                        LaunchReductionKernelSerial<scalar_t>(sub_indexer,
+                                                              element_kernel);
+                    }
+                });
+    }
+
+private:
+    /// Minimum number of workloads processed per task. Small enough to
+    /// load-balance, large enough to amortize the scheduling overhead. Inputs
+    /// smaller than this run on the calling thread.
+    static constexpr int64_t kDefaultGrainSize = 32768;
+
+    /// Calls \p chunk_func(start, end) on chunks of at least kDefaultGrainSize
+    /// workloads covering [0, num_workloads) in parallel.
+    template <typename func_t>
+    static void LaunchContiguousChunks(int64_t num_workloads,
+                                       func_t chunk_func) {
+        parallel_util::ParallelFor(0, num_workloads, kDefaultGrainSize,
+                                   chunk_func);
+    }
+
+    template <typename scalar_t,
+              bool lhs_scalar,
+              bool rhs_scalar,
+              typename func_t>
+    static void BinaryContiguousLoop(const scalar_t* lhs,
+                                     const scalar_t* rhs,
+                                     scalar_t* dst,
+                                     int64_t start,
+                                     int64_t end,
+                                     func_t element_op) {
+        using Vec = simd::Vec<scalar_t>;
+        int64_t i = start;
+        for (; i + Vec::size <= end; i += Vec::size) {
+            Vec lhs_vec = lhs_scalar ? Vec::Broadcast(lhs[0])
+                                     : Vec::Load(lhs + i);
+            Vec rhs_vec = rhs_scalar ? Vec::Broadcast(rhs[0])
+                                     : Vec::Load(rhs + i);
+            element_op(lhs_vec, rhs_vec).Store(dst + i);
+        }
+        for (; i < end; ++i) {
+            dst[i] = element_op(lhs_scalar ? lhs[0] : lhs[i],
+                                rhs_scalar ? rhs[0] : rhs[i]);
         }
     }
 };
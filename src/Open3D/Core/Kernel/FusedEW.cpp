@@ -0,0 +1,197 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+bool IsFusableOpCode(UnaryEWOpCode op_code) {
+    return op_code != UnaryEWOpCode::LogicalNot;
+}
+
+bool IsFusableOpCode(BinaryEWOpCode op_code) {
+    return s_boolean_binary_ew_op_codes.find(op_code) ==
+           s_boolean_binary_ew_op_codes.end();
+}
+
+int64_t FusedEWStackDepth(const FusedEWProgram& program, int64_t num_inputs) {
+    int64_t depth = 0;
+    int64_t max_depth = 0;
+    std::vector<bool> stored(FusedEWNumRegisters(program), false);
+    for (const FusedEWInstruction& instruction : program) {
+        switch (instruction.type_) {
+            case FusedEWInstruction::Type::Input:
+                if (instruction.input_idx_ < 0 ||
+                    instruction.input_idx_ >= num_inputs) {
+                    utility::LogError(
+                            "Fused program input index {} out of range [0, "
+                            "{}).",
+                            instruction.input_idx_, num_inputs);
+                }
+                depth++;
+                break;
+            case FusedEWInstruction::Type::Unary:
+                if (depth < 1 || !IsFusableOpCode(instruction.unary_op_code_)) {
+                    utility::LogError("Invalid unary op in fused program.");
+                }
+                break;
+            case FusedEWInstruction::Type::Binary:
+                if (depth < 2 ||
+                    !IsFusableOpCode(instruction.binary_op_code_)) {
+                    utility::LogError("Invalid binary op in fused program.");
+                }
+                depth--;
+                break;
+            case FusedEWInstruction::Type::Store:
+                if (depth < 1 || instruction.register_idx_ < 0) {
+                    utility::LogError("Invalid store in fused program.");
+                }
+                stored[instruction.register_idx_] = true;
+                break;
+            case FusedEWInstruction::Type::Load:
+                if (instruction.register_idx_ < 0 ||
+                    !stored[instruction.register_idx_]) {
+                    utility::LogError(
+                            "Fused program loads register {} before storing "
+                            "it.",
+                            instruction.register_idx_);
+                }
+                depth++;
+                break;
+        }
+        max_depth = std::max(max_depth, depth);
+    }
+    if (depth != 1) {
+        utility::LogError(
+                "Fused program must leave exactly one value, but {} are left.",
+                depth);
+    }
+    return max_depth;
+}
+
+int64_t FusedEWNumRegisters(const FusedEWProgram& program) {
+    int64_t num_registers = 0;
+    for (const FusedEWInstruction& instruction : program) {
+        if (instruction.type_ == FusedEWInstruction::Type::Store ||
+            instruction.type_ == FusedEWInstruction::Type::Load) {
+            num_registers =
+                    std::max(num_registers, instruction.register_idx_ + 1);
+        }
+    }
+    return num_registers;
+}
+
+static SizeVector CheckFusedEWInputs(const std::vector<Tensor>& inputs,
+                                     const FusedEWProgram& program,
+                                     const Tensor& dst) {
+    if (inputs.empty()) {
+        utility::LogError("Fused program must have at least one input.");
+    }
+    FusedEWStackDepth(program, static_cast<int64_t>(inputs.size()));
+
+    SizeVector broadcasted_shape = inputs[0].GetShape();
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+        broadcasted_shape = shape_util::BroadcastedShape(broadcasted_shape,
+                                                         input.GetShape());
+    }
+    return broadcasted_shape;
+}
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const FusedEWProgram& program,
+             Tensor& dst) {
+    SizeVector broadcasted_shape = CheckFusedEWInputs(inputs, program, dst);
+    if (broadcasted_shape != dst.GetShape()) {
+        utility::LogError(
+                "The broadcasted input shape {} does not match the output "
+                "shape {}.",
+                broadcasted_shape, dst.GetShape());
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+void FusedEWReduction(const std::vector<Tensor>& inputs,
+                      const FusedEWProgram& program,
+                      Tensor& dst,
+                      const SizeVector& dims,
+                      bool keepdim,
+                      ReductionOpCode op_code) {
+    if (regular_reduce_ops.find(op_code) == regular_reduce_ops.end()) {
+        utility::LogError("Fused reduction only supports Sum, Prod, Min, Max.");
+    }
+    SizeVector broadcasted_shape = CheckFusedEWInputs(inputs, program, dst);
+    SizeVector keepdim_shape =
+            shape_util::ReductionShape(broadcasted_shape, dims, true);
+    SizeVector non_keepdim_shape =
+            shape_util::ReductionShape(broadcasted_shape, dims, false);
+    if (keepdim && keepdim_shape != dst.GetShape()) {
+        utility::LogError("Expected output shape {} but got {}.",
+                          keepdim_shape.ToString(), dst.GetShape().ToString());
+    }
+    if (!keepdim && non_keepdim_shape != dst.GetShape()) {
+        utility::LogError("Expected output shape {} but got {}.",
+                          non_keepdim_shape.ToString(),
+                          dst.GetShape().ToString());
+    }
+
+    // Without reduction dims, this is a plain fused element-wise op.
+    if (dims.size() == 0) {
+        FusedEW(inputs, program, dst);
+        return;
+    }
+
+    // Always reshape to keepdim case. This reshaping is copy-free.
+    Tensor dst_keepdim = dst.Reshape(keepdim_shape);
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWReductionCPU(inputs, program, dst_keepdim, op_code);
+    } else {
+        utility::LogError("FusedEWReduction: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
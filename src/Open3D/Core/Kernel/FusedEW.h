@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "Open3D/Core/Kernel/BinaryEW.h"
+#include "Open3D/Core/Kernel/Reduction.h"
+#include "Open3D/Core/Kernel/UnaryEW.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace kernel {
+
+/// One instruction of a fused element-wise program.
+///
+/// A program is a postfix sequence of instructions evaluated on a stack of
+/// values: Input pushes the element of an input tensor, Unary replaces the top
+/// of the stack, and Binary pops the rhs and lhs and pushes the result. Store
+/// copies the top of the stack to a register and Load pushes a register,
+/// such that a shared subexpression is only computed once. A valid program
+/// leaves exactly one value on the stack.
+///
+/// E.g. (inputs[0] - inputs[1]) * (inputs[0] - inputs[1]) is
+/// [Input(0), Input(1), Binary(Sub), Store(0), Load(0), Binary(Mul)].
+struct FusedEWInstruction {
+    enum class Type { Input, Unary, Binary, Store, Load };
+
+    static FusedEWInstruction Input(int64_t input_idx) {
+        FusedEWInstruction instruction;
+        instruction.type_ = Type::Input;
+        instruction.input_idx_ = input_idx;
+        return instruction;
+    }
+    static FusedEWInstruction Unary(UnaryEWOpCode op_code) {
+        FusedEWInstruction instruction;
+        instruction.type_ = Type::Unary;
+        instruction.unary_op_code_ = op_code;
+        return instruction;
+    }
+    static FusedEWInstruction Binary(BinaryEWOpCode op_code) {
+        FusedEWInstruction instruction;
+        instruction.type_ = Type::Binary;
+        instruction.binary_op_code_ = op_code;
+        return instruction;
+    }
+    static FusedEWInstruction Store(int64_t register_idx) {
+        FusedEWInstruction instruction;
+        instruction.type_ = Type::Store;
+        instruction.register_idx_ = register_idx;
+        return instruction;
+    }
+    static FusedEWInstruction Load(int64_t register_idx) {
+        FusedEWInstruction instruction;
+        instruction.type_ = Type::Load;
+        instruction.register_idx_ = register_idx;
+        return instruction;
+    }
+
+    Type type_ = Type::Input;
+    int64_t input_idx_ = 0;
+    int64_t register_idx_ = 0;
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+};
+
+typedef std::vector<FusedEWInstruction> FusedEWProgram;
+
+/// Returns true if \p op_code can be part of a fused element-wise program.
+/// Only arithmetic ops preserving the input dtype are supported.
+bool IsFusableOpCode(UnaryEWOpCode op_code);
+bool IsFusableOpCode(BinaryEWOpCode op_code);
+
+/// Validates \p program against \p num_inputs inputs and returns the maximum
+/// stack depth needed to evaluate it.
+int64_t FusedEWStackDepth(const FusedEWProgram& program, int64_t num_inputs);
+
+/// Returns the number of registers used by \p program.
+int64_t FusedEWNumRegisters(const FusedEWProgram& program);
+
+/// Evaluates \p program element-wise in a single pass. \p inputs are
+/// broadcasted to \p dst 's shape and must all have \p dst 's dtype.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const FusedEWProgram& program,
+             Tensor& dst);
+
+/// Evaluates \p program element-wise and reduces the result along \p dims in
+/// a single pass, without materializing the element-wise result. Only Sum,
+/// Prod, Min and Max are supported.
+void FusedEWReduction(const std::vector<Tensor>& inputs,
+                      const FusedEWProgram& program,
+                      Tensor& dst,
+                      const SizeVector& dims,
+                      bool keepdim,
+                      ReductionOpCode op_code);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const FusedEWProgram& program,
+                Tensor& dst);
+
+/// \param dst The output in the keepdim shape.
+void FusedEWReductionCPU(const std::vector<Tensor>& inputs,
+                         const FusedEWProgram& program,
+                         Tensor& dst,
+                         ReductionOpCode op_code);
+
+}  // namespace kernel
+}  // namespace open3d
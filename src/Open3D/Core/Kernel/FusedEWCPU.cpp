@@ -0,0 +1,516 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/ParallelUtil.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Number of workloads evaluated together. Each stack slot and register holds
+/// one block of values, so they stay in L1 cache for typical programs.
+static constexpr int64_t kFusedBlockSize = 256;
+
+/// Minimum number of workloads per parallel chunk.
+static constexpr int64_t kFusedGrainSize = 32768;
+
+/// Evaluates a FusedEWProgram block by block. Each instruction is applied to
+/// a whole block of values before moving on to the next instruction, which
+/// amortizes the interpretation overhead and keeps the inner loops simple.
+///
+/// Not thread-safe, create one evaluator per thread.
+template <typename scalar_t>
+class CPUFusedEWEvaluator {
+public:
+    CPUFusedEWEvaluator(const FusedEWProgram& program, int64_t stack_depth)
+        : program_(program),
+          stack_depth_(stack_depth),
+          stack_((stack_depth + FusedEWNumRegisters(program)) *
+                 kFusedBlockSize) {}
+
+    /// Sets the Indexer to read inputs from. Must be called before Run().
+    void SetIndexer(const Indexer& indexer) {
+        indexer_ = &indexer;
+        int64_t num_inputs = indexer.NumInputs();
+        input_layouts_.resize(num_inputs);
+        input_ptrs_.resize(num_inputs);
+        for (int64_t i = 0; i < num_inputs; ++i) {
+            if (indexer.IsInputContiguous(i)) {
+                input_layouts_[i] = InputLayout::Contiguous;
+            } else if (indexer.IsInputScalar(i)) {
+                input_layouts_[i] = InputLayout::Scalar;
+            } else {
+                input_layouts_[i] = InputLayout::Strided;
+            }
+            input_ptrs_[i] = reinterpret_cast<const scalar_t*>(
+                    indexer.GetInputPtr(i, 0));
+        }
+    }
+
+    /// Evaluates workloads [start, start + count), count <= kFusedBlockSize.
+    /// Returns the results, valid until the next call.
+    const scalar_t* Run(int64_t start, int64_t count) {
+        int64_t depth = 0;
+        for (const FusedEWInstruction& instruction : program_) {
+            switch (instruction.type_) {
+                case FusedEWInstruction::Type::Input:
+                    LoadInput(instruction.input_idx_, start, count,
+                              Slot(depth));
+                    depth++;
+                    break;
+                case FusedEWInstruction::Type::Unary:
+                    ApplyUnary(instruction.unary_op_code_, Slot(depth - 1),
+                               count);
+                    break;
+                case FusedEWInstruction::Type::Binary:
+                    ApplyBinary(instruction.binary_op_code_, Slot(depth - 2),
+                                Slot(depth - 1), count);
+                    depth--;
+                    break;
+                case FusedEWInstruction::Type::Store:
+                    std::copy(Slot(depth - 1), Slot(depth - 1) + count,
+                              Register(instruction.register_idx_));
+                    break;
+                case FusedEWInstruction::Type::Load:
+                    std::copy(Register(instruction.register_idx_),
+                              Register(instruction.register_idx_) + count,
+                              Slot(depth));
+                    depth++;
+                    break;
+            }
+        }
+        return Slot(0);
+    }
+
+private:
+    enum class InputLayout { Contiguous, Scalar, Strided };
+
+    scalar_t* Slot(int64_t depth) {
+        return stack_.data() + depth * kFusedBlockSize;
+    }
+
+    /// Registers are stored after the stack.
+    scalar_t* Register(int64_t register_idx) {
+        return Slot(stack_depth_ + register_idx);
+    }
+
+    void LoadInput(int64_t input_idx,
+                   int64_t start,
+                   int64_t count,
+                   scalar_t* dst) {
+        const scalar_t* src = input_ptrs_[input_idx];
+        switch (input_layouts_[input_idx]) {
+            case InputLayout::Contiguous:
+                std::copy(src + start, src + start + count, dst);
+                break;
+            case InputLayout::Scalar:
+                std::fill(dst, dst + count, *src);
+                break;
+            case InputLayout::Strided:
+                for (int64_t k = 0; k < count; ++k) {
+                    dst[k] = *reinterpret_cast<const scalar_t*>(
+                            indexer_->GetInputPtr(input_idx, start + k));
+                }
+                break;
+        }
+    }
+
+    static void ApplyUnary(UnaryEWOpCode op_code, scalar_t* x, int64_t count) {
+        switch (op_code) {
+            case UnaryEWOpCode::Sqrt:
+                for (int64_t k = 0; k < count; ++k) {
+                    x[k] = static_cast<scalar_t>(std::sqrt(x[k]));
+                }
+                break;
+            case UnaryEWOpCode::Sin:
+                for (int64_t k = 0; k < count; ++k) {
+                    x[k] = static_cast<scalar_t>(std::sin(x[k]));
+                }
+                break;
+            case UnaryEWOpCode::Cos:
+                for (int64_t k = 0; k < count; ++k) {
+                    x[k] = static_cast<scalar_t>(std::cos(x[k]));
+                }
+                break;
+            case UnaryEWOpCode::Neg:
+                for (int64_t k = 0; k < count; ++k) {
+                    x[k] = static_cast<scalar_t>(-x[k]);
+                }
+                break;
+            case UnaryEWOpCode::Exp:
+                for (int64_t k = 0; k < count; ++k) {
+                    x[k] = static_cast<scalar_t>(std::exp(x[k]));
+                }
+                break;
+            case UnaryEWOpCode::Abs:
+                for (int64_t k = 0; k < count; ++k) {
+                    x[k] = static_cast<scalar_t>(
+                            std::abs(static_cast<double>(x[k])));
+                }
+                break;
+            case UnaryEWOpCode::Floor:
+                // Integer values are already whole.
+                if (std::is_integral<scalar_t>::value) {
+                    break;
+                }
+                for (int64_t k = 0; k < count; ++k) {
+                    x[k] = static_cast<scalar_t>(std::floor(x[k]));
+                }
+                break;
+            case UnaryEWOpCode::Log:
+                for (int64_t k = 0; k < count; ++k) {
+                    x[k] = static_cast<scalar_t>(std::log(x[k]));
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    static void ApplyBinary(BinaryEWOpCode op_code,
+                            scalar_t* lhs,
+                            const scalar_t* rhs,
+                            int64_t count) {
+        switch (op_code) {
+            case BinaryEWOpCode::Add:
+                for (int64_t k = 0; k < count; ++k) {
+                    lhs[k] = static_cast<scalar_t>(lhs[k] + rhs[k]);
+                }
+                break;
+            case BinaryEWOpCode::Sub:
+                for (int64_t k = 0; k < count; ++k) {
+                    lhs[k] = static_cast<scalar_t>(lhs[k] - rhs[k]);
+                }
+                break;
+            case BinaryEWOpCode::Mul:
+                for (int64_t k = 0; k < count; ++k) {
+                    lhs[k] = static_cast<scalar_t>(lhs[k] * rhs[k]);
+                }
+                break;
+            case BinaryEWOpCode::Div:
+                for (int64_t k = 0; k < count; ++k) {
+                    lhs[k] = static_cast<scalar_t>(lhs[k] / rhs[k]);
+                }
+                break;
+            case BinaryEWOpCode::Maximum:
+                for (int64_t k = 0; k < count; ++k) {
+                    lhs[k] = lhs[k] > rhs[k] ? lhs[k] : rhs[k];
+                }
+                break;
+            case BinaryEWOpCode::Minimum:
+                for (int64_t k = 0; k < count; ++k) {
+                    lhs[k] = lhs[k] < rhs[k] ? lhs[k] : rhs[k];
+                }
+                break;
+            case BinaryEWOpCode::Pow:
+                for (int64_t k = 0; k < count; ++k) {
+                    lhs[k] = static_cast<scalar_t>(
+                            std::pow(static_cast<double>(lhs[k]),
+                                     static_cast<double>(rhs[k])));
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    const FusedEWProgram& program_;
+    int64_t stack_depth_;
+    const Indexer* indexer_ = nullptr;
+    std::vector<InputLayout> input_layouts_;
+    std::vector<const scalar_t*> input_ptrs_;
+    std::vector<scalar_t> stack_;
+};
+
+template <typename scalar_t>
+static void CPUFusedEWKernel(const Indexer& indexer,
+                             const FusedEWProgram& program,
+                             int64_t stack_depth) {
+    int64_t num_workloads = indexer.NumWorkloads();
+    int64_t num_blocks =
+            (num_workloads + kFusedBlockSize - 1) / kFusedBlockSize;
+    bool dst_contiguous = indexer.IsOutputContiguous();
+    scalar_t* dst_ptr = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
+
+    parallel_util::ParallelFor(
+            0, num_blocks, kFusedGrainSize / kFusedBlockSize,
+            [&](int64_t block_begin, int64_t block_end) {
+                CPUFusedEWEvaluator<scalar_t> evaluator(program, stack_depth);
+                evaluator.SetIndexer(indexer);
+                for (int64_t block_idx = block_begin; block_idx < block_end;
+                     ++block_idx) {
+                    int64_t start = block_idx * kFusedBlockSize;
+                    int64_t count =
+                            std::min(kFusedBlockSize, num_workloads - start);
+                    const scalar_t* vals = evaluator.Run(start, count);
+                    if (dst_contiguous) {
+                        std::copy(vals, vals + count, dst_ptr + start);
+                    } else {
+                        for (int64_t k = 0; k < count; ++k) {
+                            *reinterpret_cast<scalar_t*>(
+                                    indexer.GetOutputPtr(start + k)) = vals[k];
+                        }
+                    }
+                }
+            });
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const FusedEWProgram& program,
+                Tensor& dst) {
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+    int64_t stack_depth =
+            FusedEWStackDepth(program, static_cast<int64_t>(inputs.size()));
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        CPUFusedEWKernel<scalar_t>(indexer, program, stack_depth);
+    });
+}
+
+/// \param indexer Element-wise Indexer whose master shape lists all
+/// non-reduction dimensions before all reduction dimensions, such that
+/// output element o reduces workloads [o * reduction_size,
+/// (o + 1) * reduction_size).
+/// \param dst_ptr Contiguous output of num_outputs elements, pre-filled with
+/// \p identity.
+template <typename scalar_t, typename func_t>
+static void CPUFusedEWReductionKernel(const Indexer& indexer,
+                                      const FusedEWProgram& program,
+                                      int64_t stack_depth,
+                                      int64_t num_outputs,
+                                      scalar_t* dst_ptr,
+                                      func_t reduce_func,
+                                      scalar_t identity) {
+    int64_t num_workloads = indexer.NumWorkloads();
+    if (num_outputs == 0 || num_workloads == 0) {
+        return;
+    }
+    int64_t reduction_size = num_workloads / num_outputs;
+
+    if (num_outputs < parallel_util::GetNumThreads() &&
+        num_workloads > kFusedGrainSize) {
+        // Few outputs, e.g. a full reduction. Split each output's workloads
+        // into chunks and combine the per-chunk partial results in order.
+        int64_t chunk_size =
+                parallel_util::GetChunkSize(reduction_size, kFusedGrainSize);
+        int64_t num_chunks = (reduction_size + chunk_size - 1) / chunk_size;
+        std::vector<scalar_t> chunk_results(num_outputs * num_chunks,
+                                            identity);
+        parallel_util::ParallelFor(
+                0, num_chunks, 1,
+                [&](int64_t chunk_begin, int64_t chunk_end) {
+                    CPUFusedEWEvaluator<scalar_t> evaluator(program,
+                                                            stack_depth);
+                    evaluator.SetIndexer(indexer);
+                    for (int64_t c = chunk_begin; c < chunk_end; ++c) {
+                        for (int64_t o = 0; o < num_outputs; ++o) {
+                            int64_t begin = o * reduction_size + c * chunk_size;
+                            int64_t end = o * reduction_size +
+                                          std::min((c + 1) * chunk_size,
+                                                   reduction_size);
+                            scalar_t acc = identity;
+                            for (int64_t start = begin; start < end;
+                                 start += kFusedBlockSize) {
+                                int64_t count = std::min(kFusedBlockSize,
+                                                         end - start);
+                                const scalar_t* vals =
+                                        evaluator.Run(start, count);
+                                for (int64_t k = 0; k < count; ++k) {
+                                    acc = reduce_func(vals[k], acc);
+                                }
+                            }
+                            chunk_results[o * num_chunks + c] = acc;
+                        }
+                    }
+                });
+        for (int64_t o = 0; o < num_outputs; ++o) {
+            for (int64_t c = 0; c < num_chunks; ++c) {
+                dst_ptr[o] = reduce_func(chunk_results[o * num_chunks + c],
+                                         dst_ptr[o]);
+            }
+        }
+        return;
+    }
+
+    // Split the outputs into chunks. Blocks may span several outputs, which
+    // keeps the blocks full when the reduction size is small.
+    parallel_util::ParallelFor(
+            0, num_outputs,
+            std::max<int64_t>(1, kFusedGrainSize / reduction_size),
+            [&](int64_t o, int64_t o_end) {
+                CPUFusedEWEvaluator<scalar_t> evaluator(program, stack_depth);
+                evaluator.SetIndexer(indexer);
+                int64_t end = o_end * reduction_size;
+                int64_t pos = 0;
+                scalar_t acc = identity;
+                for (int64_t start = o * reduction_size; start < end;
+                     start += kFusedBlockSize) {
+                    int64_t count = std::min(kFusedBlockSize, end - start);
+                    const scalar_t* vals = evaluator.Run(start, count);
+                    for (int64_t k = 0; k < count; ++k) {
+                        acc = reduce_func(vals[k], acc);
+                        if (++pos == reduction_size) {
+                            dst_ptr[o++] = acc;
+                            acc = identity;
+                            pos = 0;
+                        }
+                    }
+                }
+            });
+}
+
+void FusedEWReductionCPU(const std::vector<Tensor>& inputs,
+                         const FusedEWProgram& program,
+                         Tensor& dst,
+                         ReductionOpCode op_code) {
+    SizeVector broadcasted_shape = inputs[0].GetShape();
+    for (const Tensor& input : inputs) {
+        broadcasted_shape = shape_util::BroadcastedShape(broadcasted_shape,
+                                                         input.GetShape());
+    }
+    int64_t stack_depth =
+            FusedEWStackDepth(program, static_cast<int64_t>(inputs.size()));
+
+    // Iterate non-reduction dimensions before reduction dimensions, such that
+    // each output element reduces a contiguous range of workloads. dst has
+    // the keepdim shape, so its reduced dimensions are exactly the size-1
+    // dimensions that are broadcasted in the inputs.
+    int64_t ndims = static_cast<int64_t>(broadcasted_shape.size());
+    SizeVector permutation;
+    for (int64_t dim = 0; dim < ndims; ++dim) {
+        if (dst.GetShape()[dim] == broadcasted_shape[dim]) {
+            permutation.push_back(dim);
+        }
+    }
+    for (int64_t dim = 0; dim < ndims; ++dim) {
+        if (dst.GetShape()[dim] != broadcasted_shape[dim]) {
+            permutation.push_back(dim);
+        }
+    }
+    std::vector<Tensor> permuted_inputs;
+    for (const Tensor& input : inputs) {
+        permuted_inputs.push_back(
+                input.Expand(broadcasted_shape).Permute(permutation));
+    }
+
+    // The kernel writes outputs by their linear index.
+    Tensor dst_contiguous = dst.IsContiguous()
+                                    ? dst
+                                    : Tensor(dst.GetShape(), dst.GetDtype(),
+                                             dst.GetDevice());
+    int64_t num_outputs = dst.NumElements();
+
+    // The output of the Indexer is not used, but it must have the master
+    // shape.
+    Indexer indexer(
+            permuted_inputs,
+            dst_contiguous.Expand(broadcasted_shape).Permute(permutation),
+            DtypePolicy::ALL_SAME);
+
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        scalar_t identity;
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                identity = 0;
+                break;
+            case ReductionOpCode::Prod:
+                identity = 1;
+                break;
+            case ReductionOpCode::Min:
+                if (indexer.NumWorkloads() == 0) {
+                    utility::LogError("Zero-size Tensor does not suport Min.");
+                }
+                identity = std::numeric_limits<scalar_t>::max();
+                break;
+            case ReductionOpCode::Max:
+                if (indexer.NumWorkloads() == 0) {
+                    utility::LogError("Zero-size Tensor does not suport Max.");
+                }
+                identity = std::numeric_limits<scalar_t>::lowest();
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+        dst_contiguous.Fill(identity);
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst_contiguous.GetDataPtr());
+
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                CPUFusedEWReductionKernel<scalar_t>(
+                        indexer, program, stack_depth, num_outputs, dst_ptr,
+                        [](scalar_t a, scalar_t b) -> scalar_t {
+                            return a + b;
+                        },
+                        identity);
+                break;
+            case ReductionOpCode::Prod:
+                CPUFusedEWReductionKernel<scalar_t>(
+                        indexer, program, stack_depth, num_outputs, dst_ptr,
+                        [](scalar_t a, scalar_t b) -> scalar_t {
+                            return a * b;
+                        },
+                        identity);
+                break;
+            case ReductionOpCode::Min:
+                CPUFusedEWReductionKernel<scalar_t>(
+                        indexer, program, stack_depth, num_outputs, dst_ptr,
+                        [](scalar_t a, scalar_t b) -> scalar_t {
+                            return std::min(a, b);
+                        },
+                        identity);
+                break;
+            case ReductionOpCode::Max:
+                CPUFusedEWReductionKernel<scalar_t>(
+                        indexer, program, stack_depth, num_outputs, dst_ptr,
+                        [](scalar_t a, scalar_t b) -> scalar_t {
+                            return std::max(a, b);
+                        },
+                        identity);
+                break;
+            default:
+                break;
+        }
+    });
+
+    if (!dst.IsContiguous()) {
+        dst.AsRvalue() = dst_contiguous;
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
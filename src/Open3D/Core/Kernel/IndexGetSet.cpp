@@ -29,6 +29,7 @@
 #include "Open3D/Core/Dtype.h"
 #include "Open3D/Core/Kernel/UnaryEW.h"
 #include "Open3D/Core/MemoryManager.h"
+#include "Open3D/Core/Profiler.h"
 #include "Open3D/Core/SizeVector.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
@@ -41,6 +42,8 @@ void IndexGet(const Tensor& src,
               const std::vector<Tensor>& index_tensors,
               const SizeVector& indexed_shape,
               const SizeVector& indexed_strides) {
+    ProfilerScope scope("IndexGet", {src, dst});
+
     // index_tensors has been preprocessed to be on the same device as src,
     // however, dst may be in a different device.
     if (dst.GetDevice() != src.GetDevice()) {
@@ -67,6 +70,8 @@ void IndexSet(const Tensor& src,
               const std::vector<Tensor>& index_tensors,
               const SizeVector& indexed_shape,
               const SizeVector& indexed_strides) {
+    ProfilerScope scope("IndexSet", {src, dst});
+
     // index_tensors has been preprocessed to be on the same device as dst,
     // however, src may be in a deifferent device.
     if (dst.GetDevice() != src.GetDevice()) {
@@ -87,5 +92,69 @@ void IndexSet(const Tensor& src,
     }
 }
 
+/// Checks the arguments of the row kernels, where rows is the tensor indexed
+/// by index and values is the other one.
+static void AssertRowIndexingArgs(const Tensor& rows,
+                                  const Tensor& index,
+                                  const Tensor& values) {
+    if (index.GetDtype() != Dtype::Int64) {
+        utility::LogError(
+                "Index tensor must have Int64 dtype, but {} was used.",
+                DtypeUtil::ToString(index.GetDtype()));
+    }
+    if (rows.GetDtype() != values.GetDtype()) {
+        utility::LogError("Dtype mismatch: {} != {}.",
+                          DtypeUtil::ToString(rows.GetDtype()),
+                          DtypeUtil::ToString(values.GetDtype()));
+    }
+    if (rows.GetDevice() != index.GetDevice() ||
+        rows.GetDevice() != values.GetDevice()) {
+        utility::LogError("Device mismatch: {}, {} and {}.",
+                          rows.GetDevice().ToString(),
+                          index.GetDevice().ToString(),
+                          values.GetDevice().ToString());
+    }
+    if (rows.NumDims() == 0) {
+        utility::LogError("Cannot index rows of a 0-dim tensor.");
+    }
+    SizeVector values_shape(rows.GetShapeRef().begin() + 1,
+                            rows.GetShapeRef().end());
+    values_shape.insert(values_shape.begin(), index.NumElements());
+    if (values.GetShape() != values_shape) {
+        utility::LogError("Expected shape {}, but got {}.", values_shape,
+                          values.GetShape());
+    }
+}
+
+void IndexGetRows(const Tensor& src, const Tensor& index, Tensor& dst) {
+    ProfilerScope scope("IndexGetRows", {src, index, dst});
+    AssertRowIndexingArgs(src, index, dst);
+    if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexGetRowsCPU(src, index, dst);
+    } else {
+        utility::LogError("IndexGetRows: Unimplemented device");
+    }
+}
+
+void IndexSetRows(const Tensor& src, const Tensor& index, Tensor& dst) {
+    ProfilerScope scope("IndexSetRows", {src, index, dst});
+    AssertRowIndexingArgs(dst, index, src);
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexSetRowsCPU(src, index, dst);
+    } else {
+        utility::LogError("IndexSetRows: Unimplemented device");
+    }
+}
+
+void IndexAddRows(const Tensor& src, const Tensor& index, Tensor& dst) {
+    ProfilerScope scope("IndexAddRows", {src, index, dst});
+    AssertRowIndexingArgs(dst, index, src);
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexAddRowsCPU(src, index, dst);
+    } else {
+        utility::LogError("IndexAddRows: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace open3d
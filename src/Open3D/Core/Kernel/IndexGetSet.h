@@ -72,5 +72,27 @@ void IndexSetCUDA(const Tensor& src,
                   const SizeVector& indexed_strides);
 #endif
 
+/// Gathers rows along dimension 0, dst[i, ...] = src[index[i], ...], with
+/// one memcpy per row. index is an Int64 tensor whose elements are in
+/// [-src.shape[0], src.shape[0]), negative indices wrap around. dst has
+/// shape (index.NumElements(), src.shape[1:]) and must be contiguous, src
+/// must be contiguous except for dimension 0.
+void IndexGetRows(const Tensor& src, const Tensor& index, Tensor& dst);
+
+/// Scatters rows along dimension 0, dst[index[i], ...] = src[i, ...], see
+/// IndexGetRows. With duplicate indices, any of the rows may be written.
+void IndexSetRows(const Tensor& src, const Tensor& index, Tensor& dst);
+
+/// Scatter-add of rows along dimension 0, dst[index[i], ...] += src[i, ...],
+/// see IndexGetRows. Rows with the same index are accumulated in the order
+/// of i, so the result is deterministic.
+void IndexAddRows(const Tensor& src, const Tensor& index, Tensor& dst);
+
+void IndexGetRowsCPU(const Tensor& src, const Tensor& index, Tensor& dst);
+
+void IndexSetRowsCPU(const Tensor& src, const Tensor& index, Tensor& dst);
+
+void IndexAddRowsCPU(const Tensor& src, const Tensor& index, Tensor& dst);
+
 }  // namespace kernel
 }  // namespace open3d
@@ -26,9 +26,16 @@
 
 #include "Open3D/Core/Kernel/IndexGetSet.h"
 
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
 #include "Open3D/Core/AdvancedIndexing.h"
 #include "Open3D/Core/Dispatch.h"
 #include "Open3D/Core/Kernel/CPULauncher.h"
+#include "Open3D/Core/Kernel/Sort.h"
+#include "Open3D/Core/ParallelUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
 
@@ -68,5 +75,207 @@ void IndexSetCPU(const Tensor& src,
     });
 }
 
+/// Minimum number of bytes copied per task by the row kernels.
+static constexpr int64_t kRowGrainBytes = 1 << 16;
+
+/// Minimum number of indices processed per task.
+static constexpr int64_t kIndexGrainSize = 32768;
+
+static int64_t RowGrainSize(int64_t row_byte_size) {
+    return std::max<int64_t>(
+            kRowGrainBytes / std::max<int64_t>(row_byte_size, 1), 1);
+}
+
+/// Throws if any index is not in [-num_rows, num_rows).
+static void CheckRowIndices(const int64_t* index_ptr,
+                            int64_t num_indices,
+                            int64_t num_rows) {
+    int64_t num_invalid = parallel_util::ParallelReduce(
+            int64_t(0), num_indices, kIndexGrainSize, int64_t(0),
+            [&](int64_t begin, int64_t end, int64_t count) {
+                for (int64_t i = begin; i < end; ++i) {
+                    count += index_ptr[i] < -num_rows ||
+                             index_ptr[i] >= num_rows;
+                }
+                return count;
+            },
+            [](int64_t a, int64_t b) { return a + b; });
+    if (num_invalid > 0) {
+        utility::LogError("{} indices are out of range [{}, {}).",
+                          num_invalid, -num_rows, num_rows);
+    }
+}
+
+/// Copies num_rows rows of row_byte_size bytes from src_row_ptr(i) to
+/// dst_row_ptr(i) in parallel. A fixed kRowByteSize lets the compiler inline
+/// the memcpy for small rows such as 3D points, 0 uses row_byte_size.
+template <int64_t kRowByteSize, typename src_func_t, typename dst_func_t>
+static void CopyRows(int64_t row_byte_size,
+                     int64_t num_rows,
+                     src_func_t src_row_ptr,
+                     dst_func_t dst_row_ptr) {
+    parallel_util::ParallelFor(
+            0, num_rows, RowGrainSize(row_byte_size),
+            [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    std::memcpy(dst_row_ptr(i), src_row_ptr(i),
+                                kRowByteSize > 0 ? kRowByteSize
+                                                 : row_byte_size);
+                }
+            });
+}
+
+template <typename src_func_t, typename dst_func_t>
+static void DispatchCopyRows(int64_t row_byte_size,
+                             int64_t num_rows,
+                             src_func_t src_row_ptr,
+                             dst_func_t dst_row_ptr) {
+    switch (row_byte_size) {
+        case 4:
+            CopyRows<4>(row_byte_size, num_rows, src_row_ptr, dst_row_ptr);
+            break;
+        case 8:
+            CopyRows<8>(row_byte_size, num_rows, src_row_ptr, dst_row_ptr);
+            break;
+        case 12:
+            CopyRows<12>(row_byte_size, num_rows, src_row_ptr, dst_row_ptr);
+            break;
+        case 16:
+            CopyRows<16>(row_byte_size, num_rows, src_row_ptr, dst_row_ptr);
+            break;
+        case 24:
+            CopyRows<24>(row_byte_size, num_rows, src_row_ptr, dst_row_ptr);
+            break;
+        default:
+            CopyRows<0>(row_byte_size, num_rows, src_row_ptr, dst_row_ptr);
+            break;
+    }
+}
+
+/// Byte size and byte stride of the rows of t, which must be contiguous
+/// except for dimension 0.
+static std::pair<int64_t, int64_t> GetRowLayout(const Tensor& t) {
+    const SizeVector& shape = t.GetShapeRef();
+    SizeVector row_shape(shape.begin() + 1, shape.end());
+    const SizeVector& strides = t.GetStridesRef();
+    SizeVector row_strides(strides.begin() + 1, strides.end());
+    if (row_strides != Tensor::DefaultStrides(row_shape)) {
+        utility::LogError("Rows of the tensor must be contiguous.");
+    }
+    int64_t element_byte_size = DtypeUtil::ByteSize(t.GetDtype());
+    return std::make_pair(row_shape.NumElements() * element_byte_size,
+                          strides[0] * element_byte_size);
+}
+
+void IndexGetRowsCPU(const Tensor& src, const Tensor& index, Tensor& dst) {
+    Tensor index_contiguous = index.Contiguous();
+    const int64_t* index_ptr =
+            static_cast<const int64_t*>(index_contiguous.GetDataPtr());
+    const int64_t num_indices = index.NumElements();
+    const int64_t num_rows = src.GetShape()[0];
+    CheckRowIndices(index_ptr, num_indices, num_rows);
+
+    int64_t row_byte_size, src_row_stride;
+    std::tie(row_byte_size, src_row_stride) = GetRowLayout(src);
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    DispatchCopyRows(
+            row_byte_size, num_indices,
+            [&](int64_t i) {
+                int64_t row = index_ptr[i] + num_rows * (index_ptr[i] < 0);
+                return src_ptr + row * src_row_stride;
+            },
+            [&](int64_t i) { return dst_ptr + i * row_byte_size; });
+}
+
+void IndexSetRowsCPU(const Tensor& src, const Tensor& index, Tensor& dst) {
+    Tensor index_contiguous = index.Contiguous();
+    Tensor src_contiguous = src.Contiguous();
+    const int64_t* index_ptr =
+            static_cast<const int64_t*>(index_contiguous.GetDataPtr());
+    const int64_t num_indices = index.NumElements();
+    const int64_t num_rows = dst.GetShape()[0];
+    CheckRowIndices(index_ptr, num_indices, num_rows);
+
+    int64_t row_byte_size, dst_row_stride;
+    std::tie(row_byte_size, dst_row_stride) = GetRowLayout(dst);
+    const char* src_ptr =
+            static_cast<const char*>(src_contiguous.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    DispatchCopyRows(
+            row_byte_size, num_indices,
+            [&](int64_t i) { return src_ptr + i * row_byte_size; },
+            [&](int64_t i) {
+                int64_t row = index_ptr[i] + num_rows * (index_ptr[i] < 0);
+                return dst_ptr + row * dst_row_stride;
+            });
+}
+
+void IndexAddRowsCPU(const Tensor& src, const Tensor& index, Tensor& dst) {
+    Tensor src_contiguous = src.Contiguous();
+    const int64_t num_indices = index.NumElements();
+    const int64_t num_rows = dst.GetShape()[0];
+    Tensor rows = index.Reshape({num_indices}).Contiguous();
+    const int64_t* index_ptr = static_cast<const int64_t*>(rows.GetDataPtr());
+    CheckRowIndices(index_ptr, num_indices, num_rows);
+
+    int64_t row_byte_size, dst_row_stride;
+    std::tie(row_byte_size, dst_row_stride) = GetRowLayout(dst);
+    const int64_t element_byte_size = DtypeUtil::ByteSize(dst.GetDtype());
+    const int64_t row_size = row_byte_size / element_byte_size;
+    const int64_t dst_row_step = dst_row_stride / element_byte_size;
+
+    // Sort the rows by index, so that each destination row is accumulated
+    // by a single task without atomics, in the order of the source rows.
+    Tensor wrapped_rows = Tensor::Empty({num_indices}, Dtype::Int64,
+                                        dst.GetDevice());
+    int64_t* wrapped_ptr = static_cast<int64_t*>(wrapped_rows.GetDataPtr());
+    parallel_util::ParallelFor(
+            0, num_indices, kIndexGrainSize, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    wrapped_ptr[i] =
+                            index_ptr[i] + num_rows * (index_ptr[i] < 0);
+                }
+            });
+    Tensor sorted_rows(wrapped_rows.GetShape(), Dtype::Int64,
+                       dst.GetDevice());
+    Tensor order(wrapped_rows.GetShape(), Dtype::Int64, dst.GetDevice());
+    Sort(wrapped_rows, sorted_rows, order, 0, false);
+    const int64_t* sorted_ptr =
+            static_cast<const int64_t*>(sorted_rows.GetDataPtr());
+    const int64_t* order_ptr = static_cast<const int64_t*>(order.GetDataPtr());
+
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+        int64_t grain_size = std::max<int64_t>(
+                kIndexGrainSize / std::max<int64_t>(row_size, 1), 1);
+        parallel_util::ParallelFor(
+                0, num_indices, grain_size, [&](int64_t begin, int64_t end) {
+                    // Groups of equal rows that started in the previous range
+                    // belong to that range, groups that start in this range
+                    // are completed past its end.
+                    int64_t i = begin;
+                    while (i > 0 && i < end &&
+                           sorted_ptr[i] == sorted_ptr[i - 1]) {
+                        ++i;
+                    }
+                    while (i < end) {
+                        const int64_t row = sorted_ptr[i];
+                        scalar_t* dst_row_ptr = dst_ptr + row * dst_row_step;
+                        do {
+                            const scalar_t* src_row_ptr =
+                                    src_ptr + order_ptr[i] * row_size;
+                            for (int64_t k = 0; k < row_size; ++k) {
+                                dst_row_ptr[k] += src_row_ptr[k];
+                            }
+                            ++i;
+                        } while (i < num_indices && sorted_ptr[i] == row);
+                    }
+                });
+    });
+}
+
 }  // namespace kernel
 }  // namespace open3d
@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Linalg.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+static void AssertSameDevice(const std::vector<Tensor>& tensors) {
+    for (const Tensor& tensor : tensors) {
+        if (tensor.GetDevice() != tensors[0].GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              tensor.GetDevice().ToString(),
+                              tensors[0].GetDevice().ToString());
+        }
+    }
+}
+
+static void AssertFloatDtype(const Tensor& tensor) {
+    Dtype dtype = tensor.GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError("Only supports Float32 and Float64, but {} is used.",
+                          DtypeUtil::ToString(dtype));
+    }
+}
+
+static void AssertSquareMatrices(const Tensor& tensor) {
+    const SizeVector& shape = tensor.GetShapeRef();
+    int64_t ndims = tensor.NumDims();
+    if (ndims < 2 || shape[ndims - 1] != shape[ndims - 2]) {
+        utility::LogError(
+                "Expected a tensor of square matrices (..., n, n), but got "
+                "shape {}.",
+                shape);
+    }
+}
+
+static void AssertShape(const Tensor& tensor, const SizeVector& shape) {
+    if (tensor.GetShape() != shape) {
+        utility::LogError("Expected output shape {} but got {}.", shape,
+                          tensor.GetShape());
+    }
+}
+
+static void AssertSameDtype(const Tensor& lhs, const Tensor& rhs) {
+    if (lhs.GetDtype() != rhs.GetDtype()) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          DtypeUtil::ToString(lhs.GetDtype()),
+                          DtypeUtil::ToString(rhs.GetDtype()));
+    }
+}
+
+void Matmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    AssertSameDevice({lhs, rhs, dst});
+    AssertSameDtype(lhs, rhs);
+    AssertSameDtype(lhs, dst);
+    if (lhs.NumDims() < 2 || rhs.NumDims() < 2) {
+        utility::LogError(
+                "Matmul expects tensors with at least 2 dimensions, but got "
+                "shapes {} and {}.",
+                lhs.GetShape(), rhs.GetShape());
+    }
+    SizeVector lhs_shape = lhs.GetShape();
+    SizeVector rhs_shape = rhs.GetShape();
+    int64_t m = lhs_shape[lhs_shape.size() - 2];
+    int64_t k = lhs_shape[lhs_shape.size() - 1];
+    int64_t n = rhs_shape[rhs_shape.size() - 1];
+    if (rhs_shape[rhs_shape.size() - 2] != k) {
+        utility::LogError("Matmul shape mismatch {} x {}.", lhs_shape,
+                          rhs_shape);
+    }
+    SizeVector dst_shape = shape_util::BroadcastedShape(
+            SizeVector(lhs_shape.begin(), lhs_shape.end() - 2),
+            SizeVector(rhs_shape.begin(), rhs_shape.end() - 2));
+    dst_shape.push_back(m);
+    dst_shape.push_back(n);
+    AssertShape(dst, dst_shape);
+
+    Device::DeviceType device_type = lhs.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MatmulCPU(lhs, rhs, dst);
+    } else {
+        utility::LogError("Matmul: Unimplemented device");
+    }
+}
+
+void Inverse(const Tensor& src, Tensor& dst) {
+    AssertSameDevice({src, dst});
+    AssertFloatDtype(src);
+    AssertSameDtype(src, dst);
+    AssertSquareMatrices(src);
+    AssertShape(dst, src.GetShape());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        InverseCPU(src, dst);
+    } else {
+        utility::LogError("Inverse: Unimplemented device");
+    }
+}
+
+void Solve(const Tensor& A, const Tensor& B, Tensor& X) {
+    AssertSameDevice({A, B, X});
+    AssertFloatDtype(A);
+    AssertSameDtype(A, B);
+    AssertSameDtype(A, X);
+    AssertSquareMatrices(A);
+    const SizeVector& a_shape = A.GetShapeRef();
+    const SizeVector& b_shape = B.GetShapeRef();
+    if (b_shape.size() != a_shape.size() ||
+        !std::equal(a_shape.begin(), a_shape.end() - 1, b_shape.begin())) {
+        utility::LogError(
+                "Solve expects B of shape (..., n, k) matching A of shape "
+                "(..., n, n), but got A {} and B {}.",
+                a_shape, b_shape);
+    }
+    AssertShape(X, b_shape);
+
+    Device::DeviceType device_type = A.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SolveCPU(A, B, X);
+    } else {
+        utility::LogError("Solve: Unimplemented device");
+    }
+}
+
+void SymmetricEigen(const Tensor& src,
+                    Tensor& eigenvalues,
+                    Tensor& eigenvectors) {
+    AssertSameDevice({src, eigenvalues, eigenvectors});
+    AssertFloatDtype(src);
+    AssertSameDtype(src, eigenvalues);
+    AssertSameDtype(src, eigenvectors);
+    AssertSquareMatrices(src);
+    SizeVector eigenvalues_shape = src.GetShape();
+    eigenvalues_shape.pop_back();
+    AssertShape(eigenvalues, eigenvalues_shape);
+    AssertShape(eigenvectors, src.GetShape());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SymmetricEigenCPU(src, eigenvalues, eigenvectors);
+    } else {
+        utility::LogError("SymmetricEigen: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Matrix multiplication of the last two dimensions, the leading (batch)
+/// dimensions are broadcasted. lhs: (..., M, K), rhs: (..., K, N),
+/// dst: (..., M, N).
+void Matmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst);
+
+/// Inverse of each square matrix of src: (..., n, n).
+void Inverse(const Tensor& src, Tensor& dst);
+
+/// Solves A X = B for each square matrix of A: (..., n, n), with
+/// B, X: (..., n, k).
+void Solve(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Eigendecomposition of each symmetric matrix of src: (..., n, n). Only the
+/// lower triangle of src is read. eigenvalues: (..., n) in ascending order,
+/// eigenvectors: (..., n, n) with the i-th eigenvector in the i-th column.
+void SymmetricEigen(const Tensor& src,
+                    Tensor& eigenvalues,
+                    Tensor& eigenvectors);
+
+void MatmulCPU(const Tensor& lhs, const Tensor& rhs, Tensor& dst);
+
+void InverseCPU(const Tensor& src, Tensor& dst);
+
+void SolveCPU(const Tensor& A, const Tensor& B, Tensor& X);
+
+void SymmetricEigenCPU(const Tensor& src,
+                       Tensor& eigenvalues,
+                       Tensor& eigenvectors);
+
+}  // namespace kernel
+}  // namespace open3d
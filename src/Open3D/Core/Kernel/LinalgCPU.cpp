@@ -0,0 +1,371 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Linalg.h"
+
+#include <Eigen/Core>
+#include <Eigen/Eigenvalues>
+#include <Eigen/LU>
+#include <algorithm>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/ParallelUtil.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Block sizes of the GEMM kernel, in number of elements. A kGemmBlockK x
+/// kGemmBlockN panel of rhs is reused by kGemmBlockM rows of lhs while it is
+/// hot in cache.
+static constexpr int64_t kGemmBlockM = 64;
+static constexpr int64_t kGemmBlockK = 128;
+static constexpr int64_t kGemmBlockN = 256;
+
+/// Minimum number of multiply-adds to justify launching a parallel region.
+static constexpr int64_t kGemmParallelThreshold = 1 << 16;
+
+/// Minimum number of multiply-adds per parallel chunk of a batch.
+static constexpr int64_t kBatchGrainSize = 1 << 15;
+
+/// Returns the number of matrices per parallel chunk of a batch, for
+/// matrices taking \p num_ops multiply-adds each.
+static int64_t BatchGrainSize(int64_t num_ops) {
+    return std::max<int64_t>(1,
+                             kBatchGrainSize / std::max<int64_t>(num_ops, 1));
+}
+
+/// Calls \p func(i) for every i in [0, n) on the parallel_util thread pool,
+/// in chunks of at least \p grain_size.
+template <typename func_t>
+static void ParallelForEach(int64_t n, int64_t grain_size, const func_t& func) {
+    parallel_util::ParallelFor(0, n, grain_size,
+                               [&](int64_t begin, int64_t end) {
+                                   for (int64_t i = begin; i < end; ++i) {
+                                       func(i);
+                                   }
+                               });
+}
+
+/// C = A * B for row-major contiguous A (m x k), B (k x n) and C (m x n).
+///
+/// Cache-blocked on all three dimensions. The innermost loop runs along
+/// contiguous rows of B and C, which the compiler vectorizes.
+template <typename scalar_t>
+static void GemmCPU(int64_t m,
+                    int64_t n,
+                    int64_t k,
+                    const scalar_t* A,
+                    const scalar_t* B,
+                    scalar_t* C,
+                    bool parallel) {
+    std::fill(C, C + m * n, static_cast<scalar_t>(0));
+    int64_t num_row_blocks = (m + kGemmBlockM - 1) / kGemmBlockM;
+    parallel = parallel && num_row_blocks > 1 &&
+               m * n * k > kGemmParallelThreshold;
+    const int64_t grain_size = parallel ? 1 : num_row_blocks;
+    ParallelForEach(num_row_blocks, grain_size, [&](int64_t row_block) {
+        int64_t i_begin = row_block * kGemmBlockM;
+        int64_t i_end = std::min(i_begin + kGemmBlockM, m);
+        for (int64_t k_begin = 0; k_begin < k; k_begin += kGemmBlockK) {
+            int64_t k_end = std::min(k_begin + kGemmBlockK, k);
+            for (int64_t j_begin = 0; j_begin < n; j_begin += kGemmBlockN) {
+                int64_t j_end = std::min(j_begin + kGemmBlockN, n);
+                for (int64_t i = i_begin; i < i_end; ++i) {
+                    const scalar_t* a_row = A + i * k;
+                    scalar_t* c_row = C + i * n;
+                    for (int64_t kk = k_begin; kk < k_end; ++kk) {
+                        const scalar_t a = a_row[kk];
+                        const scalar_t* b_row = B + kk * n;
+                        for (int64_t j = j_begin; j < j_end; ++j) {
+                            c_row[j] += a * b_row[j];
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+template <typename scalar_t, int N>
+using RowMajorMatrix = Eigen::Matrix<scalar_t, N, N, Eigen::RowMajor>;
+
+/// Multiplies batch_size pairs of N x N matrices with fixed-size Eigen
+/// kernels, which are fully unrolled for small N.
+template <typename scalar_t, int N>
+static void BatchedFixedSizeMatmulCPU(int64_t batch_size,
+                                      const scalar_t* A,
+                                      const scalar_t* B,
+                                      scalar_t* C) {
+    typedef RowMajorMatrix<scalar_t, N> Matrix;
+    const int64_t grain_size = BatchGrainSize(N * N * N);
+    ParallelForEach(batch_size, grain_size, [&](int64_t b) {
+        Eigen::Map<Matrix>(C + b * N * N).noalias() =
+                Eigen::Map<const Matrix>(A + b * N * N) *
+                Eigen::Map<const Matrix>(B + b * N * N);
+    });
+}
+
+template <typename scalar_t>
+static void BatchedMatmulCPU(int64_t batch_size,
+                             int64_t m,
+                             int64_t n,
+                             int64_t k,
+                             const scalar_t* A,
+                             const scalar_t* B,
+                             scalar_t* C) {
+    if (m == n && n == k) {
+        switch (n) {
+            case 3:
+                BatchedFixedSizeMatmulCPU<scalar_t, 3>(batch_size, A, B, C);
+                return;
+            case 4:
+                BatchedFixedSizeMatmulCPU<scalar_t, 4>(batch_size, A, B, C);
+                return;
+            case 6:
+                BatchedFixedSizeMatmulCPU<scalar_t, 6>(batch_size, A, B, C);
+                return;
+            default:
+                break;
+        }
+    }
+
+    // Parallelize over the batch if it is large enough to occupy all threads,
+    // otherwise within each GEMM.
+    bool parallel_batch = batch_size >= parallel_util::GetMaxThreads();
+    const int64_t grain_size =
+            parallel_batch ? BatchGrainSize(m * n * k) : batch_size;
+    ParallelForEach(batch_size, grain_size, [&](int64_t b) {
+        GemmCPU<scalar_t>(m, n, k, A + b * m * k, B + b * k * n, C + b * m * n,
+                          !parallel_batch);
+    });
+}
+
+/// Inverts batch_size n x n matrices. N is either n or Eigen::Dynamic.
+template <typename scalar_t, int N>
+static void BatchedInverseCPU(int64_t batch_size,
+                              int64_t n,
+                              const scalar_t* src,
+                              scalar_t* dst) {
+    typedef RowMajorMatrix<scalar_t, N> Matrix;
+    const int64_t grain_size = BatchGrainSize(n * n * n);
+    ParallelForEach(batch_size, grain_size, [&](int64_t b) {
+        Eigen::Map<Matrix>(dst + b * n * n, n, n) =
+                Eigen::Map<const Matrix>(src + b * n * n, n, n).inverse();
+    });
+}
+
+/// Solves batch_size systems A X = B with partial-pivoting LU. N is either
+/// n or Eigen::Dynamic.
+template <typename scalar_t, int N>
+static void BatchedSolveCPU(int64_t batch_size,
+                            int64_t n,
+                            int64_t k,
+                            const scalar_t* A,
+                            const scalar_t* B,
+                            scalar_t* X) {
+    typedef RowMajorMatrix<scalar_t, N> Matrix;
+    typedef Eigen::Matrix<scalar_t, N, Eigen::Dynamic, Eigen::RowMajor> RHS;
+    const int64_t grain_size = BatchGrainSize(n * n * (n + k));
+    ParallelForEach(batch_size, grain_size, [&](int64_t b) {
+        Eigen::Map<RHS>(X + b * n * k, n, k) =
+                Eigen::Map<const Matrix>(A + b * n * n, n, n)
+                        .partialPivLu()
+                        .solve(Eigen::Map<const RHS>(B + b * n * k, n, k));
+    });
+}
+
+/// Eigendecomposition of batch_size symmetric n x n matrices. N is either n
+/// or Eigen::Dynamic.
+template <typename scalar_t, int N>
+static void BatchedSymmetricEigenCPU(int64_t batch_size,
+                                     int64_t n,
+                                     const scalar_t* src,
+                                     scalar_t* eigenvalues,
+                                     scalar_t* eigenvectors) {
+    typedef RowMajorMatrix<scalar_t, N> Matrix;
+    typedef Eigen::Matrix<scalar_t, N, 1> Vector;
+    const int64_t grain_size = BatchGrainSize(n * n * n);
+    ParallelForEach(batch_size, grain_size, [&](int64_t b) {
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix<scalar_t, N, N>> solver(
+                Eigen::Map<const Matrix>(src + b * n * n, n, n));
+        Eigen::Map<Vector>(eigenvalues + b * n, n) = solver.eigenvalues();
+        Eigen::Map<Matrix>(eigenvectors + b * n * n, n, n) =
+                solver.eigenvectors();
+    });
+}
+
+/// Calls func.template operator()<N>() with N = n for the specialized small
+/// sizes 3, 4 and 6, and N = Eigen::Dynamic otherwise.
+#define DISPATCH_SMALL_MATRIX_SIZE(n, ...)                         \
+    [&] {                                                          \
+        switch (n) {                                               \
+            case 3: {                                              \
+                static constexpr int kMatrixSize = 3;              \
+                return __VA_ARGS__();                              \
+            }                                                      \
+            case 4: {                                              \
+                static constexpr int kMatrixSize = 4;              \
+                return __VA_ARGS__();                              \
+            }                                                      \
+            case 6: {                                              \
+                static constexpr int kMatrixSize = 6;              \
+                return __VA_ARGS__();                              \
+            }                                                      \
+            default: {                                             \
+                static constexpr int kMatrixSize = Eigen::Dynamic; \
+                return __VA_ARGS__();                              \
+            }                                                      \
+        }                                                          \
+    }()
+
+/// Returns \p tensor if it is contiguous, otherwise a new contiguous tensor
+/// of the same shape to compute into. Use CopyBackIfNotContiguous afterwards.
+static Tensor ContiguousOutput(const Tensor& tensor) {
+    return tensor.IsContiguous() ? tensor
+                                 : Tensor(tensor.GetShape(), tensor.GetDtype(),
+                                          tensor.GetDevice());
+}
+
+static void CopyBackIfNotContiguous(const Tensor& result, Tensor& dst) {
+    if (!dst.IsContiguous()) {
+        dst.AsRvalue() = result;
+    }
+}
+
+/// Number of matrices in a (..., n, n) or (..., m, n) tensor.
+static int64_t NumMatrices(const SizeVector& shape) {
+    return SizeVector(shape.begin(), shape.end() - 2).NumElements();
+}
+
+void MatmulCPU(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    SizeVector dst_shape = dst.GetShape();
+    SizeVector batch_shape(dst_shape.begin(), dst_shape.end() - 2);
+    int64_t batch_size = batch_shape.NumElements();
+    int64_t m = dst_shape[dst_shape.size() - 2];
+    int64_t n = dst_shape[dst_shape.size() - 1];
+    int64_t k = lhs.GetShape()[lhs.NumDims() - 1];
+
+    SizeVector lhs_shape = batch_shape;
+    lhs_shape.push_back(m);
+    lhs_shape.push_back(k);
+    Tensor lhs_contiguous = lhs.Expand(lhs_shape).Contiguous();
+    Tensor dst_contiguous = ContiguousOutput(dst);
+
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        const scalar_t* lhs_ptr =
+                static_cast<const scalar_t*>(lhs_contiguous.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst_contiguous.GetDataPtr());
+        if (rhs.NumDims() == 2) {
+            // All batches share the same rhs, e.g. transforming a batch of
+            // points. This is a single (batch_size * m) x k GEMM.
+            Tensor rhs_contiguous = rhs.Contiguous();
+            GemmCPU<scalar_t>(
+                    batch_size * m, n, k, lhs_ptr,
+                    static_cast<const scalar_t*>(rhs_contiguous.GetDataPtr()),
+                    dst_ptr, true);
+        } else {
+            SizeVector rhs_shape = batch_shape;
+            rhs_shape.push_back(k);
+            rhs_shape.push_back(n);
+            Tensor rhs_contiguous = rhs.Expand(rhs_shape).Contiguous();
+            BatchedMatmulCPU<scalar_t>(
+                    batch_size, m, n, k, lhs_ptr,
+                    static_cast<const scalar_t*>(rhs_contiguous.GetDataPtr()),
+                    dst_ptr);
+        }
+    });
+
+    CopyBackIfNotContiguous(dst_contiguous, dst);
+}
+
+void InverseCPU(const Tensor& src, Tensor& dst) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor dst_contiguous = ContiguousOutput(dst);
+    int64_t n = src.GetShape().back();
+    int64_t batch_size = NumMatrices(src.GetShape());
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        DISPATCH_SMALL_MATRIX_SIZE(n, [&]() {
+            BatchedInverseCPU<scalar_t, kMatrixSize>(
+                    batch_size, n,
+                    static_cast<const scalar_t*>(src_contiguous.GetDataPtr()),
+                    static_cast<scalar_t*>(dst_contiguous.GetDataPtr()));
+        });
+    });
+
+    CopyBackIfNotContiguous(dst_contiguous, dst);
+}
+
+void SolveCPU(const Tensor& A, const Tensor& B, Tensor& X) {
+    Tensor A_contiguous = A.Contiguous();
+    Tensor B_contiguous = B.Contiguous();
+    Tensor X_contiguous = ContiguousOutput(X);
+    int64_t n = A.GetShape().back();
+    int64_t k = B.GetShape().back();
+    int64_t batch_size = NumMatrices(A.GetShape());
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        DISPATCH_SMALL_MATRIX_SIZE(n, [&]() {
+            BatchedSolveCPU<scalar_t, kMatrixSize>(
+                    batch_size, n, k,
+                    static_cast<const scalar_t*>(A_contiguous.GetDataPtr()),
+                    static_cast<const scalar_t*>(B_contiguous.GetDataPtr()),
+                    static_cast<scalar_t*>(X_contiguous.GetDataPtr()));
+        });
+    });
+
+    CopyBackIfNotContiguous(X_contiguous, X);
+}
+
+void SymmetricEigenCPU(const Tensor& src,
+                       Tensor& eigenvalues,
+                       Tensor& eigenvectors) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor eigenvalues_contiguous = ContiguousOutput(eigenvalues);
+    Tensor eigenvectors_contiguous = ContiguousOutput(eigenvectors);
+    int64_t n = src.GetShape().back();
+    int64_t batch_size = NumMatrices(src.GetShape());
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        DISPATCH_SMALL_MATRIX_SIZE(n, [&]() {
+            BatchedSymmetricEigenCPU<scalar_t, kMatrixSize>(
+                    batch_size, n,
+                    static_cast<const scalar_t*>(src_contiguous.GetDataPtr()),
+                    static_cast<scalar_t*>(eigenvalues_contiguous.GetDataPtr()),
+                    static_cast<scalar_t*>(
+                            eigenvectors_contiguous.GetDataPtr()));
+        });
+    });
+
+    CopyBackIfNotContiguous(eigenvalues_contiguous, eigenvalues);
+    CopyBackIfNotContiguous(eigenvectors_contiguous, eigenvectors);
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include "Open3D/Core/Kernel/NonZero.h"
 
+#include <algorithm>
+
 #include "Open3D/Core/Device.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
@@ -48,5 +50,34 @@ Tensor NonZero(const Tensor& src) {
     }
 }
 
+Tensor MaskedSelect(const Tensor& src, const Tensor& mask) {
+    if (mask.GetDtype() != Dtype::Bool) {
+        utility::LogError("Mask must be Bool, but got {}.",
+                          DtypeUtil::ToString(mask.GetDtype()));
+    }
+    if (src.GetDevice() != mask.GetDevice()) {
+        utility::LogError("Device mismatch: src {}, mask {}.",
+                          src.GetDevice().ToString(),
+                          mask.GetDevice().ToString());
+    }
+    const SizeVector& shape = src.GetShapeRef();
+    if (mask.NumDims() == 0 || mask.NumDims() > src.NumDims() ||
+        !std::equal(mask.GetShapeRef().begin(), mask.GetShapeRef().end(),
+                    shape.begin())) {
+        utility::LogError(
+                "Mask shape {} must match the leading dimensions of {}.",
+                mask.GetShape(), src.GetShape());
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return MaskedSelectCPU(src, mask);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        return src.IndexGet(mask.NonZeroNumpy());
+    } else {
+        utility::LogError("MaskedSelect: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace open3d
@@ -34,8 +34,15 @@ namespace kernel {
 
 Tensor NonZero(const Tensor& src);
 
+/// Returns the rows of src selected by the Bool mask, whose shape must equal
+/// the leading dimensions of src, as a tensor of shape
+/// (num_selected, src.shape[mask.ndim:]).
+Tensor MaskedSelect(const Tensor& src, const Tensor& mask);
+
 Tensor NonZeroCPU(const Tensor& src);
 
+Tensor MaskedSelectCPU(const Tensor& src, const Tensor& mask);
+
 #ifdef BUILD_CUDA_MODULE
 Tensor NonZeroCUDA(const Tensor& src);
 #endif
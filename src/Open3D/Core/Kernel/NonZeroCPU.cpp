@@ -26,53 +26,142 @@
 
 #include "Open3D/Core/Kernel/NonZero.h"
 
-#include "Open3D/Core/Indexer.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/ParallelUtil.h"
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
 namespace kernel {
 
+/// Minimum number of elements (or mask rows) processed per task.
+static constexpr int64_t kNonZeroGrainSize = 32768;
+
+/// Splits [0, n) into chunks of chunk_size and counts the selected elements
+/// of each chunk in parallel with count_func(begin, end). Returns the
+/// exclusive prefix sum of the counts, i.e. the output offset of each chunk,
+/// followed by the total count.
+template <typename func_t>
+static std::vector<int64_t> CountChunks(int64_t n,
+                                        int64_t chunk_size,
+                                        func_t count_func) {
+    const int64_t num_chunks = (n + chunk_size - 1) / chunk_size;
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
+    parallel_util::ParallelForChunks(num_chunks, [&](int64_t chunk_idx) {
+        int64_t begin = chunk_idx * chunk_size;
+        offsets[chunk_idx + 1] =
+                count_func(begin, std::min(begin + chunk_size, n));
+    });
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        offsets[chunk_idx + 1] += offsets[chunk_idx];
+    }
+    return offsets;
+}
+
 Tensor NonZeroCPU(const Tensor& src) {
-    // Get flattened non-zero indices.
-    TensorIterator src_iter(src);
+    Tensor src_contiguous = src.Contiguous();
+    const SizeVector& shape = src.GetShapeRef();
     const int64_t num_elements = src.NumElements();
-    std::vector<int64_t> indices(static_cast<size_t>(num_elements));
-    std::iota(std::begin(indices), std::end(indices), 0);
-    std::vector<int64_t> non_zero_indices(num_elements);
+    const int64_t num_dims = src.NumDims();
+    const int64_t chunk_size =
+            parallel_util::GetChunkSize(num_elements, kNonZeroGrainSize);
+
+    Tensor result;
     DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
-        auto it = std::copy_if(
-                indices.begin(), indices.end(), non_zero_indices.begin(),
-                [&src_iter](int64_t index) {
-                    return static_cast<float>(*static_cast<scalar_t*>(
-                                   src_iter.GetPtr(index))) != 0;
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        std::vector<int64_t> offsets = CountChunks(
+                num_elements, chunk_size, [&](int64_t begin, int64_t end) {
+                    int64_t count = 0;
+                    for (int64_t i = begin; i < end; ++i) {
+                        count += src_ptr[i] != scalar_t(0);
+                    }
+                    return count;
                 });
-        non_zero_indices.resize(std::distance(non_zero_indices.begin(), it));
-    });
 
-    // Transform flattend indices to indices in each dimension.
-    SizeVector shape = src.GetShape();
-    const int64_t num_dims = src.NumDims();
-    const size_t num_non_zeros = non_zero_indices.size();
+        const int64_t num_non_zeros = offsets.back();
+        result = Tensor({num_dims, num_non_zeros}, Dtype::Int64,
+                        src.GetDevice());
+        int64_t* result_ptr = static_cast<int64_t*>(result.GetDataPtr());
+        parallel_util::ParallelForChunks(
+                offsets.size() - 1, [&](int64_t chunk_idx) {
+                    int64_t begin = chunk_idx * chunk_size;
+                    int64_t end = std::min(begin + chunk_size, num_elements);
+                    int64_t offset = offsets[chunk_idx];
+                    // Coordinates of the current element, incremented like
+                    // an odometer instead of divided out per element.
+                    std::vector<int64_t> coords(num_dims);
+                    for (int64_t dim = num_dims - 1, rest = begin; dim >= 0;
+                         --dim) {
+                        coords[dim] = rest % shape[dim];
+                        rest /= shape[dim];
+                    }
+                    for (int64_t i = begin; i < end; ++i) {
+                        if (src_ptr[i] != scalar_t(0)) {
+                            for (int64_t dim = 0; dim < num_dims; ++dim) {
+                                result_ptr[dim * num_non_zeros + offset] =
+                                        coords[dim];
+                            }
+                            offset++;
+                        }
+                        for (int64_t dim = num_dims - 1; dim >= 0; --dim) {
+                            if (++coords[dim] < shape[dim]) {
+                                break;
+                            }
+                            coords[dim] = 0;
+                        }
+                    }
+                });
+    });
+    return result;
+}
 
-    SizeVector result_shape{num_dims, static_cast<int64_t>(num_non_zeros)};
-    Tensor result(result_shape, Dtype::Int64, src.GetDevice());
-    TensorIterator result_iter(result);
+Tensor MaskedSelectCPU(const Tensor& src, const Tensor& mask) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor mask_contiguous = mask.Contiguous();
+    const SizeVector& shape = src.GetShapeRef();
+    const int64_t num_rows = mask.NumElements();
+    SizeVector row_shape(shape.begin() + mask.NumDims(), shape.end());
+    const int64_t row_byte_size =
+            row_shape.NumElements() * DtypeUtil::ByteSize(src.GetDtype());
+    const int64_t chunk_size =
+            parallel_util::GetChunkSize(num_rows, kNonZeroGrainSize);
 
-    std::vector<std::vector<int64_t>> non_zero_indices_by_dimensions(
-            num_dims, std::vector<int64_t>(num_non_zeros, 0));
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int64_t i = 0; i < static_cast<int64_t>(num_non_zeros); i++) {
-        int64_t non_zero_index = non_zero_indices[i];
-        for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
-            *static_cast<int64_t*>(result_iter.GetPtr(
-                    dim * num_non_zeros + i)) = non_zero_index % shape[dim];
-            non_zero_index = non_zero_index / shape[dim];
-        }
-    }
+    const bool* mask_ptr =
+            static_cast<const bool*>(mask_contiguous.GetDataPtr());
+    std::vector<int64_t> offsets = CountChunks(
+            num_rows, chunk_size, [&](int64_t begin, int64_t end) {
+                int64_t count = 0;
+                for (int64_t i = begin; i < end; ++i) {
+                    count += mask_ptr[i];
+                }
+                return count;
+            });
 
-    return result;
+    SizeVector dst_shape = row_shape;
+    dst_shape.insert(dst_shape.begin(), offsets.back());
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    const char* src_ptr =
+            static_cast<const char*>(src_contiguous.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    parallel_util::ParallelForChunks(
+            offsets.size() - 1, [&](int64_t chunk_idx) {
+                int64_t begin = chunk_idx * chunk_size;
+                int64_t end = std::min(begin + chunk_size, num_rows);
+                char* dst_row_ptr =
+                        dst_ptr + offsets[chunk_idx] * row_byte_size;
+                for (int64_t i = begin; i < end; ++i) {
+                    if (mask_ptr[i]) {
+                        std::memcpy(dst_row_ptr, src_ptr + i * row_byte_size,
+                                    row_byte_size);
+                        dst_row_ptr += row_byte_size;
+                    }
+                }
+            });
+    return dst;
 }
 
 }  // namespace kernel
@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "Open3D/Core/ParallelUtil.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Minimum number of elements per chunk of RadixSortPairs.
+static constexpr int64_t kRadixSortGrainSize = 32768;
+
+/// Stable LSD radix sort of (keys, values) pairs by keys, 8 bits per pass.
+/// Each pass computes per-chunk digit histograms, turns them into per-chunk
+/// output offsets, and scatters the chunks in parallel on the parallel_util
+/// thread pool. Passes in which all keys have the same digit are skipped,
+/// e.g. the high bytes of small integers.
+template <typename key_t, typename value_t>
+void RadixSortPairs(std::vector<key_t>& keys,
+                    std::vector<value_t>& values,
+                    bool parallel) {
+    const int64_t n = static_cast<int64_t>(keys.size());
+    if (n == 0) {
+        return;
+    }
+    const int64_t chunk_size =
+            parallel ? parallel_util::GetChunkSize(n, kRadixSortGrainSize) : n;
+    const int64_t num_chunks = (n + chunk_size - 1) / chunk_size;
+    std::vector<key_t> keys_buffer(n);
+    std::vector<value_t> values_buffer(n);
+    std::vector<int64_t> offsets(num_chunks * 256);
+
+    for (int shift = 0; shift < static_cast<int>(8 * sizeof(key_t));
+         shift += 8) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        parallel_util::ParallelForChunks(num_chunks, [&](int64_t chunk_idx) {
+            int64_t* histogram = offsets.data() + chunk_idx * 256;
+            int64_t end = std::min((chunk_idx + 1) * chunk_size, n);
+            for (int64_t i = chunk_idx * chunk_size; i < end; ++i) {
+                histogram[(keys[i] >> shift) & 0xFF]++;
+            }
+        });
+
+        const int64_t first_digit = (keys[0] >> shift) & 0xFF;
+        int64_t first_digit_count = 0;
+        for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            first_digit_count += offsets[chunk_idx * 256 + first_digit];
+        }
+        if (first_digit_count == n) {
+            continue;
+        }
+
+        // Exclusive prefix sum in (digit, chunk) order.
+        int64_t offset = 0;
+        for (int64_t digit = 0; digit < 256; ++digit) {
+            for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+                int64_t count = offsets[chunk_idx * 256 + digit];
+                offsets[chunk_idx * 256 + digit] = offset;
+                offset += count;
+            }
+        }
+
+        parallel_util::ParallelForChunks(num_chunks, [&](int64_t chunk_idx) {
+            int64_t* chunk_offsets = offsets.data() + chunk_idx * 256;
+            int64_t end = std::min((chunk_idx + 1) * chunk_size, n);
+            for (int64_t i = chunk_idx * chunk_size; i < end; ++i) {
+                int64_t pos = chunk_offsets[(keys[i] >> shift) & 0xFF]++;
+                keys_buffer[pos] = keys[i];
+                values_buffer[pos] = values[i];
+            }
+        });
+        keys.swap(keys_buffer);
+        values.swap(values_buffer);
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -25,16 +25,48 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Core/Kernel/Reduction.h"
+
+#include <atomic>
+
+#include "Open3D/Core/Profiler.h"
 #include "Open3D/Core/SizeVector.h"
 
 namespace open3d {
 namespace kernel {
 
+static std::atomic<bool> s_deterministic_reduction(false);
+
+void SetDeterministicReduction(bool deterministic) {
+    s_deterministic_reduction = deterministic;
+}
+
+bool GetDeterministicReduction() { return s_deterministic_reduction; }
+
+static const char* GetOpName(ReductionOpCode op_code) {
+    switch (op_code) {
+        case ReductionOpCode::Sum:
+            return "Sum";
+        case ReductionOpCode::Prod:
+            return "Prod";
+        case ReductionOpCode::Min:
+            return "Min";
+        case ReductionOpCode::Max:
+            return "Max";
+        case ReductionOpCode::ArgMin:
+            return "ArgMin";
+        case ReductionOpCode::ArgMax:
+            return "ArgMax";
+    }
+    return "Reduction";
+}
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
                bool keepdim,
                ReductionOpCode op_code) {
+    ProfilerScope scope(GetOpName(op_code), {src, dst});
+
     // For ArgMin and ArgMax, keepdim == false, and dims can only contain one or
     // all dimensions.
     if (arg_reduce_ops.find(op_code) != arg_reduce_ops.end()) {
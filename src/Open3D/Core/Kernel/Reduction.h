@@ -44,6 +44,15 @@ static const std::unordered_set<ReductionOpCode, utility::hash_enum_class::hash>
 static const std::unordered_set<ReductionOpCode, utility::hash_enum_class::hash>
         arg_reduce_ops = {ReductionOpCode::ArgMin, ReductionOpCode::ArgMax};
 
+/// If true, CPU reductions to a single value combine partial results in a
+/// fixed order, so floating point results are bitwise reproducible for any
+/// number of threads, at a small cost for strided inputs. Reductions of
+/// contiguous inputs over consecutive dims are always reproducible. Defaults
+/// to false. CUDA reductions are not affected.
+void SetDeterministicReduction(bool deterministic);
+
+bool GetDeterministicReduction();
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
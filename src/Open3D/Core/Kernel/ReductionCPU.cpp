@@ -26,11 +26,16 @@
 
 #include "Open3D/Core/Kernel/Reduction.h"
 
+#include <algorithm>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "Open3D/Core/Dispatch.h"
 #include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/Kernel/SIMD.h"
 #include "Open3D/Core/ParallelUtil.h"
+#include "Open3D/Core/ShapeUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
 
@@ -77,6 +82,408 @@ static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
     }
 }
 
+/// Elements (or rows, for reductions over outer dimensions) reduced by a
+/// vectorized loop into one partial result. Partial results are combined
+/// pairwise, which bounds the floating point error by O(log n) instead of
+/// O(n) for serial accumulation, as in numpy's pairwise summation.
+static constexpr int64_t kPairwiseBlockSize = 128;
+
+/// Minimum number of input elements per parallel task.
+static constexpr int64_t kReductionGrainSize = 32768;
+
+/// Accumulation type of the contiguous reductions. Float16 is accumulated in
+/// float and rounded once when the result is stored.
+template <typename scalar_t>
+struct CPUReductionAccType {
+    typedef scalar_t type;
+};
+
+template <>
+struct CPUReductionAccType<Half> {
+    typedef float type;
+};
+
+/// Reduction ops of the contiguous reduction engine. kVectorized ops also
+/// apply to simd::Vec.
+struct CPUSumReductionOp {
+    static constexpr bool kVectorized = true;
+    template <typename T>
+    T operator()(const T& a, const T& b) const {
+        return static_cast<T>(a + b);
+    }
+};
+
+struct CPUProdReductionOp {
+    static constexpr bool kVectorized = true;
+    template <typename T>
+    T operator()(const T& a, const T& b) const {
+        return static_cast<T>(a * b);
+    }
+};
+
+struct CPUMinReductionOp {
+    static constexpr bool kVectorized = false;
+    template <typename T>
+    T operator()(const T& a, const T& b) const {
+        return std::min(a, b);
+    }
+};
+
+struct CPUMaxReductionOp {
+    static constexpr bool kVectorized = false;
+    template <typename T>
+    T operator()(const T& a, const T& b) const {
+        return std::max(a, b);
+    }
+};
+
+/// Reduces the n <= kPairwiseBlockSize contiguous elements of \p src.
+template <typename acc_t, typename scalar_t, typename op_t>
+static acc_t BlockReduce(const scalar_t* src,
+                         int64_t n,
+                         acc_t identity,
+                         const op_t& op,
+                         std::false_type /* vectorized */) {
+    acc_t acc = identity;
+    for (int64_t i = 0; i < n; ++i) {
+        acc = op(acc, static_cast<acc_t>(src[i]));
+    }
+    return acc;
+}
+
+template <typename scalar_t, typename op_t>
+static scalar_t BlockReduce(const scalar_t* src,
+                            int64_t n,
+                            scalar_t identity,
+                            const op_t& op,
+                            std::true_type /* vectorized */) {
+    using Vec = simd::Vec<scalar_t>;
+    // Two independent accumulators hide the latency of the vector op.
+    Vec acc0 = Vec::Broadcast(identity);
+    Vec acc1 = Vec::Broadcast(identity);
+    int64_t i = 0;
+    for (; i + 2 * Vec::size <= n; i += 2 * Vec::size) {
+        acc0 = op(acc0, Vec::Load(src + i));
+        acc1 = op(acc1, Vec::Load(src + i + Vec::size));
+    }
+    acc0 = op(acc0, acc1);
+    scalar_t lanes[Vec::size];
+    acc0.Store(lanes);
+    scalar_t acc = identity;
+    for (int64_t lane = 0; lane < Vec::size; ++lane) {
+        acc = op(acc, lanes[lane]);
+    }
+    for (; i < n; ++i) {
+        acc = op(acc, src[i]);
+    }
+    return acc;
+}
+
+/// out[c] = op(out[c], row[c]) for c in [0, width).
+template <typename acc_t, typename scalar_t, typename op_t>
+static void AccumulateRow(acc_t* out,
+                          const scalar_t* row,
+                          int64_t width,
+                          const op_t& op,
+                          std::false_type /* vectorized */) {
+    for (int64_t c = 0; c < width; ++c) {
+        out[c] = op(out[c], static_cast<acc_t>(row[c]));
+    }
+}
+
+template <typename scalar_t, typename op_t>
+static void AccumulateRow(scalar_t* out,
+                          const scalar_t* row,
+                          int64_t width,
+                          const op_t& op,
+                          std::true_type /* vectorized */) {
+    using Vec = simd::Vec<scalar_t>;
+    int64_t c = 0;
+    for (; c + Vec::size <= width; c += Vec::size) {
+        op(Vec::Load(out + c), Vec::Load(row + c)).Store(out + c);
+    }
+    for (; c < width; ++c) {
+        out[c] = op(out[c], row[c]);
+    }
+}
+
+/// Combines a sequence of partial results, each \p width values wide,
+/// pairwise: the i-th partial result is combined with the (i - 1)-th when i
+/// is odd, their sum with the sum of the previous two when i % 4 == 3, and so
+/// on, like a binary counter. Because aligned groups of 2^k partial results
+/// always form the same subtree, reducing such groups in parallel and
+/// pushing the group results gives the same result as pushing every partial
+/// result serially.
+template <typename acc_t, typename op_t>
+class PairwiseCombiner {
+public:
+    /// \p max_num_partials bounds the number of Push() calls between Reset()
+    /// calls, which determines the size of the stack of partial results.
+    PairwiseCombiner(int64_t width, int64_t max_num_partials, const op_t& op)
+        : width_(width), op_(op) {
+        int64_t num_levels = 2;
+        for (; max_num_partials > 1; max_num_partials /= 2) {
+            ++num_levels;
+        }
+        stack_.resize(num_levels * width);
+    }
+
+    void Reset() {
+        depth_ = 0;
+        count_ = 0;
+    }
+
+    /// Returns the buffer for the next partial result, to be written before
+    /// calling Push().
+    acc_t* Next() { return stack_.data() + depth_ * width_; }
+
+    void Push() {
+        ++depth_;
+        for (int64_t bits = count_++; bits & 1; bits >>= 1) {
+            Merge();
+        }
+    }
+
+    /// Pushes a partial result that was computed elsewhere.
+    void Push(const acc_t* partial) {
+        std::copy(partial, partial + width_, Next());
+        Push();
+    }
+
+    /// Combines the remaining partial results in order. Returns nullptr if
+    /// nothing was pushed.
+    const acc_t* Result() {
+        while (depth_ > 1) {
+            Merge();
+        }
+        return depth_ == 0 ? nullptr : stack_.data();
+    }
+
+private:
+    void Merge() {
+        acc_t* lhs = stack_.data() + (depth_ - 2) * width_;
+        const acc_t* rhs = lhs + width_;
+        for (int64_t c = 0; c < width_; ++c) {
+            lhs[c] = op_(lhs[c], rhs[c]);
+        }
+        --depth_;
+    }
+
+    int64_t width_;
+    op_t op_;
+    std::vector<acc_t> stack_;
+    int64_t depth_ = 0;
+    int64_t count_ = 0;
+};
+
+/// Reduction of contiguous inputs over a range of dimensions, with the input
+/// viewed as (num_outer, n, num_inner) and the output as (num_outer,
+/// num_inner). Runs of kPairwiseBlockSize elements (num_inner == 1) or rows
+/// (num_inner > 1) are reduced with SIMD and combined by PairwiseCombiner.
+/// Parallel tasks reduce aligned groups of 2^k blocks, so the result is
+/// deterministic and independent of the number of threads.
+template <typename scalar_t, typename op_t>
+class CPUContiguousReductionEngine {
+public:
+    typedef typename CPUReductionAccType<scalar_t>::type acc_t;
+    typedef std::integral_constant<
+            bool,
+            op_t::kVectorized && std::is_same<acc_t, scalar_t>::value>
+            vectorized_t;
+
+    CPUContiguousReductionEngine(const scalar_t* src,
+                                 scalar_t* dst,
+                                 int64_t num_outer,
+                                 int64_t n,
+                                 int64_t num_inner,
+                                 scalar_t identity,
+                                 const op_t& op)
+        : src_(src),
+          dst_(dst),
+          num_outer_(num_outer),
+          n_(n),
+          num_inner_(num_inner),
+          identity_(static_cast<acc_t>(identity)),
+          op_(op) {}
+
+    void Run() {
+        int64_t num_threads = parallel_util::GetNumThreads();
+        int64_t slice_size = std::max<int64_t>(1, n_ * num_inner_);
+        if (num_outer_ >= num_threads || slice_size <= kReductionGrainSize) {
+            parallel_util::ParallelFor(
+                    0, num_outer_,
+                    std::max<int64_t>(1, kReductionGrainSize / slice_size),
+                    [&](int64_t begin, int64_t end) {
+                        PairwiseCombiner<acc_t, op_t> combiner(
+                                num_inner_, NumBlocks(n_), op_);
+                        for (int64_t o = begin; o < end; ++o) {
+                            ReduceSlice(o, 0, num_inner_, combiner);
+                        }
+                    });
+        } else if (num_inner_ >= kPairwiseBlockSize &&
+                   num_inner_ >= n_) {
+            // Wide rows, split the columns.
+            for (int64_t o = 0; o < num_outer_; ++o) {
+                parallel_util::ParallelFor(
+                        0, num_inner_,
+                        std::max<int64_t>(kPairwiseBlockSize,
+                                          kReductionGrainSize / n_),
+                        [&](int64_t begin, int64_t end) {
+                            PairwiseCombiner<acc_t, op_t> combiner(
+                                    end - begin, NumBlocks(n_), op_);
+                            ReduceSlice(o, begin, end, combiner);
+                        });
+            }
+        } else {
+            for (int64_t o = 0; o < num_outer_; ++o) {
+                ReduceSliceInChunks(o);
+            }
+        }
+    }
+
+private:
+    static int64_t NumBlocks(int64_t n) {
+        return (n + kPairwiseBlockSize - 1) / kPairwiseBlockSize;
+    }
+
+    /// Reduces the columns [c_begin, c_end) of slice o serially.
+    void ReduceSlice(int64_t o,
+                     int64_t c_begin,
+                     int64_t c_end,
+                     PairwiseCombiner<acc_t, op_t>& combiner) const {
+        combiner.Reset();
+        ReduceBlocks(o, 0, n_, c_begin, c_end, combiner);
+        WriteResult(o, c_begin, c_end, combiner.Result());
+    }
+
+    /// Pushes the blocks of elements or rows [begin, end) of slice o, for
+    /// columns [c_begin, c_end). begin must be a multiple of
+    /// kPairwiseBlockSize.
+    void ReduceBlocks(int64_t o,
+                      int64_t begin,
+                      int64_t end,
+                      int64_t c_begin,
+                      int64_t c_end,
+                      PairwiseCombiner<acc_t, op_t>& combiner) const {
+        const scalar_t* slice = src_ + o * n_ * num_inner_;
+        int64_t width = c_end - c_begin;
+        for (int64_t b = begin; b < end; b += kPairwiseBlockSize) {
+            int64_t block_end = std::min(b + kPairwiseBlockSize, end);
+            acc_t* out = combiner.Next();
+            if (num_inner_ == 1) {
+                *out = BlockReduce(slice + b, block_end - b, identity_, op_,
+                                   vectorized_t());
+            } else {
+                std::fill(out, out + width, identity_);
+                for (int64_t r = b; r < block_end; ++r) {
+                    AccumulateRow(out, slice + r * num_inner_ + c_begin,
+                                  width, op_, vectorized_t());
+                }
+            }
+            combiner.Push();
+        }
+    }
+
+    /// Reduces slice o with tasks over aligned groups of 2^k blocks, then
+    /// combines the group results.
+    void ReduceSliceInChunks(int64_t o) const {
+        int64_t chunk_size = kPairwiseBlockSize;
+        int64_t target_chunk_size =
+                parallel_util::GetChunkSize(n_ * num_inner_,
+                                            kReductionGrainSize) /
+                num_inner_;
+        while (chunk_size < target_chunk_size) {
+            chunk_size *= 2;
+        }
+        int64_t num_chunks = (n_ + chunk_size - 1) / chunk_size;
+        std::vector<acc_t> partials(num_chunks * num_inner_);
+        parallel_util::ParallelFor(
+                0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+                    PairwiseCombiner<acc_t, op_t> combiner(
+                            num_inner_, NumBlocks(chunk_size), op_);
+                    for (int64_t chunk = begin; chunk < end; ++chunk) {
+                        combiner.Reset();
+                        ReduceBlocks(o, chunk * chunk_size,
+                                     std::min((chunk + 1) * chunk_size, n_), 0,
+                                     num_inner_, combiner);
+                        const acc_t* result = combiner.Result();
+                        std::copy(result, result + num_inner_,
+                                  partials.data() + chunk * num_inner_);
+                    }
+                });
+        PairwiseCombiner<acc_t, op_t> combiner(num_inner_, num_chunks, op_);
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+            combiner.Push(partials.data() + chunk * num_inner_);
+        }
+        WriteResult(o, 0, num_inner_, combiner.Result());
+    }
+
+    void WriteResult(int64_t o,
+                     int64_t c_begin,
+                     int64_t c_end,
+                     const acc_t* result) const {
+        scalar_t* dst = dst_ + o * num_inner_;
+        for (int64_t c = c_begin; c < c_end; ++c) {
+            dst[c] = static_cast<scalar_t>(result ? result[c - c_begin]
+                                                  : identity_);
+        }
+    }
+
+    const scalar_t* src_;
+    scalar_t* dst_;
+    int64_t num_outer_;
+    int64_t n_;
+    int64_t num_inner_;
+    acc_t identity_;
+    op_t op_;
+};
+
+/// Runs CPUContiguousReductionEngine if src and dst are contiguous and the
+/// reduction dims are consecutive, e.g. the last dim of (N, M) or the first
+/// dim of (N, 3). dst has the keepdim shape. Returns false otherwise.
+template <typename scalar_t, typename op_t>
+static bool TryLaunchContiguousReduction(const Tensor& src,
+                                         Tensor& dst,
+                                         const SizeVector& dims,
+                                         scalar_t identity,
+                                         const op_t& op) {
+    if (!src.IsContiguous() || !dst.IsContiguous() ||
+        src.GetDtype() != dst.GetDtype()) {
+        return false;
+    }
+    int64_t num_dims = src.NumDims();
+    std::vector<bool> is_reduction_dim(num_dims, false);
+    for (int64_t dim : dims) {
+        is_reduction_dim[shape_util::WrapDim(dim, num_dims)] = true;
+    }
+    int64_t first = 0;
+    while (first < num_dims && !is_reduction_dim[first]) {
+        ++first;
+    }
+    int64_t last = first;
+    while (last < num_dims && is_reduction_dim[last]) {
+        ++last;
+    }
+    if (first == num_dims ||
+        std::find(is_reduction_dim.begin() + last, is_reduction_dim.end(),
+                  true) != is_reduction_dim.end()) {
+        return false;
+    }
+    const SizeVector& shape = src.GetShapeRef();
+    int64_t num_outer = 1;
+    int64_t n = 1;
+    int64_t num_inner = 1;
+    for (int64_t d = 0; d < num_dims; ++d) {
+        (d < first ? num_outer : d < last ? n : num_inner) *= shape[d];
+    }
+    CPUContiguousReductionEngine<scalar_t, op_t>(
+            static_cast<const scalar_t*>(src.GetDataPtr()),
+            static_cast<scalar_t*>(dst.GetDataPtr()), num_outer, n,
+            num_inner, identity, op)
+            .Run();
+    return true;
+}
+
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
@@ -87,8 +494,12 @@ public:
     void Run(const func_t& reduce_func, scalar_t identity) {
         // See: PyTorch's TensorIterator::parallel_reduce for the reference
         // design of reduction strategy.
-        if (parallel_util::GetMaxThreads() == 1 ||
-            parallel_util::InParallel()) {
+        if (indexer_.NumOutputElements() <= 1 &&
+            GetDeterministicReduction()) {
+            LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
+                                                   identity);
+        } else if (parallel_util::GetMaxThreads() == 1 ||
+                   parallel_util::InParallel()) {
             LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
         } else if (indexer_.NumOutputElements() <= 1) {
             LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
@@ -102,7 +513,18 @@ private:
     template <typename scalar_t, typename func_t>
     static void LaunchReductionKernelSerial(const Indexer& indexer,
                                             func_t element_kernel) {
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
+        int64_t num_workloads = indexer.NumWorkloads();
+        auto workload_kernel = [&](char* const* input_ptrs, char* output_ptr) {
+            scalar_t* src = reinterpret_cast<scalar_t*>(input_ptrs[0]);
+            scalar_t* dst = reinterpret_cast<scalar_t*>(output_ptr);
+            *dst = element_kernel(*src, *dst);
+        };
+        if (DispatchStaticIndexer<1>(indexer, [&](const auto& static_indexer) {
+                static_indexer.ForEach(0, num_workloads, workload_kernel);
+            })) {
+            return;
+        }
+        for (int64_t workload_idx = 0; workload_idx < num_workloads;
              ++workload_idx) {
             scalar_t* src = reinterpret_cast<scalar_t*>(
                     indexer.GetInputPtr(0, workload_idx));
@@ -127,20 +549,49 @@ private:
         int64_t num_threads = parallel_util::GetMaxThreads();
         int64_t workload_per_thread =
                 (num_workloads + num_threads - 1) / num_threads;
+        if (GetDeterministicReduction()) {
+            // Fixed-size ranges combined in order, independent of the number
+            // of threads.
+            workload_per_thread = kReductionGrainSize;
+            num_threads = (num_workloads + workload_per_thread - 1) /
+                          workload_per_thread;
+        }
         std::vector<scalar_t> thread_results(num_threads, identity);
 
+        auto reduce_range = [&](const auto& static_indexer) {
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
+            for (int64_t thread_idx = 0; thread_idx < num_threads;
+                 ++thread_idx) {
+                int64_t start = thread_idx * workload_per_thread;
+                int64_t end =
+                        std::min(start + workload_per_thread, num_workloads);
+                scalar_t& result = thread_results[thread_idx];
+                static_indexer.ForEach(
+                        start, end, [&](char* const* input_ptrs, char*) {
+                            result = element_kernel(
+                                    *reinterpret_cast<scalar_t*>(input_ptrs[0]),
+                                    result);
+                        });
+            }
+        };
+        if (!DispatchStaticIndexer<1>(indexer, reduce_range)) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int64_t thread_idx = 0; thread_idx < num_threads;
+                 ++thread_idx) {
+                int64_t start = thread_idx * workload_per_thread;
+                int64_t end =
+                        std::min(start + workload_per_thread, num_workloads);
+                for (int64_t workload_idx = start; workload_idx < end;
+                     ++workload_idx) {
+                    scalar_t* src = reinterpret_cast<scalar_t*>(
+                            indexer.GetInputPtr(0, workload_idx));
+                    thread_results[thread_idx] =
+                            element_kernel(*src, thread_results[thread_idx]);
+                }
             }
         }
         scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
@@ -248,13 +699,19 @@ void ReductionCPU(const Tensor& src,
             switch (op_code) {
                 case ReductionOpCode::Sum:
                     identity = 0;
-                    dst.Fill(identity);
-                    re.Run(CPUSumReductionKernel<scalar_t>, identity);
+                    if (!TryLaunchContiguousReduction(src, dst, dims, identity,
+                                                      CPUSumReductionOp())) {
+                        dst.Fill(identity);
+                        re.Run(CPUSumReductionKernel<scalar_t>, identity);
+                    }
                     break;
                 case ReductionOpCode::Prod:
                     identity = 1;
-                    dst.Fill(identity);
-                    re.Run(CPUProdReductionKernel<scalar_t>, identity);
+                    if (!TryLaunchContiguousReduction(src, dst, dims, identity,
+                                                      CPUProdReductionOp())) {
+                        dst.Fill(identity);
+                        re.Run(CPUProdReductionKernel<scalar_t>, identity);
+                    }
                     break;
                 case ReductionOpCode::Min:
                     if (indexer.NumWorkloads() == 0) {
@@ -262,8 +719,12 @@ void ReductionCPU(const Tensor& src,
                                 "Zero-size Tensor does not suport Min.");
                     } else {
                         identity = std::numeric_limits<scalar_t>::max();
-                        dst.Fill(identity);
-                        re.Run(CPUMinReductionKernel<scalar_t>, identity);
+                        if (!TryLaunchContiguousReduction(
+                                    src, dst, dims, identity,
+                                    CPUMinReductionOp())) {
+                            dst.Fill(identity);
+                            re.Run(CPUMinReductionKernel<scalar_t>, identity);
+                        }
                     }
                     break;
                 case ReductionOpCode::Max:
@@ -272,8 +733,12 @@ void ReductionCPU(const Tensor& src,
                                 "Zero-size Tensor does not suport Max.");
                     } else {
                         identity = std::numeric_limits<scalar_t>::lowest();
-                        dst.Fill(identity);
-                        re.Run(CPUMaxReductionKernel<scalar_t>, identity);
+                        if (!TryLaunchContiguousReduction(
+                                    src, dst, dims, identity,
+                                    CPUMaxReductionOp())) {
+                            dst.Fill(identity);
+                            re.Run(CPUMaxReductionKernel<scalar_t>, identity);
+                        }
                     }
                     break;
                 default:
@@ -0,0 +1,214 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace open3d {
+namespace kernel {
+namespace simd {
+
+/// Minimal SIMD vector abstraction used by the contiguous fast paths of the
+/// CPU element-wise kernels.
+///
+/// Vec<scalar_t> holds Vec<scalar_t>::size lanes and supports unaligned
+/// Load/Store, Broadcast, the arithmetic operators and lane-wise Max/Min,
+/// which return \p o where either lane is NaN. The generic template is
+/// a single-lane scalar fallback; float and double are specialized for AVX,
+/// SSE2 or NEON (aarch64) depending on the compile target.
+template <typename scalar_t>
+struct Vec {
+    static constexpr int64_t size = 1;
+    scalar_t v_;
+
+    static Vec Load(const scalar_t* ptr) { return Vec{*ptr}; }
+    static Vec Broadcast(scalar_t val) { return Vec{val}; }
+    void Store(scalar_t* ptr) const { *ptr = v_; }
+
+    Vec operator+(const Vec& o) const { return Vec{scalar_t(v_ + o.v_)}; }
+    Vec operator-(const Vec& o) const { return Vec{scalar_t(v_ - o.v_)}; }
+    Vec operator*(const Vec& o) const { return Vec{scalar_t(v_ * o.v_)}; }
+    Vec operator/(const Vec& o) const { return Vec{scalar_t(v_ / o.v_)}; }
+    Vec operator-() const { return Vec{scalar_t(-v_)}; }
+    Vec Sqrt() const { return Vec{scalar_t(std::sqrt(v_))}; }
+    Vec Abs() const {
+        return Vec{scalar_t(std::abs(static_cast<double>(v_)))};
+    }
+    Vec Max(const Vec& o) const { return Vec{v_ > o.v_ ? v_ : o.v_}; }
+    Vec Min(const Vec& o) const { return Vec{v_ < o.v_ ? v_ : o.v_}; }
+};
+
+#if defined(__AVX__)
+
+template <>
+struct Vec<float> {
+    static constexpr int64_t size = 8;
+    __m256 v_;
+
+    static Vec Load(const float* ptr) { return Vec{_mm256_loadu_ps(ptr)}; }
+    static Vec Broadcast(float val) { return Vec{_mm256_set1_ps(val)}; }
+    void Store(float* ptr) const { _mm256_storeu_ps(ptr, v_); }
+
+    Vec operator+(const Vec& o) const { return Vec{_mm256_add_ps(v_, o.v_)}; }
+    Vec operator-(const Vec& o) const { return Vec{_mm256_sub_ps(v_, o.v_)}; }
+    Vec operator*(const Vec& o) const { return Vec{_mm256_mul_ps(v_, o.v_)}; }
+    Vec operator/(const Vec& o) const { return Vec{_mm256_div_ps(v_, o.v_)}; }
+    Vec operator-() const {
+        return Vec{_mm256_xor_ps(v_, _mm256_set1_ps(-0.f))};
+    }
+    Vec Sqrt() const { return Vec{_mm256_sqrt_ps(v_)}; }
+    Vec Abs() const { return Vec{_mm256_andnot_ps(_mm256_set1_ps(-0.f), v_)}; }
+    Vec Max(const Vec& o) const { return Vec{_mm256_max_ps(v_, o.v_)}; }
+    Vec Min(const Vec& o) const { return Vec{_mm256_min_ps(v_, o.v_)}; }
+};
+
+template <>
+struct Vec<double> {
+    static constexpr int64_t size = 4;
+    __m256d v_;
+
+    static Vec Load(const double* ptr) { return Vec{_mm256_loadu_pd(ptr)}; }
+    static Vec Broadcast(double val) { return Vec{_mm256_set1_pd(val)}; }
+    void Store(double* ptr) const { _mm256_storeu_pd(ptr, v_); }
+
+    Vec operator+(const Vec& o) const { return Vec{_mm256_add_pd(v_, o.v_)}; }
+    Vec operator-(const Vec& o) const { return Vec{_mm256_sub_pd(v_, o.v_)}; }
+    Vec operator*(const Vec& o) const { return Vec{_mm256_mul_pd(v_, o.v_)}; }
+    Vec operator/(const Vec& o) const { return Vec{_mm256_div_pd(v_, o.v_)}; }
+    Vec operator-() const {
+        return Vec{_mm256_xor_pd(v_, _mm256_set1_pd(-0.))};
+    }
+    Vec Sqrt() const { return Vec{_mm256_sqrt_pd(v_)}; }
+    Vec Abs() const { return Vec{_mm256_andnot_pd(_mm256_set1_pd(-0.), v_)}; }
+    Vec Max(const Vec& o) const { return Vec{_mm256_max_pd(v_, o.v_)}; }
+    Vec Min(const Vec& o) const { return Vec{_mm256_min_pd(v_, o.v_)}; }
+};
+
+#elif defined(__SSE2__)
+
+template <>
+struct Vec<float> {
+    static constexpr int64_t size = 4;
+    __m128 v_;
+
+    static Vec Load(const float* ptr) { return Vec{_mm_loadu_ps(ptr)}; }
+    static Vec Broadcast(float val) { return Vec{_mm_set1_ps(val)}; }
+    void Store(float* ptr) const { _mm_storeu_ps(ptr, v_); }
+
+    Vec operator+(const Vec& o) const { return Vec{_mm_add_ps(v_, o.v_)}; }
+    Vec operator-(const Vec& o) const { return Vec{_mm_sub_ps(v_, o.v_)}; }
+    Vec operator*(const Vec& o) const { return Vec{_mm_mul_ps(v_, o.v_)}; }
+    Vec operator/(const Vec& o) const { return Vec{_mm_div_ps(v_, o.v_)}; }
+    Vec operator-() const { return Vec{_mm_xor_ps(v_, _mm_set1_ps(-0.f))}; }
+    Vec Sqrt() const { return Vec{_mm_sqrt_ps(v_)}; }
+    Vec Abs() const { return Vec{_mm_andnot_ps(_mm_set1_ps(-0.f), v_)}; }
+    Vec Max(const Vec& o) const { return Vec{_mm_max_ps(v_, o.v_)}; }
+    Vec Min(const Vec& o) const { return Vec{_mm_min_ps(v_, o.v_)}; }
+};
+
+template <>
+struct Vec<double> {
+    static constexpr int64_t size = 2;
+    __m128d v_;
+
+    static Vec Load(const double* ptr) { return Vec{_mm_loadu_pd(ptr)}; }
+    static Vec Broadcast(double val) { return Vec{_mm_set1_pd(val)}; }
+    void Store(double* ptr) const { _mm_storeu_pd(ptr, v_); }
+
+    Vec operator+(const Vec& o) const { return Vec{_mm_add_pd(v_, o.v_)}; }
+    Vec operator-(const Vec& o) const { return Vec{_mm_sub_pd(v_, o.v_)}; }
+    Vec operator*(const Vec& o) const { return Vec{_mm_mul_pd(v_, o.v_)}; }
+    Vec operator/(const Vec& o) const { return Vec{_mm_div_pd(v_, o.v_)}; }
+    Vec operator-() const { return Vec{_mm_xor_pd(v_, _mm_set1_pd(-0.))}; }
+    Vec Sqrt() const { return Vec{_mm_sqrt_pd(v_)}; }
+    Vec Abs() const { return Vec{_mm_andnot_pd(_mm_set1_pd(-0.), v_)}; }
+    Vec Max(const Vec& o) const { return Vec{_mm_max_pd(v_, o.v_)}; }
+    Vec Min(const Vec& o) const { return Vec{_mm_min_pd(v_, o.v_)}; }
+};
+
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+
+template <>
+struct Vec<float> {
+    static constexpr int64_t size = 4;
+    float32x4_t v_;
+
+    static Vec Load(const float* ptr) { return Vec{vld1q_f32(ptr)}; }
+    static Vec Broadcast(float val) { return Vec{vdupq_n_f32(val)}; }
+    void Store(float* ptr) const { vst1q_f32(ptr, v_); }
+
+    Vec operator+(const Vec& o) const { return Vec{vaddq_f32(v_, o.v_)}; }
+    Vec operator-(const Vec& o) const { return Vec{vsubq_f32(v_, o.v_)}; }
+    Vec operator*(const Vec& o) const { return Vec{vmulq_f32(v_, o.v_)}; }
+    Vec operator/(const Vec& o) const { return Vec{vdivq_f32(v_, o.v_)}; }
+    Vec operator-() const { return Vec{vnegq_f32(v_)}; }
+    Vec Sqrt() const { return Vec{vsqrtq_f32(v_)}; }
+    Vec Abs() const { return Vec{vabsq_f32(v_)}; }
+    Vec Max(const Vec& o) const {
+        return Vec{vbslq_f32(vcgtq_f32(v_, o.v_), v_, o.v_)};
+    }
+    Vec Min(const Vec& o) const {
+        return Vec{vbslq_f32(vcltq_f32(v_, o.v_), v_, o.v_)};
+    }
+};
+
+template <>
+struct Vec<double> {
+    static constexpr int64_t size = 2;
+    float64x2_t v_;
+
+    static Vec Load(const double* ptr) { return Vec{vld1q_f64(ptr)}; }
+    static Vec Broadcast(double val) { return Vec{vdupq_n_f64(val)}; }
+    void Store(double* ptr) const { vst1q_f64(ptr, v_); }
+
+    Vec operator+(const Vec& o) const { return Vec{vaddq_f64(v_, o.v_)}; }
+    Vec operator-(const Vec& o) const { return Vec{vsubq_f64(v_, o.v_)}; }
+    Vec operator*(const Vec& o) const { return Vec{vmulq_f64(v_, o.v_)}; }
+    Vec operator/(const Vec& o) const { return Vec{vdivq_f64(v_, o.v_)}; }
+    Vec operator-() const { return Vec{vnegq_f64(v_)}; }
+    Vec Sqrt() const { return Vec{vsqrtq_f64(v_)}; }
+    Vec Abs() const { return Vec{vabsq_f64(v_)}; }
+    Vec Max(const Vec& o) const {
+        return Vec{vbslq_f64(vcgtq_f64(v_, o.v_), v_, o.v_)};
+    }
+    Vec Min(const Vec& o) const {
+        return Vec{vbslq_f64(vcltq_f64(v_, o.v_), v_, o.v_)};
+    }
+};
+
+#endif
+
+}  // namespace simd
+}  // namespace kernel
+}  // namespace open3d
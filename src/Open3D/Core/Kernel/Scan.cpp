@@ -0,0 +1,67 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Scan.h"
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+void Scan(const Tensor& src,
+          Tensor& dst,
+          int64_t dim,
+          bool exclusive,
+          ScanOpCode op_code) {
+    if (src.GetDevice() != dst.GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          src.GetDevice().ToString(),
+                          dst.GetDevice().ToString());
+    }
+    if (src.GetDtype() != dst.GetDtype()) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          DtypeUtil::ToString(src.GetDtype()),
+                          DtypeUtil::ToString(dst.GetDtype()));
+    }
+    if (src.GetShape() != dst.GetShape()) {
+        utility::LogError("Shape mismatch {} != {}.", src.GetShape(),
+                          dst.GetShape());
+    }
+    dim = shape_util::WrapDim(dim, src.NumDims());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ScanCPU(src, dst, dim, exclusive, op_code);
+    } else {
+        utility::LogError("Scan: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Scan.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/ParallelUtil.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Minimum number of elements scanned per task.
+static constexpr int64_t kScanGrainSize = 32768;
+
+template <typename scalar_t>
+struct CPUScanSumOp {
+    static scalar_t Identity() { return static_cast<scalar_t>(0); }
+    scalar_t operator()(scalar_t a, scalar_t b) const { return a + b; }
+};
+
+template <typename scalar_t>
+struct CPUScanProdOp {
+    static scalar_t Identity() { return static_cast<scalar_t>(1); }
+    scalar_t operator()(scalar_t a, scalar_t b) const { return a * b; }
+};
+
+/// Scans contiguous src, viewed as (outer, len, inner), along len.
+///
+/// If there are enough independent lines, each line is scanned serially by
+/// one task. Otherwise each line is scanned with the two-pass
+/// parallel_util::ParallelScan: the first pass reduces chunks of the line,
+/// the second pass rescans each chunk from the reduction of its
+/// predecessors.
+template <typename scalar_t, typename op_t>
+static void CPUScanKernel(const scalar_t* src,
+                          scalar_t* dst,
+                          int64_t outer,
+                          int64_t len,
+                          int64_t inner,
+                          bool exclusive,
+                          op_t op) {
+    const scalar_t identity = op_t::Identity();
+    const int64_t line_size = len * inner;
+
+    // Scans positions [l_begin, l_end) of line o starting from the inner
+    // accumulators acc. Writes dst only if is_final is true.
+    auto scan_range = [&](int64_t o, int64_t l_begin, int64_t l_end,
+                          scalar_t* acc, bool is_final) {
+        const scalar_t* src_ptr = src + o * line_size + l_begin * inner;
+        scalar_t* dst_ptr = dst + o * line_size + l_begin * inner;
+        if (!is_final) {
+            for (int64_t l = l_begin; l < l_end; ++l, src_ptr += inner) {
+                for (int64_t i = 0; i < inner; ++i) {
+                    acc[i] = op(acc[i], src_ptr[i]);
+                }
+            }
+        } else if (exclusive) {
+            for (int64_t l = l_begin; l < l_end;
+                 ++l, src_ptr += inner, dst_ptr += inner) {
+                for (int64_t i = 0; i < inner; ++i) {
+                    dst_ptr[i] = acc[i];
+                    acc[i] = op(acc[i], src_ptr[i]);
+                }
+            }
+        } else {
+            for (int64_t l = l_begin; l < l_end;
+                 ++l, src_ptr += inner, dst_ptr += inner) {
+                for (int64_t i = 0; i < inner; ++i) {
+                    acc[i] = op(acc[i], src_ptr[i]);
+                    dst_ptr[i] = acc[i];
+                }
+            }
+        }
+    };
+
+    if (outer >= parallel_util::GetNumThreads() ||
+        outer * line_size <= kScanGrainSize) {
+        int64_t lines_per_grain =
+                kScanGrainSize / std::max<int64_t>(line_size, 1);
+        int64_t grain_size = std::max<int64_t>(lines_per_grain, 1);
+        parallel_util::ParallelFor(
+                0, outer, grain_size, [&](int64_t o_begin, int64_t o_end) {
+                    std::vector<scalar_t> acc(inner);
+                    for (int64_t o = o_begin; o < o_end; ++o) {
+                        std::fill(acc.begin(), acc.end(), identity);
+                        scan_range(o, 0, len, acc.data(), true);
+                    }
+                });
+    } else {
+        int64_t grain_size = std::max<int64_t>(1, kScanGrainSize / inner);
+        for (int64_t o = 0; o < outer; ++o) {
+            parallel_util::ParallelScan(
+                    int64_t(0), len, grain_size,
+                    std::vector<scalar_t>(inner, identity),
+                    [&](int64_t l_begin, int64_t l_end,
+                        std::vector<scalar_t> acc, bool is_final) {
+                        scan_range(o, l_begin, l_end, acc.data(), is_final);
+                        return acc;
+                    },
+                    [&](std::vector<scalar_t> lhs,
+                        const std::vector<scalar_t>& rhs) {
+                        for (int64_t i = 0; i < inner; ++i) {
+                            lhs[i] = op(lhs[i], rhs[i]);
+                        }
+                        return lhs;
+                    });
+        }
+    }
+}
+
+void ScanCPU(const Tensor& src,
+             Tensor& dst,
+             int64_t dim,
+             bool exclusive,
+             ScanOpCode op_code) {
+    const SizeVector& shape = src.GetShapeRef();
+    int64_t outer = 1;
+    int64_t inner = 1;
+    for (int64_t i = 0; i < dim; ++i) {
+        outer *= shape[i];
+    }
+    for (int64_t i = dim + 1; i < static_cast<int64_t>(shape.size()); ++i) {
+        inner *= shape[i];
+    }
+    int64_t len = shape[dim];
+
+    Tensor src_contiguous = src.Contiguous();
+    Tensor dst_contiguous =
+            dst.IsContiguous() ? dst
+                               : Tensor(shape, dst.GetDtype(), dst.GetDevice());
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst_contiguous.GetDataPtr());
+        switch (op_code) {
+            case ScanOpCode::Sum:
+                CPUScanKernel(src_ptr, dst_ptr, outer, len, inner, exclusive,
+                              CPUScanSumOp<scalar_t>());
+                break;
+            case ScanOpCode::Prod:
+                CPUScanKernel(src_ptr, dst_ptr, outer, len, inner, exclusive,
+                              CPUScanProdOp<scalar_t>());
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+    if (!dst.IsContiguous()) {
+        dst.AsRvalue() = dst_contiguous;
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
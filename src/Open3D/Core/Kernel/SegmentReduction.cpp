@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/SegmentReduction.h"
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+void SegmentReduce(const Tensor& values,
+                   const Tensor& prefix_sum,
+                   Tensor& dst,
+                   SegmentReductionOpCode op_code) {
+    if (values.GetDevice() != prefix_sum.GetDevice() ||
+        values.GetDevice() != dst.GetDevice()) {
+        utility::LogError("Device mismatch: values {}, prefix_sum {}, dst {}.",
+                          values.GetDevice().ToString(),
+                          prefix_sum.GetDevice().ToString(),
+                          dst.GetDevice().ToString());
+    }
+    if (prefix_sum.GetDtype() != Dtype::Int64 || prefix_sum.NumDims() != 1) {
+        utility::LogError(
+                "prefix_sum must be a 1D Int64 tensor, but got {} tensor of "
+                "shape {}.",
+                DtypeUtil::ToString(prefix_sum.GetDtype()),
+                prefix_sum.GetShape());
+    }
+    if (values.NumDims() == 0) {
+        utility::LogError("values must have at least one dimension.");
+    }
+
+    SizeVector dst_shape = values.GetShape();
+    dst_shape[0] = prefix_sum.GetShape()[0];
+    if (dst.GetShape() != dst_shape) {
+        utility::LogError("Expected dst of shape {}, but got {}.", dst_shape,
+                          dst.GetShape());
+    }
+    bool arg_reduction = op_code == SegmentReductionOpCode::ArgMin ||
+                         op_code == SegmentReductionOpCode::ArgMax;
+    Dtype dst_dtype = arg_reduction ? Dtype::Int64 : values.GetDtype();
+    if (dst.GetDtype() != dst_dtype) {
+        utility::LogError("Expected dst of dtype {}, but got {}.",
+                          DtypeUtil::ToString(dst_dtype),
+                          DtypeUtil::ToString(dst.GetDtype()));
+    }
+
+    Device::DeviceType device_type = values.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentReduceCPU(values, prefix_sum, dst, op_code);
+    } else {
+        utility::LogError("SegmentReduce: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
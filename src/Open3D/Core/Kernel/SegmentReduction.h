@@ -0,0 +1,58 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+enum class SegmentReductionOpCode { Sum, Mean, Min, Max, ArgMin, ArgMax };
+
+/// Reduces consecutive segments of values along dimension 0.
+///
+/// values: (N, ...).
+/// prefix_sum: Int64 (S,), the exclusive prefix sum of the segment lengths,
+/// i.e. segment i covers values[prefix_sum[i]:prefix_sum[i + 1]] and the last
+/// segment ends at N. prefix_sum[0] must be 0.
+/// dst: (S, ...), with the dtype of values for Sum/Mean/Min/Max, or Int64
+/// indices into dimension 0 of values for ArgMin/ArgMax.
+///
+/// Empty segments result in 0, or -1 for ArgMin/ArgMax.
+void SegmentReduce(const Tensor& values,
+                   const Tensor& prefix_sum,
+                   Tensor& dst,
+                   SegmentReductionOpCode op_code);
+
+void SegmentReduceCPU(const Tensor& values,
+                      const Tensor& prefix_sum,
+                      Tensor& dst,
+                      SegmentReductionOpCode op_code);
+
+}  // namespace kernel
+}  // namespace open3d
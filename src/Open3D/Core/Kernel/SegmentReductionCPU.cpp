@@ -0,0 +1,309 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/SegmentReduction.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/ParallelUtil.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Minimum number of value elements reduced per task.
+static constexpr int64_t kSegmentReductionGrainSize = 32768;
+
+/// Running reduction of one column of a segment. For Min/Max/ArgMin/ArgMax,
+/// index is the row of the selected value, or -1 if no value has been added.
+/// Ties are resolved to the smallest row.
+template <typename scalar_t, SegmentReductionOpCode op_code>
+struct CPUSegmentAccumulator {
+    scalar_t value;
+    int64_t index;
+
+    void Reset() {
+        value = static_cast<scalar_t>(0);
+        index = -1;
+    }
+
+    void Add(scalar_t v, int64_t row) {
+        switch (op_code) {
+            case SegmentReductionOpCode::Sum:
+            case SegmentReductionOpCode::Mean:
+                value += v;
+                break;
+            case SegmentReductionOpCode::Min:
+            case SegmentReductionOpCode::ArgMin:
+                if (index < 0 || v < value) {
+                    value = v;
+                    index = row;
+                }
+                break;
+            case SegmentReductionOpCode::Max:
+            case SegmentReductionOpCode::ArgMax:
+                if (index < 0 || v > value) {
+                    value = v;
+                    index = row;
+                }
+                break;
+        }
+    }
+
+    /// Merges the accumulator of the following rows of the same segment.
+    void Merge(const CPUSegmentAccumulator& other) {
+        switch (op_code) {
+            case SegmentReductionOpCode::Sum:
+            case SegmentReductionOpCode::Mean:
+                value += other.value;
+                break;
+            case SegmentReductionOpCode::Min:
+            case SegmentReductionOpCode::ArgMin:
+                if (other.index >= 0 && (index < 0 || other.value < value)) {
+                    *this = other;
+                }
+                break;
+            case SegmentReductionOpCode::Max:
+            case SegmentReductionOpCode::ArgMax:
+                if (other.index >= 0 && (index < 0 || other.value > value)) {
+                    *this = other;
+                }
+                break;
+        }
+    }
+
+    /// Writes the result for a segment of \p count rows to element \p offset
+    /// of dst, which is Int64 for ArgMin/ArgMax and scalar_t otherwise.
+    void Write(void* dst, int64_t offset, int64_t count) const {
+        switch (op_code) {
+            case SegmentReductionOpCode::ArgMin:
+            case SegmentReductionOpCode::ArgMax:
+                static_cast<int64_t*>(dst)[offset] = index;
+                break;
+            case SegmentReductionOpCode::Mean:
+                static_cast<scalar_t*>(dst)[offset] =
+                        count > 0 ? static_cast<scalar_t>(value / count)
+                                  : static_cast<scalar_t>(0);
+                break;
+            default:
+                static_cast<scalar_t*>(dst)[offset] = value;
+                break;
+        }
+    }
+};
+
+/// Reduces segments of the contiguous values, viewed as (num_rows, row_size).
+///
+/// The rows, not the segments, are split evenly among tasks, so that a few
+/// long segments do not serialize the reduction. Segments contained in a
+/// task's rows are written directly. Segments crossing task boundaries are
+/// written as partial results, which are merged in row order afterwards.
+template <typename scalar_t, SegmentReductionOpCode op_code>
+static void CPUSegmentReductionKernel(const scalar_t* values,
+                                      int64_t num_rows,
+                                      int64_t row_size,
+                                      const int64_t* prefix_sum,
+                                      int64_t num_segments,
+                                      void* dst) {
+    using Accumulator = CPUSegmentAccumulator<scalar_t, op_code>;
+    auto segment_begin = [&](int64_t s) { return prefix_sum[s]; };
+    auto segment_end = [&](int64_t s) {
+        return s + 1 < num_segments ? prefix_sum[s + 1] : num_rows;
+    };
+    auto write_segment = [&](int64_t s, const std::vector<Accumulator>& accs) {
+        int64_t count = segment_end(s) - segment_begin(s);
+        for (int64_t c = 0; c < row_size; ++c) {
+            accs[c].Write(dst, s * row_size + c, count);
+        }
+    };
+    int64_t rows_per_grain =
+            kSegmentReductionGrainSize / std::max<int64_t>(row_size, 1);
+    rows_per_grain = std::max<int64_t>(rows_per_grain, 1);
+
+    // Empty segments.
+    parallel_util::ParallelFor(
+            0, num_segments, rows_per_grain,
+            [&](int64_t s_begin, int64_t s_end) {
+                std::vector<Accumulator> accs(row_size);
+                for (Accumulator& acc : accs) {
+                    acc.Reset();
+                }
+                for (int64_t s = s_begin; s < s_end; ++s) {
+                    if (segment_begin(s) == segment_end(s)) {
+                        write_segment(s, accs);
+                    }
+                }
+            });
+    if (num_rows == 0 || num_segments == 0 || row_size == 0) {
+        return;
+    }
+
+    int64_t chunk_rows = parallel_util::GetChunkSize(num_rows, rows_per_grain);
+    int64_t num_chunks = (num_rows + chunk_rows - 1) / chunk_rows;
+    // Segments crossing chunk boundaries, at most two per chunk.
+    std::vector<std::vector<std::pair<int64_t, std::vector<Accumulator>>>>
+            partials(num_chunks);
+    parallel_util::ParallelForChunks(num_chunks, [&](int64_t chunk_idx) {
+        int64_t row_begin = chunk_idx * chunk_rows;
+        int64_t row_end = std::min(row_begin + chunk_rows, num_rows);
+        std::vector<Accumulator> accs(row_size);
+        // The last segment starting at or before row_begin.
+        int64_t s = std::upper_bound(prefix_sum, prefix_sum + num_segments,
+                                     row_begin) -
+                    prefix_sum - 1;
+        for (; s < num_segments && segment_begin(s) < row_end; ++s) {
+            int64_t begin = std::max(segment_begin(s), row_begin);
+            int64_t end = std::min(segment_end(s), row_end);
+            if (begin >= end) {
+                continue;
+            }
+            for (Accumulator& acc : accs) {
+                acc.Reset();
+            }
+            for (int64_t r = begin; r < end; ++r) {
+                const scalar_t* row = values + r * row_size;
+                for (int64_t c = 0; c < row_size; ++c) {
+                    accs[c].Add(row[c], r);
+                }
+            }
+            if (segment_begin(s) >= row_begin && segment_end(s) <= row_end) {
+                write_segment(s, accs);
+            } else {
+                partials[chunk_idx].emplace_back(s, accs);
+            }
+        }
+    });
+
+    int64_t current_segment = -1;
+    std::vector<Accumulator> merged;
+    for (const auto& chunk_partials : partials) {
+        for (const auto& partial : chunk_partials) {
+            if (partial.first != current_segment) {
+                if (current_segment >= 0) {
+                    write_segment(current_segment, merged);
+                }
+                current_segment = partial.first;
+                merged = partial.second;
+            } else {
+                for (int64_t c = 0; c < row_size; ++c) {
+                    merged[c].Merge(partial.second[c]);
+                }
+            }
+        }
+    }
+    if (current_segment >= 0) {
+        write_segment(current_segment, merged);
+    }
+}
+
+void SegmentReduceCPU(const Tensor& values,
+                      const Tensor& prefix_sum,
+                      Tensor& dst,
+                      SegmentReductionOpCode op_code) {
+    const SizeVector& shape = values.GetShapeRef();
+    int64_t num_rows = shape[0];
+    int64_t row_size = SizeVector(shape.begin() + 1, shape.end()).NumElements();
+    int64_t num_segments = prefix_sum.GetShape()[0];
+
+    Tensor prefix_sum_contiguous = prefix_sum.Contiguous();
+    const int64_t* prefix_sum_ptr =
+            static_cast<const int64_t*>(prefix_sum_contiguous.GetDataPtr());
+    if (num_segments > 0 && prefix_sum_ptr[0] != 0) {
+        utility::LogError("prefix_sum must start with 0, but got {}.",
+                          prefix_sum_ptr[0]);
+    }
+    for (int64_t s = 1; s < num_segments; ++s) {
+        if (prefix_sum_ptr[s] < prefix_sum_ptr[s - 1] ||
+            prefix_sum_ptr[s] > num_rows) {
+            utility::LogError(
+                    "prefix_sum must be non-decreasing and at most {}, but "
+                    "got {} after {}.",
+                    num_rows, prefix_sum_ptr[s], prefix_sum_ptr[s - 1]);
+        }
+    }
+
+    Tensor values_contiguous = values.Contiguous();
+    Tensor dst_contiguous =
+            dst.IsContiguous()
+                    ? dst
+                    : Tensor(dst.GetShape(), dst.GetDtype(), dst.GetDevice());
+    void* dst_ptr = dst_contiguous.GetDataPtr();
+    DISPATCH_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr =
+                static_cast<const scalar_t*>(values_contiguous.GetDataPtr());
+        switch (op_code) {
+            case SegmentReductionOpCode::Sum:
+                CPUSegmentReductionKernel<scalar_t,
+                                          SegmentReductionOpCode::Sum>(
+                        values_ptr, num_rows, row_size, prefix_sum_ptr,
+                        num_segments, dst_ptr);
+                break;
+            case SegmentReductionOpCode::Mean:
+                CPUSegmentReductionKernel<scalar_t,
+                                          SegmentReductionOpCode::Mean>(
+                        values_ptr, num_rows, row_size, prefix_sum_ptr,
+                        num_segments, dst_ptr);
+                break;
+            case SegmentReductionOpCode::Min:
+                CPUSegmentReductionKernel<scalar_t,
+                                          SegmentReductionOpCode::Min>(
+                        values_ptr, num_rows, row_size, prefix_sum_ptr,
+                        num_segments, dst_ptr);
+                break;
+            case SegmentReductionOpCode::Max:
+                CPUSegmentReductionKernel<scalar_t,
+                                          SegmentReductionOpCode::Max>(
+                        values_ptr, num_rows, row_size, prefix_sum_ptr,
+                        num_segments, dst_ptr);
+                break;
+            case SegmentReductionOpCode::ArgMin:
+                CPUSegmentReductionKernel<scalar_t,
+                                          SegmentReductionOpCode::ArgMin>(
+                        values_ptr, num_rows, row_size, prefix_sum_ptr,
+                        num_segments, dst_ptr);
+                break;
+            case SegmentReductionOpCode::ArgMax:
+                CPUSegmentReductionKernel<scalar_t,
+                                          SegmentReductionOpCode::ArgMax>(
+                        values_ptr, num_rows, row_size, prefix_sum_ptr,
+                        num_segments, dst_ptr);
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+    if (!dst.IsContiguous()) {
+        dst.AsRvalue() = dst_contiguous;
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
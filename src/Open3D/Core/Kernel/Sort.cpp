@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Sort.h"
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+static void AssertSortOutputs(const Tensor& src,
+                              const Tensor& dst_values,
+                              const Tensor& dst_indices,
+                              const SizeVector& dst_shape) {
+    if (src.GetDevice() != dst_values.GetDevice() ||
+        src.GetDevice() != dst_indices.GetDevice()) {
+        utility::LogError("Device mismatch: src {}, values {}, indices {}.",
+                          src.GetDevice().ToString(),
+                          dst_values.GetDevice().ToString(),
+                          dst_indices.GetDevice().ToString());
+    }
+    if (dst_values.GetDtype() != src.GetDtype() ||
+        dst_indices.GetDtype() != Dtype::Int64) {
+        utility::LogError(
+                "Expected values of dtype {} and Int64 indices, but got {} "
+                "and {}.",
+                DtypeUtil::ToString(src.GetDtype()),
+                DtypeUtil::ToString(dst_values.GetDtype()),
+                DtypeUtil::ToString(dst_indices.GetDtype()));
+    }
+    if (dst_values.GetShape() != dst_shape ||
+        dst_indices.GetShape() != dst_shape) {
+        utility::LogError(
+                "Expected values and indices of shape {}, but got {} and {}.",
+                dst_shape, dst_values.GetShape(), dst_indices.GetShape());
+    }
+}
+
+void Sort(const Tensor& src,
+          Tensor& dst_values,
+          Tensor& dst_indices,
+          int64_t dim,
+          bool descending) {
+    dim = shape_util::WrapDim(dim, src.NumDims());
+    AssertSortOutputs(src, dst_values, dst_indices, src.GetShape());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SortCPU(src, dst_values, dst_indices, dim, descending);
+    } else {
+        utility::LogError("Sort: Unimplemented device");
+    }
+}
+
+void TopK(const Tensor& src,
+          Tensor& dst_values,
+          Tensor& dst_indices,
+          int64_t k,
+          int64_t dim,
+          bool largest) {
+    dim = shape_util::WrapDim(dim, src.NumDims());
+    if (k < 0 || k > src.GetShape()[dim]) {
+        utility::LogError("k must be in [0, {}], but got {}.",
+                          src.GetShape()[dim], k);
+    }
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[dim] = k;
+    AssertSortOutputs(src, dst_values, dst_indices, dst_shape);
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        TopKCPU(src, dst_values, dst_indices, k, dim, largest);
+    } else {
+        utility::LogError("TopK: Unimplemented device");
+    }
+}
+
+std::tuple<Tensor, Tensor, Tensor> Unique(const Tensor& src) {
+    if (src.NumDims() == 0) {
+        utility::LogError("Unique expects a tensor with at least 1 dimension.");
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type != Device::DeviceType::CPU) {
+        utility::LogError("Unique: Unimplemented device");
+    }
+    return UniqueCPU(src);
+}
+
+}  // namespace kernel
+}  // namespace open3d
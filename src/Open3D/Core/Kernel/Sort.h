@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tuple>
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Stable sort of src along dim. dst_values has the shape and dtype of src,
+/// dst_indices is Int64 with the shape of src and holds the positions along
+/// dim of the sorted elements. NaNs are sorted after all other values in
+/// both orders.
+void Sort(const Tensor& src,
+          Tensor& dst_values,
+          Tensor& dst_indices,
+          int64_t dim,
+          bool descending);
+
+/// The k largest (or smallest) elements of src along dim, sorted. dst_values
+/// and dst_indices (Int64) have the shape of src, except for size k at dim.
+/// Ties are resolved to the smallest index and NaNs are ranked after all
+/// other values.
+void TopK(const Tensor& src,
+          Tensor& dst_values,
+          Tensor& dst_indices,
+          int64_t k,
+          int64_t dim,
+          bool largest);
+
+/// Unique rows of src along dimension 0 in ascending lexicographic order, or
+/// unique elements for a 1D src.
+///
+/// \return A tuple of the unique rows (U, ...), the Int64 inverse indices
+/// (N,) such that unique[inverse_indices] == src, and the Int64 counts (U,)
+/// of each unique row.
+std::tuple<Tensor, Tensor, Tensor> Unique(const Tensor& src);
+
+void SortCPU(const Tensor& src,
+             Tensor& dst_values,
+             Tensor& dst_indices,
+             int64_t dim,
+             bool descending);
+
+void TopKCPU(const Tensor& src,
+             Tensor& dst_values,
+             Tensor& dst_indices,
+             int64_t k,
+             int64_t dim,
+             bool largest);
+
+std::tuple<Tensor, Tensor, Tensor> UniqueCPU(const Tensor& src);
+
+}  // namespace kernel
+}  // namespace open3d
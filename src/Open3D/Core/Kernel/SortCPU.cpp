@@ -0,0 +1,473 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Sort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Kernel/RadixSort.h"
+#include "Open3D/Core/ParallelUtil.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Arrays shorter than this are sorted with std::stable_sort instead of the
+/// radix sort.
+static constexpr int64_t kRadixSortMinSize = 1024;
+
+/// Minimum number of elements processed per task.
+static constexpr int64_t kSortGrainSize = 32768;
+
+/// Maps values to unsigned keys with the same order, such that all dtypes are
+/// sorted by the same radix sort on the key bits. For floating point values,
+/// -0.0 and 0.0 map to the same key and NaNs map to the largest key.
+template <typename scalar_t>
+struct SortKey {};
+
+template <>
+struct SortKey<float> {
+    typedef uint32_t type;
+    static uint32_t Get(float v) {
+        if (std::isnan(v)) {
+            return std::numeric_limits<uint32_t>::max();
+        }
+        if (v == 0) {
+            v = 0;
+        }
+        uint32_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+};
+
+template <>
+struct SortKey<double> {
+    typedef uint64_t type;
+    static uint64_t Get(double v) {
+        if (std::isnan(v)) {
+            return std::numeric_limits<uint64_t>::max();
+        }
+        if (v == 0) {
+            v = 0;
+        }
+        uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        return (bits & 0x8000000000000000ull) ? ~bits
+                                              : (bits | 0x8000000000000000ull);
+    }
+};
+
+template <>
+struct SortKey<int32_t> {
+    typedef uint32_t type;
+    static uint32_t Get(int32_t v) {
+        return static_cast<uint32_t>(v) ^ 0x80000000u;
+    }
+};
+
+template <>
+struct SortKey<int64_t> {
+    typedef uint64_t type;
+    static uint64_t Get(int64_t v) {
+        return static_cast<uint64_t>(v) ^ 0x8000000000000000ull;
+    }
+};
+
+template <>
+struct SortKey<uint8_t> {
+    typedef uint8_t type;
+    static uint8_t Get(uint8_t v) { return v; }
+};
+
+template <>
+struct SortKey<Half> {
+    typedef uint16_t type;
+    static uint16_t Get(Half v) {
+        uint16_t bits = v.GetBits();
+        if ((bits & 0x7FFF) > 0x7C00) {
+            return std::numeric_limits<uint16_t>::max();
+        }
+        if (bits == 0x8000) {
+            bits = 0;
+        }
+        return (bits & 0x8000) ? static_cast<uint16_t>(~bits)
+                               : static_cast<uint16_t>(bits | 0x8000);
+    }
+};
+
+template <>
+struct SortKey<int8_t> {
+    typedef uint8_t type;
+    static uint8_t Get(int8_t v) { return static_cast<uint8_t>(v) ^ 0x80; }
+};
+
+template <>
+struct SortKey<int16_t> {
+    typedef uint16_t type;
+    static uint16_t Get(int16_t v) {
+        return static_cast<uint16_t>(v) ^ 0x8000;
+    }
+};
+
+template <>
+struct SortKey<uint16_t> {
+    typedef uint16_t type;
+    static uint16_t Get(uint16_t v) { return v; }
+};
+
+template <>
+struct SortKey<bool> {
+    typedef uint8_t type;
+    static uint8_t Get(bool v) { return static_cast<uint8_t>(v); }
+};
+
+/// Whether \p v is a NaN. Only floating point dtypes have NaNs.
+template <typename scalar_t>
+static bool IsNaN(scalar_t v) {
+    return false;
+}
+
+static bool IsNaN(float v) { return std::isnan(v); }
+
+static bool IsNaN(double v) { return std::isnan(v); }
+
+static bool IsNaN(Half v) { return (v.GetBits() & 0x7FFF) > 0x7C00; }
+
+/// Returns the key of \p v for sorting in ascending or descending order.
+/// Descending order flips the keys of all values but NaNs, so that NaNs keep
+/// the largest key and are sorted last in both orders.
+template <typename scalar_t>
+static typename SortKey<scalar_t>::type GetOrderedKey(scalar_t v,
+                                                      bool descending) {
+    using key_t = typename SortKey<scalar_t>::type;
+    key_t key = SortKey<scalar_t>::Get(v);
+    return descending && !IsNaN(v) ? static_cast<key_t>(~key) : key;
+}
+
+/// Stable sort of (keys, values) pairs by keys.
+template <typename key_t>
+static void SortPairs(std::vector<key_t>& keys,
+                      std::vector<int64_t>& values,
+                      bool parallel) {
+    const int64_t n = static_cast<int64_t>(keys.size());
+    if (n >= kRadixSortMinSize) {
+        RadixSortPairs(keys, values, parallel);
+        return;
+    }
+    std::vector<int64_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::stable_sort(perm.begin(), perm.end(), [&](int64_t a, int64_t b) {
+        return keys[a] < keys[b];
+    });
+    std::vector<key_t> sorted_keys(n);
+    std::vector<int64_t> sorted_values(n);
+    for (int64_t i = 0; i < n; ++i) {
+        sorted_keys[i] = keys[perm[i]];
+        sorted_values[i] = values[perm[i]];
+    }
+    keys.swap(sorted_keys);
+    values.swap(sorted_values);
+}
+
+/// Calls \p line_func(line_idx, parallel) for each of num_lines lines of
+/// len elements. With enough lines, each line is processed by one task.
+/// Otherwise lines are processed one after another, each in parallel.
+template <typename func_t>
+static void LaunchLines(int64_t num_lines, int64_t len, func_t line_func) {
+    if (num_lines >= parallel_util::GetNumThreads()) {
+        int64_t grain_size = std::max<int64_t>(
+                kSortGrainSize / std::max<int64_t>(len, 1), 1);
+        parallel_util::ParallelFor(0, num_lines, grain_size,
+                                   [&](int64_t begin, int64_t end) {
+                                       for (int64_t l = begin; l < end; ++l) {
+                                           line_func(l, false);
+                                       }
+                                   });
+    } else {
+        for (int64_t l = 0; l < num_lines; ++l) {
+            line_func(l, true);
+        }
+    }
+}
+
+template <typename scalar_t>
+static void CPUSortLine(const scalar_t* src,
+                        int64_t len,
+                        bool descending,
+                        bool parallel,
+                        scalar_t* dst_values,
+                        int64_t* dst_indices) {
+    using key_t = typename SortKey<scalar_t>::type;
+    std::vector<key_t> keys(len);
+    std::vector<int64_t> indices(len);
+    for (int64_t i = 0; i < len; ++i) {
+        keys[i] = GetOrderedKey(src[i], descending);
+        indices[i] = i;
+    }
+    SortPairs(keys, indices, parallel);
+    for (int64_t i = 0; i < len; ++i) {
+        dst_indices[i] = indices[i];
+        dst_values[i] = src[indices[i]];
+    }
+}
+
+/// Selects the k best elements with nth_element, first within chunks of the
+/// line in parallel and then among the candidates of all chunks.
+template <typename scalar_t>
+static void CPUTopKLine(const scalar_t* src,
+                        int64_t len,
+                        int64_t k,
+                        bool largest,
+                        bool parallel,
+                        scalar_t* dst_values,
+                        int64_t* dst_indices) {
+    using key_t = typename SortKey<scalar_t>::type;
+    auto less = [&](int64_t a, int64_t b) {
+        key_t key_a = GetOrderedKey(src[a], largest);
+        key_t key_b = GetOrderedKey(src[b], largest);
+        return key_a < key_b || (key_a == key_b && a < b);
+    };
+
+    std::vector<int64_t> candidates;
+    int64_t chunk_size =
+            parallel ? parallel_util::GetChunkSize(len, kSortGrainSize) : len;
+    int64_t num_chunks = (len + chunk_size - 1) / chunk_size;
+    if (num_chunks > 1 && k < chunk_size) {
+        std::vector<std::vector<int64_t>> chunk_candidates(num_chunks);
+        parallel_util::ParallelForChunks(num_chunks, [&](int64_t chunk_idx) {
+            int64_t begin = chunk_idx * chunk_size;
+            int64_t end = std::min(begin + chunk_size, len);
+            std::vector<int64_t>& indices = chunk_candidates[chunk_idx];
+            indices.resize(end - begin);
+            std::iota(indices.begin(), indices.end(), begin);
+            int64_t m = std::min(k, end - begin);
+            std::nth_element(indices.begin(), indices.begin() + m,
+                             indices.end(), less);
+            indices.resize(m);
+        });
+        for (const std::vector<int64_t>& indices : chunk_candidates) {
+            candidates.insert(candidates.end(), indices.begin(),
+                              indices.end());
+        }
+    } else {
+        candidates.resize(len);
+        std::iota(candidates.begin(), candidates.end(), 0);
+    }
+    std::partial_sort(candidates.begin(), candidates.begin() + k,
+                      candidates.end(), less);
+    for (int64_t i = 0; i < k; ++i) {
+        dst_indices[i] = candidates[i];
+        dst_values[i] = src[candidates[i]];
+    }
+}
+
+void SortCPU(const Tensor& src,
+             Tensor& dst_values,
+             Tensor& dst_indices,
+             int64_t dim,
+             bool descending) {
+    // Sort contiguous lines along the last dimension.
+    int64_t last_dim = src.NumDims() - 1;
+    int64_t len = src.GetShape()[dim];
+    int64_t num_lines = len == 0 ? 0 : src.NumElements() / len;
+    bool direct = dim == last_dim && dst_values.IsContiguous() &&
+                  dst_indices.IsContiguous();
+    Tensor src_lines = src.Transpose(dim, last_dim).Contiguous();
+    Tensor values_lines =
+            direct ? dst_values
+                   : Tensor(src_lines.GetShape(), src.GetDtype(),
+                            src.GetDevice());
+    Tensor indices_lines =
+            direct ? dst_indices
+                   : Tensor(src_lines.GetShape(), Dtype::Int64,
+                            src.GetDevice());
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_lines.GetDataPtr());
+        scalar_t* values_ptr =
+                static_cast<scalar_t*>(values_lines.GetDataPtr());
+        int64_t* indices_ptr =
+                static_cast<int64_t*>(indices_lines.GetDataPtr());
+        LaunchLines(num_lines, len, [&](int64_t l, bool parallel) {
+            CPUSortLine(src_ptr + l * len, len, descending, parallel,
+                        values_ptr + l * len, indices_ptr + l * len);
+        });
+    });
+
+    if (!direct) {
+        dst_values.AsRvalue() = values_lines.Transpose(dim, last_dim);
+        dst_indices.AsRvalue() = indices_lines.Transpose(dim, last_dim);
+    }
+}
+
+void TopKCPU(const Tensor& src,
+             Tensor& dst_values,
+             Tensor& dst_indices,
+             int64_t k,
+             int64_t dim,
+             bool largest) {
+    int64_t last_dim = src.NumDims() - 1;
+    int64_t len = src.GetShape()[dim];
+    int64_t num_lines = len == 0 ? 0 : src.NumElements() / len;
+    Tensor src_lines = src.Transpose(dim, last_dim).Contiguous();
+    SizeVector dst_lines_shape = src_lines.GetShape();
+    dst_lines_shape[last_dim] = k;
+    Tensor values_lines(dst_lines_shape, src.GetDtype(), src.GetDevice());
+    Tensor indices_lines(dst_lines_shape, Dtype::Int64, src.GetDevice());
+    if (k == 0) {
+        return;
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_lines.GetDataPtr());
+        scalar_t* values_ptr =
+                static_cast<scalar_t*>(values_lines.GetDataPtr());
+        int64_t* indices_ptr =
+                static_cast<int64_t*>(indices_lines.GetDataPtr());
+        LaunchLines(num_lines, len, [&](int64_t l, bool parallel) {
+            CPUTopKLine(src_ptr + l * len, len, k, largest, parallel,
+                        values_ptr + l * k, indices_ptr + l * k);
+        });
+    });
+
+    dst_values.AsRvalue() = values_lines.Transpose(dim, last_dim);
+    dst_indices.AsRvalue() = indices_lines.Transpose(dim, last_dim);
+}
+
+/// Sorts the rows of src lexicographically with one stable sort per column,
+/// from the last column to the first, and then marks the first row of each
+/// group of equal rows.
+template <typename scalar_t>
+static void CPUUniqueRows(const scalar_t* src,
+                          int64_t num_rows,
+                          int64_t row_size,
+                          int64_t* inverse_indices,
+                          std::vector<int64_t>& first_rows,
+                          std::vector<int64_t>& counts) {
+    using key_t = typename SortKey<scalar_t>::type;
+    auto key = [&](int64_t row, int64_t col) {
+        return SortKey<scalar_t>::Get(src[row * row_size + col]);
+    };
+
+    std::vector<int64_t> order(num_rows);
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<key_t> keys(num_rows);
+    for (int64_t col = row_size - 1; col >= 0; --col) {
+        parallel_util::ParallelFor(
+                0, num_rows, kSortGrainSize, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = begin; i < end; ++i) {
+                        keys[i] = key(order[i], col);
+                    }
+                });
+        SortPairs(keys, order, true);
+    }
+
+    std::vector<int64_t> is_new(num_rows);
+    parallel_util::ParallelFor(
+            0, num_rows, kSortGrainSize, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    is_new[i] = i == 0;
+                    for (int64_t col = 0; col < row_size && !is_new[i];
+                         ++col) {
+                        is_new[i] = key(order[i - 1], col) !=
+                                    key(order[i], col);
+                    }
+                }
+            });
+
+    // Inclusive scan of is_new gives the unique index + 1 of each sorted row.
+    std::vector<int64_t> unique_ids(num_rows);
+    int64_t num_unique = parallel_util::ParallelScan(
+            int64_t(0), num_rows, kSortGrainSize, int64_t(0),
+            [&](int64_t begin, int64_t end, int64_t prefix, bool is_final) {
+                for (int64_t i = begin; i < end; ++i) {
+                    prefix += is_new[i];
+                    if (is_final) {
+                        unique_ids[i] = prefix - 1;
+                    }
+                }
+                return prefix;
+            },
+            [](int64_t a, int64_t b) { return a + b; });
+
+    first_rows.resize(num_unique);
+    std::vector<int64_t> group_begins(num_unique + 1, num_rows);
+    parallel_util::ParallelFor(
+            0, num_rows, kSortGrainSize, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    inverse_indices[order[i]] = unique_ids[i];
+                    if (is_new[i]) {
+                        group_begins[unique_ids[i]] = i;
+                        first_rows[unique_ids[i]] = order[i];
+                    }
+                }
+            });
+    counts.resize(num_unique);
+    for (int64_t u = 0; u < num_unique; ++u) {
+        counts[u] = group_begins[u + 1] - group_begins[u];
+    }
+}
+
+std::tuple<Tensor, Tensor, Tensor> UniqueCPU(const Tensor& src) {
+    const SizeVector& shape = src.GetShapeRef();
+    int64_t num_rows = shape[0];
+    int64_t row_size = SizeVector(shape.begin() + 1, shape.end()).NumElements();
+    Tensor src_contiguous = src.Contiguous();
+
+    Tensor inverse_indices({num_rows}, Dtype::Int64, src.GetDevice());
+    std::vector<int64_t> first_rows;
+    std::vector<int64_t> counts;
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        CPUUniqueRows(static_cast<const scalar_t*>(src_contiguous.GetDataPtr()),
+                      num_rows, row_size,
+                      static_cast<int64_t*>(inverse_indices.GetDataPtr()),
+                      first_rows, counts);
+    });
+
+    int64_t num_unique = static_cast<int64_t>(first_rows.size());
+    Tensor unique;
+    if (num_unique == 0) {
+        unique = src_contiguous;
+    } else {
+        unique = src_contiguous.IndexGet({Tensor(
+                first_rows, {num_unique}, Dtype::Int64, src.GetDevice())});
+    }
+    Tensor counts_tensor(counts, {num_unique}, Dtype::Int64, src.GetDevice());
+    return std::make_tuple(unique, inverse_indices, counts_tensor);
+}
+
+}  // namespace kernel
+}  // namespace open3d
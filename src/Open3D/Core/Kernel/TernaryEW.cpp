@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/TernaryEW.h"
+
+#include "Open3D/Core/Profiler.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+static const char* GetOpName(TernaryEWOpCode op_code) {
+    switch (op_code) {
+        case TernaryEWOpCode::Where:
+            return "Where";
+        case TernaryEWOpCode::Clamp:
+            return "Clamp";
+    }
+    return "TernaryEW";
+}
+
+void TernaryEW(const Tensor& src0,
+               const Tensor& src1,
+               const Tensor& src2,
+               Tensor& dst,
+               TernaryEWOpCode op_code) {
+    ProfilerScope scope(GetOpName(op_code), {src0, src1, src2, dst});
+
+    // All inputs and dst must be on the same device.
+    for (const Tensor* src : {&src0, &src1, &src2}) {
+        if (src->GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              src->GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+    }
+
+    // Where selects between src1 and src2 with a Bool src0, Clamp bounds src0
+    // by src1 and src2. The selected or bounded values have dst's dtype.
+    Dtype dst_dtype = dst.GetDtype();
+    Dtype expected_src0_dtype =
+            op_code == TernaryEWOpCode::Where ? Dtype::Bool : dst_dtype;
+    if (src0.GetDtype() != expected_src0_dtype) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          DtypeUtil::ToString(src0.GetDtype()),
+                          DtypeUtil::ToString(expected_src0_dtype));
+    }
+    for (const Tensor* src : {&src1, &src2}) {
+        if (src->GetDtype() != dst_dtype) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              DtypeUtil::ToString(src->GetDtype()),
+                              DtypeUtil::ToString(dst_dtype));
+        }
+    }
+
+    // broadcast(src0.shape, src1.shape, src2.shape) must be dst.shape.
+    const SizeVector broadcasted_input_shape = shape_util::BroadcastedShape(
+            shape_util::BroadcastedShape(src0.GetShape(), src1.GetShape()),
+            src2.GetShape());
+    if (broadcasted_input_shape != dst.GetShape()) {
+        utility::LogError(
+                "The broadcasted input shape {} does not match the output "
+                "shape {}.",
+                broadcasted_input_shape, dst.GetShape());
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        TernaryEWCPU(src0, src1, src2, dst, op_code);
+    } else {
+        utility::LogError("TernaryEW: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Element-wise ops with three inputs, which are broadcasted to the output
+/// shape.
+///
+/// Where: dst = inputs[0] ? inputs[1] : inputs[2], where inputs[0] is Bool.
+/// Clamp: dst = min(max(inputs[0], inputs[1]), inputs[2]). NaNs in
+/// inputs[0] are propagated.
+enum class TernaryEWOpCode { Where, Clamp };
+
+void TernaryEW(const Tensor& src0,
+               const Tensor& src1,
+               const Tensor& src2,
+               Tensor& dst,
+               TernaryEWOpCode op_code);
+
+void TernaryEWCPU(const Tensor& src0,
+                  const Tensor& src1,
+                  const Tensor& src2,
+                  Tensor& dst,
+                  TernaryEWOpCode op_code);
+
+inline void Where(const Tensor& condition,
+                  const Tensor& x,
+                  const Tensor& y,
+                  Tensor& dst) {
+    TernaryEW(condition, x, y, dst, TernaryEWOpCode::Where);
+}
+
+inline void Clamp(const Tensor& src,
+                  const Tensor& min_val,
+                  const Tensor& max_val,
+                  Tensor& dst) {
+    TernaryEW(src, min_val, max_val, dst, TernaryEWOpCode::Clamp);
+}
+
+}  // namespace kernel
+}  // namespace open3d
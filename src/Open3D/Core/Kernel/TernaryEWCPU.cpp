@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/TernaryEW.h"
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/Kernel/CPULauncher.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+template <typename scalar_t>
+static scalar_t CPUClampElement(scalar_t x,
+                                scalar_t min_val,
+                                scalar_t max_val) {
+    // Written such that a NaN x is propagated.
+    scalar_t lower_bounded = min_val > x ? min_val : x;
+    return max_val < lower_bounded ? max_val : lower_bounded;
+}
+
+// Clamps by fixed bounds, used when both bounds are broadcasted elements. Also
+// works on simd::Vec<scalar_t>.
+template <typename scalar_t>
+struct CPUClampFunctor {
+    scalar_t operator()(scalar_t x) const {
+        return CPUClampElement(x, min_val_, max_val_);
+    }
+    simd::Vec<scalar_t> operator()(const simd::Vec<scalar_t>& x) const {
+        using Vec = simd::Vec<scalar_t>;
+        return Vec::Broadcast(max_val_).Min(Vec::Broadcast(min_val_).Max(x));
+    }
+
+    scalar_t min_val_;
+    scalar_t max_val_;
+};
+
+static void WhereCPU(const Tensor& condition,
+                     const Tensor& x,
+                     const Tensor& y,
+                     Tensor& dst) {
+    Indexer indexer({condition, x, y}, dst, DtypePolicy::NONE);
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst.GetDtype(), [&]() {
+        auto element_op = [](bool c, scalar_t x_val, scalar_t y_val) {
+            return c ? x_val : y_val;
+        };
+        if (!CPULauncher::TryLaunchTernaryEWKernelContiguous<
+                    bool, scalar_t, scalar_t, scalar_t>(indexer, element_op)) {
+            CPULauncher::LaunchIndexerKernel<3>(
+                    indexer, [&](char* const* input_ptrs, char* output_ptr) {
+                        *reinterpret_cast<scalar_t*>(output_ptr) = element_op(
+                                *reinterpret_cast<const bool*>(input_ptrs[0]),
+                                *reinterpret_cast<const scalar_t*>(
+                                        input_ptrs[1]),
+                                *reinterpret_cast<const scalar_t*>(
+                                        input_ptrs[2]));
+                    });
+        }
+    });
+}
+
+static void ClampCPU(const Tensor& src,
+                     const Tensor& min_val,
+                     const Tensor& max_val,
+                     Tensor& dst) {
+    Indexer indexer({src, min_val, max_val}, dst, DtypePolicy::ALL_SAME);
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        // Scalar bounds, e.g. clamping depth to [min_depth, max_depth], take
+        // the vectorized unary path, which only reads input 0 of the indexer.
+        if (indexer.NumWorkloads() > 0 && indexer.IsInputScalar(1) &&
+            indexer.IsInputScalar(2)) {
+            CPUClampFunctor<scalar_t> functor{
+                    *reinterpret_cast<const scalar_t*>(
+                            indexer.GetInputPtr(1, 0)),
+                    *reinterpret_cast<const scalar_t*>(
+                            indexer.GetInputPtr(2, 0))};
+            if (CPULauncher::TryLaunchUnaryEWKernelVectorized<scalar_t>(
+                        indexer, functor)) {
+                return;
+            }
+        }
+        if (!CPULauncher::TryLaunchTernaryEWKernelContiguous<
+                    scalar_t, scalar_t, scalar_t, scalar_t>(
+                    indexer, CPUClampElement<scalar_t>)) {
+            CPULauncher::LaunchIndexerKernel<3>(
+                    indexer, [](char* const* input_ptrs, char* output_ptr) {
+                        *reinterpret_cast<scalar_t*>(output_ptr) =
+                                CPUClampElement(
+                                        *reinterpret_cast<const scalar_t*>(
+                                                input_ptrs[0]),
+                                        *reinterpret_cast<const scalar_t*>(
+                                                input_ptrs[1]),
+                                        *reinterpret_cast<const scalar_t*>(
+                                                input_ptrs[2]));
+                    });
+        }
+    });
+}
+
+void TernaryEWCPU(const Tensor& src0,
+                  const Tensor& src1,
+                  const Tensor& src2,
+                  Tensor& dst,
+                  TernaryEWOpCode op_code) {
+    switch (op_code) {
+        case TernaryEWOpCode::Where:
+            WhereCPU(src0, src1, src2, dst);
+            break;
+        case TernaryEWOpCode::Clamp:
+            ClampCPU(src0, src1, src2, dst);
+            break;
+        default:
+            utility::LogError("Unimplemented op_code for TernaryEWCPU");
+            break;
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
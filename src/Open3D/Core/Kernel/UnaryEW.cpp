@@ -26,6 +26,7 @@
 
 #include "Open3D/Core/Kernel/UnaryEW.h"
 
+#include "Open3D/Core/Profiler.h"
 #include "Open3D/Core/ShapeUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
@@ -33,7 +34,33 @@
 namespace open3d {
 namespace kernel {
 
+static const char* GetOpName(UnaryEWOpCode op_code) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            return "Sqrt";
+        case UnaryEWOpCode::Sin:
+            return "Sin";
+        case UnaryEWOpCode::Cos:
+            return "Cos";
+        case UnaryEWOpCode::Neg:
+            return "Neg";
+        case UnaryEWOpCode::Exp:
+            return "Exp";
+        case UnaryEWOpCode::Abs:
+            return "Abs";
+        case UnaryEWOpCode::Floor:
+            return "Floor";
+        case UnaryEWOpCode::Log:
+            return "Log";
+        case UnaryEWOpCode::LogicalNot:
+            return "LogicalNot";
+    }
+    return "UnaryEW";
+}
+
 void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
+    ProfilerScope scope(GetOpName(op_code), {src, dst});
+
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
         utility::LogError("Shape {} can not be broadcasted to {}.",
@@ -62,6 +89,8 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 }
 
 void Copy(const Tensor& src, Tensor& dst) {
+    ProfilerScope scope("Copy", {src, dst});
+
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
         utility::LogError("Shape {} can not be broadcasted to {}.",
@@ -32,7 +32,17 @@
 namespace open3d {
 namespace kernel {
 
-enum class UnaryEWOpCode { Sqrt, Sin, Cos, Neg, Exp, Abs, LogicalNot };
+enum class UnaryEWOpCode {
+    Sqrt,
+    Sin,
+    Cos,
+    Neg,
+    Exp,
+    Abs,
+    Floor,
+    Log,
+    LogicalNot
+};
 
 void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code);
 
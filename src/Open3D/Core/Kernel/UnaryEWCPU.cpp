@@ -81,6 +81,49 @@ static void CPUAbsElementKernel(const void* src, void* dst) {
             std::abs(static_cast<double>(*static_cast<const scalar_t*>(src))));
 }
 
+template <typename scalar_t>
+static void CPUFloorElementKernel(const void* src, void* dst) {
+    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
+            std::floor(*static_cast<const scalar_t*>(src)));
+}
+
+template <typename scalar_t>
+static void CPULogElementKernel(const void* src, void* dst) {
+    *static_cast<scalar_t*>(dst) =
+            static_cast<scalar_t>(std::log(*static_cast<const scalar_t*>(src)));
+}
+
+// Element-wise operators for the contiguous fast paths. CPUSqrtFunctor,
+// CPUNegFunctor and CPUAbsFunctor also work on simd::Vec<scalar_t>.
+struct CPUSqrtFunctor {
+    template <typename scalar_t>
+    scalar_t operator()(scalar_t x) const {
+        return static_cast<scalar_t>(std::sqrt(x));
+    }
+    template <typename scalar_t>
+    simd::Vec<scalar_t> operator()(const simd::Vec<scalar_t>& x) const {
+        return x.Sqrt();
+    }
+};
+
+struct CPUNegFunctor {
+    template <typename T>
+    T operator()(const T& x) const {
+        return static_cast<T>(-x);
+    }
+};
+
+struct CPUAbsFunctor {
+    template <typename scalar_t>
+    scalar_t operator()(scalar_t x) const {
+        return static_cast<scalar_t>(std::abs(static_cast<double>(x)));
+    }
+    template <typename scalar_t>
+    simd::Vec<scalar_t> operator()(const simd::Vec<scalar_t>& x) const {
+        return x.Abs();
+    }
+};
+
 template <typename src_t, typename dst_t>
 static void CPULogicalNotElementKernel(const void* src, void* dst) {
     *static_cast<dst_t*>(dst) = static_cast<dst_t>(
@@ -104,8 +147,14 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
             using src_t = scalar_t;
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
                 using dst_t = scalar_t;
-                CPULauncher::LaunchUnaryEWKernel(
-                        indexer, CPUCopyElementKernel<src_t, dst_t>);
+                if (!CPULauncher::TryLaunchUnaryEWKernelContiguous<src_t,
+                                                                   dst_t>(
+                            indexer, [](src_t x) {
+                                return static_cast<dst_t>(x);
+                            })) {
+                    CPULauncher::LaunchUnaryEWKernel(
+                            indexer, CPUCopyElementKernel<src_t, dst_t>);
+                }
             });
         });
     }
@@ -116,14 +165,28 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype src_dtype = src.GetDtype();
     Dtype dst_dtype = dst.GetDtype();
 
+    // Float16 is computed in float and rounded back to Float16.
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     DtypeUtil::ToString(dtype));
         }
     };
 
+    if (op_code == UnaryEWOpCode::Floor && src_dtype != Dtype::Float16 &&
+        src_dtype != Dtype::Float32 && src_dtype != Dtype::Float64) {
+        // Integer values are already whole, so floor is a plain copy.
+        bool is_inplace = src.GetDataPtr() == dst.GetDataPtr() &&
+                          src.GetStrides() == dst.GetStrides();
+        if (!is_inplace) {
+            CopyCPU(src, dst);
+        }
+        return;
+    }
+
     if (op_code == UnaryEWOpCode::LogicalNot) {
         DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
@@ -148,31 +211,74 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSqrtElementKernel<scalar_t>);
+                    if (!CPULauncher::TryLaunchUnaryEWKernelVectorized<
+                                scalar_t>(indexer, CPUSqrtFunctor())) {
+                        CPULauncher::LaunchUnaryEWKernel(
+                                indexer, CPUSqrtElementKernel<scalar_t>);
+                    }
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSinElementKernel<scalar_t>);
+                    if (!CPULauncher::TryLaunchUnaryEWKernelContiguous<
+                                scalar_t, scalar_t>(indexer, [](scalar_t x) {
+                            return static_cast<scalar_t>(std::sin(x));
+                        })) {
+                        CPULauncher::LaunchUnaryEWKernel(
+                                indexer, CPUSinElementKernel<scalar_t>);
+                    }
                     break;
                 case UnaryEWOpCode::Cos:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUCosElementKernel<scalar_t>);
+                    if (!CPULauncher::TryLaunchUnaryEWKernelContiguous<
+                                scalar_t, scalar_t>(indexer, [](scalar_t x) {
+                            return static_cast<scalar_t>(std::cos(x));
+                        })) {
+                        CPULauncher::LaunchUnaryEWKernel(
+                                indexer, CPUCosElementKernel<scalar_t>);
+                    }
                     break;
                 case UnaryEWOpCode::Neg:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUNegElementKernel<scalar_t>);
+                    if (!CPULauncher::TryLaunchUnaryEWKernelVectorized<
+                                scalar_t>(indexer, CPUNegFunctor())) {
+                        CPULauncher::LaunchUnaryEWKernel(
+                                indexer, CPUNegElementKernel<scalar_t>);
+                    }
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUExpElementKernel<scalar_t>);
+                    if (!CPULauncher::TryLaunchUnaryEWKernelContiguous<
+                                scalar_t, scalar_t>(indexer, [](scalar_t x) {
+                            return static_cast<scalar_t>(std::exp(x));
+                        })) {
+                        CPULauncher::LaunchUnaryEWKernel(
+                                indexer, CPUExpElementKernel<scalar_t>);
+                    }
                     break;
                 case UnaryEWOpCode::Abs:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUAbsElementKernel<scalar_t>);
+                    if (!CPULauncher::TryLaunchUnaryEWKernelVectorized<
+                                scalar_t>(indexer, CPUAbsFunctor())) {
+                        CPULauncher::LaunchUnaryEWKernel(
+                                indexer, CPUAbsElementKernel<scalar_t>);
+                    }
+                    break;
+                case UnaryEWOpCode::Floor:
+                    if (!CPULauncher::TryLaunchUnaryEWKernelContiguous<
+                                scalar_t, scalar_t>(indexer, [](scalar_t x) {
+                            return static_cast<scalar_t>(std::floor(x));
+                        })) {
+                        CPULauncher::LaunchUnaryEWKernel(
+                                indexer, CPUFloorElementKernel<scalar_t>);
+                    }
+                    break;
+                case UnaryEWOpCode::Log:
+                    assert_dtype_is_float(src_dtype);
+                    if (!CPULauncher::TryLaunchUnaryEWKernelContiguous<
+                                scalar_t, scalar_t>(indexer, [](scalar_t x) {
+                            return static_cast<scalar_t>(std::log(x));
+                        })) {
+                        CPULauncher::LaunchUnaryEWKernel(
+                                indexer, CPULogElementKernel<scalar_t>);
+                    }
                     break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCPU");
@@ -83,6 +83,20 @@ static OPEN3D_HOST_DEVICE void CUDAAbsElementKernel(const void* src,
             abs(static_cast<double>(*static_cast<const scalar_t*>(src))));
 }
 
+template <typename scalar_t>
+static OPEN3D_HOST_DEVICE void CUDAFloorElementKernel(const void* src,
+                                                      void* dst) {
+    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
+            floor(static_cast<double>(*static_cast<const scalar_t*>(src))));
+}
+
+template <typename scalar_t>
+static OPEN3D_HOST_DEVICE void CUDALogElementKernel(const void* src,
+                                                    void* dst) {
+    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
+            log(static_cast<double>(*static_cast<const scalar_t*>(src))));
+}
+
 template <typename src_t, typename dst_t>
 static OPEN3D_HOST_DEVICE void CUDALogicalNotElementKernel(const void* src,
                                                            void* dst) {
@@ -155,14 +169,28 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype src_dtype = src.GetDtype();
     Dtype dst_dtype = dst.GetDtype();
 
+    // Float16 is computed in double and rounded back to Float16.
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype != Dtype::Float16 && dtype != Dtype::Float32 &&
+            dtype != Dtype::Float64) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     DtypeUtil::ToString(dtype));
         }
     };
 
+    if (op_code == UnaryEWOpCode::Floor && src_dtype != Dtype::Float16 &&
+        src_dtype != Dtype::Float32 && src_dtype != Dtype::Float64) {
+        // Integer values are already whole, so floor is a plain copy.
+        bool is_inplace = src.GetDataPtr() == dst.GetDataPtr() &&
+                          src.GetStrides() == dst.GetStrides();
+        if (!is_inplace) {
+            CopyCUDA(src, dst);
+        }
+        return;
+    }
+
     if (op_code == UnaryEWOpCode::LogicalNot) {
         DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
@@ -238,6 +266,21 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                                 CUDAAbsElementKernel<scalar_t>(src, dst);
                             });
                     break;
+                case UnaryEWOpCode::Floor:
+                    CUDALauncher::LaunchUnaryEWKernel(
+                            indexer,
+                            [] OPEN3D_HOST_DEVICE(const void* src, void* dst) {
+                                CUDAFloorElementKernel<scalar_t>(src, dst);
+                            });
+                    break;
+                case UnaryEWOpCode::Log:
+                    assert_dtype_is_float(src_dtype);
+                    CUDALauncher::LaunchUnaryEWKernel(
+                            indexer,
+                            [] OPEN3D_HOST_DEVICE(const void* src, void* dst) {
+                                CUDALogElementKernel<scalar_t>(src, dst);
+                            });
+                    break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCUDA");
                     break;
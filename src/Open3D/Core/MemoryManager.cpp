@@ -26,22 +26,47 @@
 
 #include "Open3D/Core/MemoryManager.h"
 
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <unordered_map>
 
 #include "Open3D/Core/Blob.h"
 #include "Open3D/Core/Device.h"
+#include "Open3D/Core/Profiler.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 
+// Number of Device::DeviceType values.
+static constexpr int kNumDeviceTypes = 2;
+
+// Maximum device id with a cached memory manager, per device type.
+static constexpr int kMaxDeviceID = 63;
+
 void* MemoryManager::Malloc(size_t byte_size, const Device& device) {
-    return GetDeviceMemoryManager(device)->Malloc(byte_size, device);
+    CachedMemoryManager* cached_mm = GetCachedMemoryManager(device);
+    void* ptr = cached_mm->IsEnabled()
+                        ? cached_mm->Malloc(byte_size, device)
+                        : cached_mm->GetDeviceMemoryManager()->Malloc(
+                                  byte_size, device);
+    if (Profiler::IsEnabled()) {
+        Profiler::RecordMalloc(ptr, byte_size, device);
+    }
+    return ptr;
 }
 
 void MemoryManager::Free(void* ptr, const Device& device) {
-    return GetDeviceMemoryManager(device)->Free(ptr, device);
+    if (Profiler::IsEnabled() || Profiler::HasTrackedAllocations()) {
+        Profiler::RecordFree(ptr, device);
+    }
+    CachedMemoryManager* cached_mm = GetCachedMemoryManager(device);
+    if (cached_mm->IsEnabled() || cached_mm->HasLiveBlocks()) {
+        cached_mm->Free(ptr, device);
+    } else {
+        cached_mm->GetDeviceMemoryManager()->Free(ptr, device);
+    }
 }
 
 void MemoryManager::Memcpy(void* dst_ptr,
@@ -92,6 +117,57 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+void MemoryManager::EnableCache(const Device& device) {
+    GetCachedMemoryManager(device)->SetEnabled(true, device);
+}
+
+void MemoryManager::DisableCache(const Device& device) {
+    GetCachedMemoryManager(device)->SetEnabled(false, device);
+}
+
+bool MemoryManager::IsCacheEnabled(const Device& device) {
+    return GetCachedMemoryManager(device)->IsEnabled();
+}
+
+void MemoryManager::ReleaseCache(const Device& device) {
+    GetCachedMemoryManager(device)->Release(device);
+}
+
+MemoryCacheStatistics MemoryManager::GetCacheStatistics(const Device& device) {
+    return GetCachedMemoryManager(device)->GetStatistics();
+}
+
+void MemoryManager::ResetCacheStatistics(const Device& device) {
+    GetCachedMemoryManager(device)->ResetStatistics();
+}
+
+CachedMemoryManager* MemoryManager::GetCachedMemoryManager(
+        const Device& device) {
+    // One slot per device, created once and never moved, so that lookups in
+    // Malloc and Free do not need a lock.
+    struct Slot {
+        std::once_flag created;
+        std::unique_ptr<CachedMemoryManager> cached_mm;
+    };
+    static Slot slots[kNumDeviceTypes][kMaxDeviceID + 1];
+
+    int type_idx = static_cast<int>(device.GetType());
+    int device_id = device.GetID();
+    if (type_idx < 0 || type_idx >= kNumDeviceTypes || device_id < 0 ||
+        device_id > kMaxDeviceID) {
+        utility::LogError(
+                "MemoryManager::GetCachedMemoryManager: Unsupported device "
+                "{}.",
+                device.ToString());
+    }
+    Slot& slot = slots[type_idx][device_id];
+    std::call_once(slot.created, [&]() {
+        slot.cached_mm.reset(
+                new CachedMemoryManager(GetDeviceMemoryManager(device)));
+    });
+    return slot.cached_mm.get();
+}
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
     static std::unordered_map<Device::DeviceType,
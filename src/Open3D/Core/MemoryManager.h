@@ -26,17 +26,34 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Open3D/Core/Device.h"
 
 namespace open3d {
 
 class DeviceMemoryManager;
+class CachedMemoryManager;
+
+/// Hit/miss statistics and current footprint of a device's memory cache.
+struct MemoryCacheStatistics {
+    /// Number of Malloc calls served from a cached block.
+    int64_t num_hits = 0;
+    /// Number of Malloc calls that required a new device allocation.
+    int64_t num_misses = 0;
+    /// Number of freed blocks currently held by the cache.
+    int64_t num_cached_blocks = 0;
+    /// Total byte size of the blocks currently held by the cache.
+    int64_t cached_byte_size = 0;
+};
 
 class MemoryManager {
 public:
@@ -58,9 +75,36 @@ public:
                              const Device& src_device,
                              size_t num_bytes);
 
+    /// Enables the size-bucketed block cache for \p device. Freed blocks are
+    /// kept by the cache and reused by subsequent Malloc calls of the same
+    /// bucket size, instead of being returned to the system allocator.
+    static void EnableCache(const Device& device);
+
+    /// Disables the block cache for \p device and releases all cached blocks.
+    /// Blocks that are still in use are freed normally when released.
+    static void DisableCache(const Device& device);
+
+    /// Returns true if the block cache is enabled for \p device.
+    static bool IsCacheEnabled(const Device& device);
+
+    /// Returns all cached (unused) blocks of \p device to the system
+    /// allocator. The cache stays enabled.
+    static void ReleaseCache(const Device& device);
+
+    /// Returns the cache statistics of \p device.
+    static MemoryCacheStatistics GetCacheStatistics(const Device& device);
+
+    /// Resets the hit/miss counters of \p device's cache.
+    static void ResetCacheStatistics(const Device& device);
+
 protected:
     static std::shared_ptr<DeviceMemoryManager> GetDeviceMemoryManager(
             const Device& device);
+
+    /// Returns the per-device caching layer on top of the device memory
+    /// manager. It is created on the first use of \p device and then looked
+    /// up without locking. Malloc and Free bypass it while it is disabled.
+    static CachedMemoryManager* GetCachedMemoryManager(const Device& device);
 };
 
 class DeviceMemoryManager {
@@ -86,6 +130,62 @@ public:
                 size_t num_bytes) override;
 };
 
+/// Size-bucketed caching allocator on top of another DeviceMemoryManager.
+///
+/// Requested sizes are rounded up to a bucket size. Freed blocks are stored in
+/// per-bucket free lists and handed out again on the next Malloc of the same
+/// bucket, so that the temporaries of repeated tensor expressions do not hit
+/// the system allocator (and page faults) every time.
+class CachedMemoryManager : public DeviceMemoryManager {
+public:
+    CachedMemoryManager(
+            const std::shared_ptr<DeviceMemoryManager>& device_mm);
+    ~CachedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+    void SetEnabled(bool enabled, const Device& device);
+    bool IsEnabled() const { return enabled_; }
+
+    /// Returns true if blocks handed out by the cache are not yet freed. Such
+    /// blocks must be freed through the cache, even after it is disabled.
+    bool HasLiveBlocks() const { return num_live_blocks_ > 0; }
+
+    DeviceMemoryManager* GetDeviceMemoryManager() const {
+        return device_mm_.get();
+    }
+
+    /// Frees all cached blocks with the underlying device memory manager.
+    void Release(const Device& device);
+
+    MemoryCacheStatistics GetStatistics();
+    void ResetStatistics();
+
+    /// Returns the bucket size that a request of \p byte_size is rounded to.
+    /// Small requests are rounded to multiples of 512 bytes, larger requests
+    /// to one of four sub-buckets per power of two (at most 25% overhead).
+    static size_t BucketSize(size_t byte_size);
+
+protected:
+    std::shared_ptr<DeviceMemoryManager> device_mm_;
+    std::atomic<bool> enabled_;
+
+    /// Number of blocks handed out by the cache that are not yet freed.
+    std::atomic<int64_t> num_live_blocks_;
+
+    std::mutex mutex_;
+    /// Bucket size -> cached free blocks.
+    std::unordered_map<size_t, std::vector<void*>> free_blocks_;
+    /// Pointer -> bucket size, for blocks handed out by the cache.
+    std::unordered_map<void*, size_t> live_blocks_;
+    MemoryCacheStatistics statistics_;
+};
+
 #ifdef BUILD_CUDA_MODULE
 class CUDAMemoryManager : public DeviceMemoryManager {
 public:
@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/MemoryManager.h"
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+// Requests smaller than kSmallSizeLimit are rounded to multiples of
+// kSmallBucketSize.
+static constexpr size_t kSmallBucketSize = 512;
+static constexpr size_t kSmallSizeLimit = 1 << 20;
+
+CachedMemoryManager::CachedMemoryManager(
+        const std::shared_ptr<DeviceMemoryManager>& device_mm)
+    : device_mm_(device_mm), enabled_(false), num_live_blocks_(0) {}
+
+CachedMemoryManager::~CachedMemoryManager() {
+    // Cached blocks are intentionally not freed here. The cache lives until
+    // static destruction, where the device (e.g. the CUDA context) may
+    // already be torn down.
+}
+
+size_t CachedMemoryManager::BucketSize(size_t byte_size) {
+    if (byte_size <= kSmallSizeLimit) {
+        return (byte_size + kSmallBucketSize - 1) / kSmallBucketSize *
+               kSmallBucketSize;
+    }
+    // Four sub-buckets between two consecutive powers of two.
+    size_t msb = 1;
+    while ((msb << 1) <= byte_size) {
+        msb <<= 1;
+    }
+    size_t granularity = msb >> 2;
+    return (byte_size + granularity - 1) / granularity * granularity;
+}
+
+void* CachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (!enabled_ || byte_size == 0) {
+        return device_mm_->Malloc(byte_size, device);
+    }
+
+    size_t bucket_size = BucketSize(byte_size);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = free_blocks_.find(bucket_size);
+        if (it != free_blocks_.end() && !it->second.empty()) {
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            live_blocks_[ptr] = bucket_size;
+            num_live_blocks_++;
+            statistics_.num_hits++;
+            statistics_.num_cached_blocks--;
+            statistics_.cached_byte_size -= bucket_size;
+            return ptr;
+        }
+        statistics_.num_misses++;
+    }
+
+    void* ptr = nullptr;
+    try {
+        ptr = device_mm_->Malloc(bucket_size, device);
+    } catch (const std::runtime_error&) {
+        // Out of memory: give the cached blocks back and retry once.
+        Release(device);
+        ptr = device_mm_->Malloc(bucket_size, device);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    live_blocks_[ptr] = bucket_size;
+    num_live_blocks_++;
+    return ptr;
+}
+
+void CachedMemoryManager::Free(void* ptr, const Device& device) {
+    if (!ptr) {
+        return;
+    }
+    if (!enabled_ && num_live_blocks_ == 0) {
+        device_mm_->Free(ptr, device);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = live_blocks_.find(ptr);
+        if (it != live_blocks_.end()) {
+            size_t bucket_size = it->second;
+            live_blocks_.erase(it);
+            num_live_blocks_--;
+            if (enabled_) {
+                free_blocks_[bucket_size].push_back(ptr);
+                statistics_.num_cached_blocks++;
+                statistics_.cached_byte_size += bucket_size;
+                return;
+            }
+        }
+    }
+    // Not allocated by the cache, or the cache has been disabled.
+    device_mm_->Free(ptr, device);
+}
+
+void CachedMemoryManager::Memcpy(void* dst_ptr,
+                                 const Device& dst_device,
+                                 const void* src_ptr,
+                                 const Device& src_device,
+                                 size_t num_bytes) {
+    device_mm_->Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
+}
+
+void CachedMemoryManager::SetEnabled(bool enabled, const Device& device) {
+    enabled_ = enabled;
+    if (!enabled) {
+        Release(device);
+    }
+}
+
+void CachedMemoryManager::Release(const Device& device) {
+    std::unordered_map<size_t, std::vector<void*>> free_blocks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_blocks.swap(free_blocks_);
+        statistics_.num_cached_blocks = 0;
+        statistics_.cached_byte_size = 0;
+    }
+    for (auto& bucket : free_blocks) {
+        for (void* ptr : bucket.second) {
+            device_mm_->Free(ptr, device);
+        }
+    }
+}
+
+MemoryCacheStatistics CachedMemoryManager::GetStatistics() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+}
+
+void CachedMemoryManager::ResetStatistics() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    statistics_.num_hits = 0;
+    statistics_.num_misses = 0;
+}
+
+}  // namespace open3d
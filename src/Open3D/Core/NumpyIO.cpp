@@ -0,0 +1,643 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/NumpyIO.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Open3D/Core/Blob.h"
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+
+/// A whole file mapped into memory. The mapping is private and writable, so
+/// that tensors sharing it can be modified without changing the file. On
+/// Windows the file is read into memory instead.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& file_name) {
+#ifdef _WIN32
+        std::string error_str;
+        if (!utility::filesystem::FReadToBuffer(file_name, buffer_,
+                                                &error_str)) {
+            utility::LogError("Failed to read {}: {}", file_name, error_str);
+        }
+        data_ = reinterpret_cast<uint8_t*>(buffer_.data());
+        size_ = static_cast<int64_t>(buffer_.size());
+#else
+        int fd = open(file_name.c_str(), O_RDONLY);
+        if (fd < 0) {
+            utility::LogError(
+                    "Failed to open {}: {}", file_name,
+                    utility::filesystem::GetIOErrorString(errno));
+        }
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0) {
+            close(fd);
+            utility::LogError("Failed to stat {}.", file_name);
+        }
+        size_ = static_cast<int64_t>(file_stat.st_size);
+        if (size_ > 0) {
+            void* ptr = mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (ptr == MAP_FAILED) {
+                utility::LogError(
+                        "Failed to map {}: {}", file_name,
+                        utility::filesystem::GetIOErrorString(errno));
+            }
+            data_ = static_cast<uint8_t*>(ptr);
+        } else {
+            close(fd);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#ifndef _WIN32
+        if (data_ != nullptr) {
+            munmap(data_, size_);
+        }
+#endif
+    }
+
+    uint8_t* GetData() const { return data_; }
+
+    int64_t GetSize() const { return size_; }
+
+private:
+    uint8_t* data_ = nullptr;
+    int64_t size_ = 0;
+#ifdef _WIN32
+    std::vector<char> buffer_;
+#endif
+};
+
+struct NpyHeader {
+    Dtype dtype_;
+    SizeVector shape_;
+    bool fortran_order_;
+    /// Offset of the data from the beginning of the .npy file.
+    int64_t data_offset_;
+};
+
+template <typename T>
+T ReadLE(const uint8_t* ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void AppendLE(std::string& buffer, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    buffer.append(bytes, sizeof(T));
+}
+
+uint32_t Crc32(uint32_t crc, const void* data, int64_t size) {
+    static const std::array<uint32_t, 256> table = []() {
+        std::array<uint32_t, 256> t;
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+    for (int64_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+Dtype DtypeFromDescr(const std::string& descr, const std::string& file_name) {
+    if (descr.size() == 3 && descr[0] != '>') {
+        std::string type = descr.substr(1);
+        if (type == "f4") return Dtype::Float32;
+        if (type == "f8") return Dtype::Float64;
+        if (type == "i4") return Dtype::Int32;
+        if (type == "i8") return Dtype::Int64;
+        if (type == "u1") return Dtype::UInt8;
+        if (type == "b1") return Dtype::Bool;
+        if (type == "f2") return Dtype::Float16;
+        if (type == "i1") return Dtype::Int8;
+        if (type == "i2") return Dtype::Int16;
+        if (type == "u2") return Dtype::UInt16;
+    }
+    utility::LogError("Unsupported dtype '{}' in {}.", descr, file_name);
+}
+
+std::string DescrFromDtype(Dtype dtype) {
+    switch (dtype) {
+        case Dtype::Float32:
+            return "<f4";
+        case Dtype::Float64:
+            return "<f8";
+        case Dtype::Int32:
+            return "<i4";
+        case Dtype::Int64:
+            return "<i8";
+        case Dtype::UInt8:
+            return "|u1";
+        case Dtype::Bool:
+            return "|b1";
+        case Dtype::Float16:
+            return "<f2";
+        case Dtype::Int8:
+            return "|i1";
+        case Dtype::Int16:
+            return "<i2";
+        case Dtype::UInt16:
+            return "<u2";
+        default:
+            utility::LogError("Unsupported dtype {} for .npy.",
+                              DtypeUtil::ToString(dtype));
+    }
+}
+
+/// Returns the value of \p key in the Python dict literal of a .npy header,
+/// without quotes for strings and with parentheses for tuples.
+std::string GetHeaderValue(const std::string& header,
+                           const std::string& key,
+                           const std::string& file_name) {
+    size_t pos = header.find("'" + key + "'");
+    if (pos != std::string::npos) {
+        pos = header.find(':', pos);
+    }
+    if (pos != std::string::npos) {
+        pos = header.find_first_not_of(' ', pos + 1);
+    }
+    if (pos != std::string::npos) {
+        size_t end = std::string::npos;
+        if (header[pos] == '\'') {
+            pos++;
+            end = header.find('\'', pos);
+        } else if (header[pos] == '(') {
+            end = header.find(')', pos);
+            if (end != std::string::npos) {
+                end++;
+            }
+        } else {
+            end = header.find_first_of(",}", pos);
+        }
+        if (end != std::string::npos) {
+            return header.substr(pos, end - pos);
+        }
+    }
+    utility::LogError("Failed to parse '{}' in the header of {}.", key,
+                      file_name);
+}
+
+NpyHeader ParseNpyHeader(const uint8_t* data,
+                         int64_t size,
+                         const std::string& file_name) {
+    if (size < 10 || std::memcmp(data, "\x93NUMPY", 6) != 0) {
+        utility::LogError("{} is not a .npy file.", file_name);
+    }
+    int64_t header_begin;
+    int64_t header_size;
+    if (data[6] == 1) {
+        header_begin = 10;
+        header_size = ReadLE<uint16_t>(data + 8);
+    } else if ((data[6] == 2 || data[6] == 3) && size >= 12) {
+        header_begin = 12;
+        header_size = ReadLE<uint32_t>(data + 8);
+    } else {
+        utility::LogError("Unsupported .npy format version {} in {}.",
+                          static_cast<int>(data[6]), file_name);
+    }
+    if (header_begin + header_size > size) {
+        utility::LogError("{} has a truncated header.", file_name);
+    }
+    std::string header(reinterpret_cast<const char*>(data + header_begin),
+                       header_size);
+
+    NpyHeader npy_header;
+    npy_header.dtype_ = DtypeFromDescr(
+            GetHeaderValue(header, "descr", file_name), file_name);
+    std::string fortran_order =
+            GetHeaderValue(header, "fortran_order", file_name);
+    if (fortran_order != "True" && fortran_order != "False") {
+        utility::LogError("Failed to parse 'fortran_order' in {}.", file_name);
+    }
+    npy_header.fortran_order_ = fortran_order == "True";
+    std::string shape = GetHeaderValue(header, "shape", file_name);
+    if (shape.empty() || shape[0] != '(') {
+        utility::LogError("Failed to parse 'shape' in {}.", file_name);
+    }
+    size_t pos = 1;
+    while (pos < shape.size() - 1) {
+        size_t end = shape.find_first_of(",)", pos);
+        std::string dim = shape.substr(pos, end - pos);
+        dim.erase(std::remove(dim.begin(), dim.end(), ' '), dim.end());
+        if (!dim.empty()) {
+            int64_t dim_size = -1;
+            try {
+                dim_size = std::stoll(dim);
+            } catch (const std::exception&) {
+                utility::LogError("Failed to parse 'shape' in {}.", file_name);
+            }
+            if (dim_size < 0) {
+                utility::LogError("Negative dimension {} in 'shape' of {}.",
+                                  dim, file_name);
+            }
+            npy_header.shape_.push_back(dim_size);
+        }
+        pos = end + 1;
+    }
+    npy_header.data_offset_ = header_begin + header_size;
+    return npy_header;
+}
+
+/// Returns the .npy file starting at \p begin in \p file as a tensor sharing
+/// the mapping, or as a copy if the data is not aligned to the element size.
+Tensor NpyToTensor(const std::shared_ptr<MappedFile>& file,
+                   int64_t begin,
+                   int64_t size,
+                   const std::string& file_name) {
+    NpyHeader header = ParseNpyHeader(file->GetData() + begin, size, file_name);
+    int64_t element_byte_size = DtypeUtil::ByteSize(header.dtype_);
+    int64_t byte_size = header.shape_.NumElements() * element_byte_size;
+    if (header.data_offset_ + byte_size > size) {
+        utility::LogError("{} is truncated, expected {} bytes of data.",
+                          file_name, byte_size);
+    }
+
+    SizeVector shape = header.shape_;
+    if (header.fortran_order_) {
+        std::reverse(shape.begin(), shape.end());
+    }
+    uint8_t* data_ptr = file->GetData() + begin + header.data_offset_;
+    Tensor tensor;
+    if (reinterpret_cast<uintptr_t>(data_ptr) % element_byte_size == 0) {
+        // The blob keeps the mapping alive.
+        auto blob = std::make_shared<Blob>(Device("CPU:0"), data_ptr,
+                                           [file](void*) {});
+        tensor = Tensor(shape, Tensor::DefaultStrides(shape), data_ptr,
+                        header.dtype_, blob);
+    } else {
+        tensor = Tensor(shape, header.dtype_, Device("CPU:0"));
+        std::memcpy(tensor.GetDataPtr(), data_ptr, byte_size);
+    }
+    if (header.fortran_order_) {
+        SizeVector dims(shape.size());
+        for (int64_t i = 0; i < static_cast<int64_t>(dims.size()); ++i) {
+            dims[i] = dims.size() - 1 - i;
+        }
+        tensor = tensor.Permute(dims);
+    }
+    return tensor;
+}
+
+/// Returns the magic string, version and header of a C-ordered .npy file. The
+/// header is padded such that the data is 64-byte aligned.
+std::string MakeNpyHeader(const Tensor& tensor) {
+    std::string dict = "{'descr': '" + DescrFromDtype(tensor.GetDtype()) +
+                       "', 'fortran_order': False, 'shape': (";
+    for (int64_t dim : tensor.GetShape()) {
+        dict += std::to_string(dim) + ", ";
+    }
+    if (tensor.NumDims() > 1) {
+        dict.resize(dict.size() - 2);
+    } else if (tensor.NumDims() == 1) {
+        dict.resize(dict.size() - 1);
+    }
+    dict += "), }";
+
+    bool version_1 = dict.size() + 11 <= 65535;
+    int64_t preamble_size = version_1 ? 10 : 12;
+    int64_t padding = 63 - (preamble_size + dict.size()) % 64;
+    dict += std::string(padding, ' ') + "\n";
+
+    std::string header("\x93NUMPY", 6);
+    if (version_1) {
+        header += '\x01';
+        header += '\x00';
+        AppendLE<uint16_t>(header, static_cast<uint16_t>(dict.size()));
+    } else {
+        header += '\x02';
+        header += '\x00';
+        AppendLE<uint32_t>(header, static_cast<uint32_t>(dict.size()));
+    }
+    return header + dict;
+}
+
+Tensor ToContiguousCPU(const Tensor& tensor) {
+    if (tensor.GetDevice().GetType() != Device::DeviceType::CPU) {
+        return tensor.Copy(Device("CPU:0"));
+    }
+    return tensor.Contiguous();
+}
+
+void WriteBytes(FILE* file,
+                const void* data,
+                int64_t size,
+                const std::string& file_name) {
+    if (size > 0 && fwrite(data, 1, size, file) != static_cast<size_t>(size)) {
+        fclose(file);
+        utility::LogError("Failed to write {}.", file_name);
+    }
+}
+
+}  // namespace
+
+Tensor ReadNpy(const std::string& file_name) {
+    auto file = std::make_shared<MappedFile>(file_name);
+    return NpyToTensor(file, 0, file->GetSize(), file_name);
+}
+
+void WriteNpy(const std::string& file_name, const Tensor& tensor) {
+    Tensor src = ToContiguousCPU(tensor);
+    std::string header = MakeNpyHeader(src);
+    FILE* file = utility::filesystem::FOpen(file_name, "wb");
+    if (file == nullptr) {
+        utility::LogError("Failed to open {} for writing.", file_name);
+    }
+    WriteBytes(file, header.data(), header.size(), file_name);
+    WriteBytes(file, src.GetDataPtr(),
+               src.NumElements() * DtypeUtil::ByteSize(src.GetDtype()),
+               file_name);
+    fclose(file);
+}
+
+std::unordered_map<std::string, Tensor> ReadNpz(const std::string& file_name) {
+    auto file = std::make_shared<MappedFile>(file_name);
+    const uint8_t* data = file->GetData();
+    const int64_t size = file->GetSize();
+    auto check = [&](bool valid) {
+        if (!valid) {
+            utility::LogError("{} is not a valid .npz file.", file_name);
+        }
+    };
+
+    // The end of central directory record is followed by a comment of at
+    // most 65535 bytes.
+    int64_t eocd = -1;
+    for (int64_t pos = size - 22; pos >= std::max<int64_t>(0, size - 65557);
+         --pos) {
+        if (ReadLE<uint32_t>(data + pos) == 0x06054b50) {
+            eocd = pos;
+            break;
+        }
+    }
+    check(eocd >= 0);
+    uint64_t num_entries = ReadLE<uint16_t>(data + eocd + 10);
+    uint64_t offset = ReadLE<uint32_t>(data + eocd + 16);
+    if (eocd >= 20 && ReadLE<uint32_t>(data + eocd - 20) == 0x07064b50) {
+        uint64_t eocd64 = ReadLE<uint64_t>(data + eocd - 20 + 8);
+        check(eocd64 + 56 <= static_cast<uint64_t>(size) &&
+              ReadLE<uint32_t>(data + eocd64) == 0x06064b50);
+        num_entries = ReadLE<uint64_t>(data + eocd64 + 32);
+        offset = ReadLE<uint64_t>(data + eocd64 + 48);
+    }
+
+    std::unordered_map<std::string, Tensor> tensors;
+    for (uint64_t i = 0; i < num_entries; ++i) {
+        check(offset + 46 <= static_cast<uint64_t>(size) &&
+              ReadLE<uint32_t>(data + offset) == 0x02014b50);
+        const uint8_t* entry = data + offset;
+        uint16_t method = ReadLE<uint16_t>(entry + 10);
+        uint64_t entry_size = ReadLE<uint32_t>(entry + 20);
+        uint64_t uncompressed_size = ReadLE<uint32_t>(entry + 24);
+        uint16_t name_size = ReadLE<uint16_t>(entry + 28);
+        uint16_t extra_size = ReadLE<uint16_t>(entry + 30);
+        uint16_t comment_size = ReadLE<uint16_t>(entry + 32);
+        uint64_t local_offset = ReadLE<uint32_t>(entry + 42);
+        check(offset + 46 + name_size + extra_size <=
+              static_cast<uint64_t>(size));
+        std::string name(reinterpret_cast<const char*>(entry + 46), name_size);
+
+        // ZIP64 extra field, holding the values that did not fit above.
+        const uint8_t* extra = entry + 46 + name_size;
+        for (uint32_t pos = 0; pos + 4 <= extra_size;) {
+            uint16_t id = ReadLE<uint16_t>(extra + pos);
+            uint16_t field_size = ReadLE<uint16_t>(extra + pos + 2);
+            check(pos + 4 + field_size <= extra_size);
+            if (id == 0x0001) {
+                const uint8_t* field = extra + pos + 4;
+                const uint8_t* field_end = field + field_size;
+                for (uint64_t* value :
+                     {&uncompressed_size, &entry_size, &local_offset}) {
+                    if (*value == 0xFFFFFFFF && field + 8 <= field_end) {
+                        *value = ReadLE<uint64_t>(field);
+                        field += 8;
+                    }
+                }
+            }
+            pos += 4 + field_size;
+        }
+
+        if (method != 0) {
+            utility::LogError(
+                    "Entry {} of {} is compressed, which is not supported. "
+                    "Use np.savez instead of np.savez_compressed.",
+                    name, file_name);
+        }
+        check(local_offset + 30 <= static_cast<uint64_t>(size) &&
+              ReadLE<uint32_t>(data + local_offset) == 0x04034b50);
+        uint64_t begin = local_offset + 30 +
+                         ReadLE<uint16_t>(data + local_offset + 26) +
+                         ReadLE<uint16_t>(data + local_offset + 28);
+        check(begin + entry_size <= static_cast<uint64_t>(size));
+
+        std::string key = name;
+        if (key.size() > 4 && key.substr(key.size() - 4) == ".npy") {
+            key.resize(key.size() - 4);
+        }
+        tensors[key] =
+                NpyToTensor(file, begin, entry_size, file_name + "/" + name);
+        offset += 46 + name_size + extra_size + comment_size;
+    }
+    return tensors;
+}
+
+void WriteNpz(const std::string& file_name,
+              const std::unordered_map<std::string, Tensor>& tensors) {
+    FILE* file = utility::filesystem::FOpen(file_name, "wb");
+    if (file == nullptr) {
+        utility::LogError("Failed to open {} for writing.", file_name);
+    }
+    const uint16_t kDosDate = (1 << 5) | 1;  // 1980-01-01.
+    const uint64_t kMax32 = 0xFFFFFFFF;
+
+    struct Entry {
+        std::string name_;
+        uint32_t crc_;
+        uint64_t size_;
+        uint64_t offset_;
+    };
+    std::vector<Entry> entries;
+    uint64_t offset = 0;
+    for (const auto& name_tensor : tensors) {
+        Tensor src = ToContiguousCPU(name_tensor.second);
+        std::string header = MakeNpyHeader(src);
+        int64_t byte_size =
+                src.NumElements() * DtypeUtil::ByteSize(src.GetDtype());
+        Entry e;
+        e.name_ = name_tensor.first + ".npy";
+        e.crc_ = Crc32(Crc32(0, header.data(), header.size()),
+                       src.GetDataPtr(), byte_size);
+        e.size_ = header.size() + byte_size;
+        e.offset_ = offset;
+        bool zip64 = e.size_ >= kMax32;
+
+        std::string local;
+        AppendLE<uint32_t>(local, 0x04034b50);
+        AppendLE<uint16_t>(local, zip64 ? 45 : 20);
+        AppendLE<uint16_t>(local, 0);
+        AppendLE<uint16_t>(local, 0);
+        AppendLE<uint16_t>(local, 0);
+        AppendLE<uint16_t>(local, kDosDate);
+        AppendLE<uint32_t>(local, e.crc_);
+        AppendLE<uint32_t>(local, zip64 ? kMax32 : e.size_);
+        AppendLE<uint32_t>(local, zip64 ? kMax32 : e.size_);
+        AppendLE<uint16_t>(local, static_cast<uint16_t>(e.name_.size()));
+        // Pad the extra field such that the array data is 64-byte aligned
+        // within the archive and can be memory-mapped by ReadNpz.
+        uint64_t data_begin =
+                offset + 30 + e.name_.size() + (zip64 ? 20 : 0) + 4;
+        uint16_t padding = (64 - (data_begin + header.size()) % 64) % 64;
+        AppendLE<uint16_t>(local, (zip64 ? 20 : 0) + 4 + padding);
+        local += e.name_;
+        if (zip64) {
+            AppendLE<uint16_t>(local, 0x0001);
+            AppendLE<uint16_t>(local, 16);
+            AppendLE<uint64_t>(local, e.size_);
+            AppendLE<uint64_t>(local, e.size_);
+        }
+        AppendLE<uint16_t>(local, 0xD935);
+        AppendLE<uint16_t>(local, padding);
+        local += std::string(padding, '\0');
+
+        WriteBytes(file, local.data(), local.size(), file_name);
+        WriteBytes(file, header.data(), header.size(), file_name);
+        WriteBytes(file, src.GetDataPtr(), byte_size, file_name);
+        offset += local.size() + e.size_;
+        entries.push_back(e);
+    }
+
+    const uint64_t central_offset = offset;
+    std::string central;
+    for (const Entry& e : entries) {
+        bool zip64_size = e.size_ >= kMax32;
+        bool zip64_offset = e.offset_ >= kMax32;
+        uint16_t zip64_extra_size =
+                (zip64_size || zip64_offset)
+                        ? 4 + (zip64_size ? 16 : 0) + (zip64_offset ? 8 : 0)
+                        : 0;
+        AppendLE<uint32_t>(central, 0x02014b50);
+        AppendLE<uint16_t>(central, 45);
+        AppendLE<uint16_t>(central, zip64_extra_size > 0 ? 45 : 20);
+        AppendLE<uint16_t>(central, 0);
+        AppendLE<uint16_t>(central, 0);
+        AppendLE<uint16_t>(central, 0);
+        AppendLE<uint16_t>(central, kDosDate);
+        AppendLE<uint32_t>(central, e.crc_);
+        AppendLE<uint32_t>(central, zip64_size ? kMax32 : e.size_);
+        AppendLE<uint32_t>(central, zip64_size ? kMax32 : e.size_);
+        AppendLE<uint16_t>(central, static_cast<uint16_t>(e.name_.size()));
+        AppendLE<uint16_t>(central, zip64_extra_size);
+        AppendLE<uint16_t>(central, 0);
+        AppendLE<uint16_t>(central, 0);
+        AppendLE<uint16_t>(central, 0);
+        AppendLE<uint32_t>(central, 0);
+        AppendLE<uint32_t>(central, zip64_offset ? kMax32 : e.offset_);
+        central += e.name_;
+        if (zip64_extra_size > 0) {
+            AppendLE<uint16_t>(central, 0x0001);
+            AppendLE<uint16_t>(central, zip64_extra_size - 4);
+            if (zip64_size) {
+                AppendLE<uint64_t>(central, e.size_);
+                AppendLE<uint64_t>(central, e.size_);
+            }
+            if (zip64_offset) {
+                AppendLE<uint64_t>(central, e.offset_);
+            }
+        }
+    }
+
+    const uint64_t num_entries = entries.size();
+    const uint64_t central_size = central.size();
+    if (num_entries >= 0xFFFF || central_offset >= kMax32 ||
+        central_size >= kMax32) {
+        // ZIP64 end of central directory record and locator.
+        AppendLE<uint32_t>(central, 0x06064b50);
+        AppendLE<uint64_t>(central, 44);
+        AppendLE<uint16_t>(central, 45);
+        AppendLE<uint16_t>(central, 45);
+        AppendLE<uint32_t>(central, 0);
+        AppendLE<uint32_t>(central, 0);
+        AppendLE<uint64_t>(central, num_entries);
+        AppendLE<uint64_t>(central, num_entries);
+        AppendLE<uint64_t>(central, central_size);
+        AppendLE<uint64_t>(central, central_offset);
+        AppendLE<uint32_t>(central, 0x07064b50);
+        AppendLE<uint32_t>(central, 0);
+        AppendLE<uint64_t>(central, central_offset + central_size);
+        AppendLE<uint32_t>(central, 1);
+    }
+    AppendLE<uint32_t>(central, 0x06054b50);
+    AppendLE<uint16_t>(central, 0);
+    AppendLE<uint16_t>(central, 0);
+    AppendLE<uint16_t>(central, std::min<uint64_t>(num_entries, 0xFFFF));
+    AppendLE<uint16_t>(central, std::min<uint64_t>(num_entries, 0xFFFF));
+    AppendLE<uint32_t>(central, std::min(central_size, kMax32));
+    AppendLE<uint32_t>(central, std::min(central_offset, kMax32));
+    AppendLE<uint16_t>(central, 0);
+
+    WriteBytes(file, central.data(), central.size(), file_name);
+    fclose(file);
+}
+
+}  // namespace open3d
@@ -0,0 +1,60 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+
+/// Reads a NumPy .npy file into a CPU tensor.
+///
+/// The file is memory-mapped and the returned tensor's Blob owns the mapping,
+/// so the data is paged in lazily on first access. The mapping is private:
+/// writes to the tensor are not written back to the file. Fortran-ordered
+/// arrays are returned as non-contiguous views. Supported dtypes are
+/// little-endian float32, float64, int32, int64, uint8 and bool.
+Tensor ReadNpy(const std::string& file_name);
+
+/// Writes a tensor to a NumPy .npy file. Tensors on other devices are copied
+/// to CPU first.
+void WriteNpy(const std::string& file_name, const Tensor& tensor);
+
+/// Reads all arrays of a NumPy .npz file, keyed by the array names without
+/// the ".npy" suffix. Entries are memory-mapped as in ReadNpy, or copied if
+/// their data is not aligned within the archive. Only uncompressed archives
+/// (np.savez) are supported.
+std::unordered_map<std::string, Tensor> ReadNpz(const std::string& file_name);
+
+/// Writes tensors to an uncompressed NumPy .npz file, which can be read by
+/// np.load. ZIP64 records are used for archives larger than 4GB.
+void WriteNpz(const std::string& file_name,
+              const std::unordered_map<std::string, Tensor>& tensors);
+
+}  // namespace open3d
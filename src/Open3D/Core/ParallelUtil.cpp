@@ -0,0 +1,289 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/ParallelUtil.h"
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+namespace parallel_util {
+
+/// True on pool workers, and on the calling thread while it takes part in
+/// ParallelForChunks.
+static thread_local bool tls_in_pool = false;
+
+/// Chunk indices [begin, end) still to be run by one thread. The owner takes
+/// chunks from the front and thieves take the back half.
+struct ChunkRange {
+    std::mutex mutex;
+    int64_t begin = 0;
+    int64_t end = 0;
+    /// Keeps the ranges of different threads on different cache lines.
+    char padding[64];
+};
+
+class ThreadPool {
+public:
+    static ThreadPool& GetInstance() {
+        static ThreadPool instance;
+        return instance;
+    }
+
+    ~ThreadPool() { StopWorkers(); }
+
+    int GetNumThreads() const { return num_threads_; }
+
+    void SetNumThreads(int num_threads) {
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+        if (num_threads <= 0) {
+            num_threads = default_num_threads_;
+        }
+        if (num_threads == num_threads_) {
+            return;
+        }
+        StopWorkers();
+        num_threads_ = num_threads;
+        ranges_.reset(new ChunkRange[num_threads_]);
+    }
+
+    void Run(int64_t num_chunks,
+             const std::function<void(int64_t)>& chunk_func) {
+        // Concurrent calls from different threads run serially instead of
+        // waiting for the pool.
+        std::unique_lock<std::mutex> run_lock(run_mutex_, std::try_to_lock);
+        if (!run_lock.owns_lock() || num_threads_ == 1 || num_chunks == 1) {
+            for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+                chunk_func(chunk_idx);
+            }
+            return;
+        }
+        if (workers_.empty()) {
+            StartWorkers();
+        }
+
+        int num_participants = static_cast<int>(
+                std::min<int64_t>(num_threads_, num_chunks));
+        for (int thread_idx = 0; thread_idx < num_participants; ++thread_idx) {
+            ranges_[thread_idx].begin =
+                    num_chunks * thread_idx / num_participants;
+            ranges_[thread_idx].end =
+                    num_chunks * (thread_idx + 1) / num_participants;
+        }
+        {
+            std::lock_guard<std::mutex> job_lock(job_mutex_);
+            job_ = &chunk_func;
+            num_participants_ = num_participants;
+            num_pending_ = num_participants - 1;
+            exception_ = nullptr;
+            ++generation_;
+        }
+        job_cv_.notify_all();
+
+        tls_in_pool = true;
+        RunChunks(0);
+        tls_in_pool = false;
+
+        std::unique_lock<std::mutex> job_lock(job_mutex_);
+        done_cv_.wait(job_lock, [this]() { return num_pending_ == 0; });
+        job_ = nullptr;
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+    }
+
+private:
+    ThreadPool() {
+#ifdef _OPENMP
+        default_num_threads_ = omp_get_max_threads();
+#else
+        default_num_threads_ =
+                static_cast<int>(std::thread::hardware_concurrency());
+#endif
+        default_num_threads_ = std::max(default_num_threads_, 1);
+        num_threads_ = default_num_threads_;
+        ranges_.reset(new ChunkRange[num_threads_]);
+    }
+
+    void StartWorkers() {
+        stop_ = false;
+        for (int thread_idx = 1; thread_idx < num_threads_; ++thread_idx) {
+            workers_.emplace_back(&ThreadPool::WorkerLoop, this, thread_idx,
+                                  generation_);
+        }
+    }
+
+    void StopWorkers() {
+        {
+            std::lock_guard<std::mutex> job_lock(job_mutex_);
+            stop_ = true;
+        }
+        job_cv_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+        workers_.clear();
+    }
+
+    void WorkerLoop(int thread_idx, uint64_t seen_generation) {
+        tls_in_pool = true;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> job_lock(job_mutex_);
+                job_cv_.wait(job_lock, [&]() {
+                    return stop_ || generation_ != seen_generation;
+                });
+                if (stop_) {
+                    return;
+                }
+                seen_generation = generation_;
+                if (thread_idx >= num_participants_) {
+                    continue;
+                }
+            }
+            RunChunks(thread_idx);
+            std::lock_guard<std::mutex> job_lock(job_mutex_);
+            if (--num_pending_ == 0) {
+                done_cv_.notify_one();
+            }
+        }
+    }
+
+    void RunChunks(int thread_idx) {
+        int64_t chunk_idx;
+        while (PopFront(thread_idx, chunk_idx) ||
+               Steal(thread_idx, chunk_idx)) {
+            try {
+                (*job_)(chunk_idx);
+            } catch (...) {
+                std::lock_guard<std::mutex> job_lock(job_mutex_);
+                if (!exception_) {
+                    exception_ = std::current_exception();
+                }
+            }
+        }
+    }
+
+    bool PopFront(int thread_idx, int64_t& chunk_idx) {
+        ChunkRange& range = ranges_[thread_idx];
+        std::lock_guard<std::mutex> range_lock(range.mutex);
+        if (range.begin >= range.end) {
+            return false;
+        }
+        chunk_idx = range.begin++;
+        return true;
+    }
+
+    /// Moves the back half of another thread's range to \p thread_idx's
+    /// (empty) range and takes its first chunk.
+    bool Steal(int thread_idx, int64_t& chunk_idx) {
+        for (int offset = 1; offset < num_participants_; ++offset) {
+            ChunkRange& victim =
+                    ranges_[(thread_idx + offset) % num_participants_];
+            int64_t stolen_begin, stolen_end;
+            {
+                std::lock_guard<std::mutex> victim_lock(victim.mutex);
+                int64_t remaining = victim.end - victim.begin;
+                if (remaining <= 0) {
+                    continue;
+                }
+                stolen_end = victim.end;
+                stolen_begin = victim.end - (remaining + 1) / 2;
+                victim.end = stolen_begin;
+            }
+            ChunkRange& range = ranges_[thread_idx];
+            std::lock_guard<std::mutex> range_lock(range.mutex);
+            range.begin = stolen_begin + 1;
+            range.end = stolen_end;
+            chunk_idx = stolen_begin;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    int default_num_threads_ = 1;
+    int num_threads_ = 1;
+    std::vector<std::thread> workers_;
+    std::unique_ptr<ChunkRange[]> ranges_;
+
+    /// Held by the thread running a job, and when resizing the pool.
+    std::mutex run_mutex_;
+
+    /// Guards the job state below.
+    std::mutex job_mutex_;
+    std::condition_variable job_cv_;
+    std::condition_variable done_cv_;
+    const std::function<void(int64_t)>* job_ = nullptr;
+    int num_participants_ = 0;
+    int num_pending_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+    std::exception_ptr exception_;
+};
+
+void SetNumThreads(int num_threads) {
+    if (InParallel()) {
+        utility::LogError(
+                "SetNumThreads must not be called from a parallel region.");
+    }
+    ThreadPool::GetInstance().SetNumThreads(num_threads);
+}
+
+int GetNumThreads() { return ThreadPool::GetInstance().GetNumThreads(); }
+
+bool InParallel() {
+#ifdef _OPENMP
+    if (omp_in_parallel()) {
+        return true;
+    }
+#endif
+    return tls_in_pool;
+}
+
+void ParallelForChunks(int64_t num_chunks,
+                       const std::function<void(int64_t)>& chunk_func) {
+    if (num_chunks <= 0) {
+        return;
+    }
+    if (InParallel()) {
+        for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            chunk_func(chunk_idx);
+        }
+        return;
+    }
+    ThreadPool::GetInstance().Run(num_chunks, chunk_func);
+}
+
+}  // namespace parallel_util
+}  // namespace kernel
+}  // namespace open3d
@@ -26,24 +26,162 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace open3d {
 namespace kernel {
 namespace parallel_util {
 
-inline int GetMaxThreads() {
-#ifdef _OPENMP
-    return omp_get_max_threads();
-#else
-    return 1;
-#endif
+/// Sets the number of threads used by the parallel_util functions, i.e. by
+/// CPULauncher and the kernels built on ParallelFor, ParallelReduce and
+/// ParallelScan. Loops that use OpenMP directly are not affected and keep
+/// following the OpenMP settings (e.g. OMP_NUM_THREADS). \p num_threads <= 0
+/// restores the default, which is omp_get_max_threads() when compiled with
+/// OpenMP and std::thread::hardware_concurrency() otherwise. Must not be
+/// called from a parallel region.
+void SetNumThreads(int num_threads);
+
+/// Returns the number of threads used by the parallel_util functions.
+int GetNumThreads();
+
+inline int GetMaxThreads() { return GetNumThreads(); }
+
+/// Returns true if called from an OpenMP parallel region or from a task of
+/// the parallel_util thread pool. Nested parallel_util calls run serially on
+/// the calling thread.
+bool InParallel();
+
+/// Calls \p chunk_func(chunk_idx) for every chunk_idx in [0, num_chunks) on
+/// the work-stealing thread pool, with the calling thread participating.
+/// Each thread starts with an equal contiguous range of chunks. A thread that
+/// runs out of chunks steals the back half of another thread's remaining
+/// range, so irregular chunks are load-balanced. The first exception thrown
+/// by \p chunk_func is rethrown on the calling thread once all threads are
+/// done.
+void ParallelForChunks(int64_t num_chunks,
+                       const std::function<void(int64_t)>& chunk_func);
+
+/// Returns the chunk size used to split \p num_elements elements. Chunks
+/// contain at least \p grain_size elements, and there are at most a few
+/// chunks per thread such that stealing has something to steal.
+inline int64_t GetChunkSize(int64_t num_elements, int64_t grain_size) {
+    const int64_t kChunksPerThread = 8;
+    int64_t max_num_chunks = GetNumThreads() * kChunksPerThread;
+    int64_t chunk_size = (num_elements + max_num_chunks - 1) / max_num_chunks;
+    return std::max(chunk_size, std::max<int64_t>(grain_size, 1));
 }
 
-inline bool InParallel() {
-#ifdef _OPENMP
-    return omp_in_parallel();
-#else
-    return false;
-#endif
+/// Calls \p func(range_begin, range_end) on disjoint sub-ranges covering
+/// [begin, end) in parallel. Ranges have at least \p grain_size elements, so
+/// ranges smaller than \p grain_size run on the calling thread.
+template <typename func_t>
+void ParallelFor(int64_t begin,
+                 int64_t end,
+                 int64_t grain_size,
+                 const func_t& func) {
+    if (begin >= end) {
+        return;
+    }
+    int64_t chunk_size = GetChunkSize(end - begin, grain_size);
+    int64_t num_chunks = (end - begin + chunk_size - 1) / chunk_size;
+    if (num_chunks == 1 || InParallel()) {
+        func(begin, end);
+        return;
+    }
+    ParallelForChunks(num_chunks, [&](int64_t chunk_idx) {
+        int64_t chunk_begin = begin + chunk_idx * chunk_size;
+        func(chunk_begin, std::min(chunk_begin + chunk_size, end));
+    });
+}
+
+/// Reduces [begin, end) in parallel. \p func(range_begin, range_end, init)
+/// returns the reduction of a sub-range starting from \p identity, and
+/// \p combine(a, b) combines two partial results. Partial results are
+/// combined in the order of their ranges, so the result does not depend on
+/// the scheduling, but may depend on the number of threads for
+/// non-associative (e.g. floating point) \p combine.
+template <typename scalar_t, typename func_t, typename combine_t>
+scalar_t ParallelReduce(int64_t begin,
+                        int64_t end,
+                        int64_t grain_size,
+                        const scalar_t& identity,
+                        const func_t& func,
+                        const combine_t& combine) {
+    if (begin >= end) {
+        return identity;
+    }
+    int64_t chunk_size = GetChunkSize(end - begin, grain_size);
+    int64_t num_chunks = (end - begin + chunk_size - 1) / chunk_size;
+    if (num_chunks == 1 || InParallel()) {
+        return func(begin, end, identity);
+    }
+    std::vector<scalar_t> chunk_results(num_chunks, identity);
+    ParallelForChunks(num_chunks, [&](int64_t chunk_idx) {
+        int64_t chunk_begin = begin + chunk_idx * chunk_size;
+        chunk_results[chunk_idx] =
+                func(chunk_begin, std::min(chunk_begin + chunk_size, end),
+                     identity);
+    });
+    scalar_t result = identity;
+    for (const scalar_t& chunk_result : chunk_results) {
+        result = combine(result, chunk_result);
+    }
+    return result;
+}
+
+/// Parallel prefix scan over [begin, end) in two passes, similar to
+/// tbb::parallel_scan. \p func(range_begin, range_end, prefix, is_final)
+/// must return \p prefix combined with the elements of the sub-range, and
+/// write the scanned outputs of the sub-range only if \p is_final is true.
+/// \p combine(a, b) combines two partial results.
+///
+/// \return The combination of all elements.
+template <typename scalar_t, typename func_t, typename combine_t>
+scalar_t ParallelScan(int64_t begin,
+                      int64_t end,
+                      int64_t grain_size,
+                      const scalar_t& identity,
+                      const func_t& func,
+                      const combine_t& combine) {
+    if (begin >= end) {
+        return identity;
+    }
+    int64_t chunk_size = GetChunkSize(end - begin, grain_size);
+    int64_t num_chunks = (end - begin + chunk_size - 1) / chunk_size;
+    if (num_chunks == 1 || InParallel()) {
+        return func(begin, end, identity, true);
+    }
+
+    // Pass 1: reduce each chunk.
+    std::vector<scalar_t> chunk_prefixes(num_chunks, identity);
+    ParallelForChunks(num_chunks, [&](int64_t chunk_idx) {
+        int64_t chunk_begin = begin + chunk_idx * chunk_size;
+        chunk_prefixes[chunk_idx] =
+                func(chunk_begin, std::min(chunk_begin + chunk_size, end),
+                     identity, false);
+    });
+    scalar_t total = identity;
+    for (scalar_t& chunk_prefix : chunk_prefixes) {
+        scalar_t chunk_total = chunk_prefix;
+        chunk_prefix = total;
+        total = combine(total, chunk_total);
+    }
+
+    // Pass 2: scan each chunk starting from the reduction of its
+    // predecessors.
+    ParallelForChunks(num_chunks, [&](int64_t chunk_idx) {
+        int64_t chunk_begin = begin + chunk_idx * chunk_size;
+        func(chunk_begin, std::min(chunk_begin + chunk_size, end),
+             chunk_prefixes[chunk_idx], true);
+    });
+    return total;
 }
 
 }  // namespace parallel_util
@@ -0,0 +1,298 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+namespace {
+
+/// A Chrome trace event: a complete op call ('X') or a counter ('C').
+struct TraceEvent {
+    std::string name;
+    char phase;
+    int64_t thread_id;
+    double timestamp_us;
+    double duration_us;
+    int64_t num_bytes;
+};
+
+struct ProfilerState {
+    std::mutex mutex;
+    std::map<std::string, ProfilerOpStatistics> op_statistics;
+    std::map<std::string, ProfilerMemoryStatistics> memory_statistics;
+    /// Live allocations: pointer -> (byte size, device).
+    std::unordered_map<const void*, std::pair<int64_t, std::string>>
+            allocations;
+    std::vector<TraceEvent> events;
+    std::unordered_map<std::thread::id, int64_t> thread_ids;
+    std::chrono::steady_clock::time_point origin =
+            std::chrono::steady_clock::now();
+
+    /// Small sequential id of the calling thread, for the trace. The mutex
+    /// must be held.
+    int64_t GetThreadId() {
+        auto it = thread_ids.emplace(std::this_thread::get_id(),
+                                     static_cast<int64_t>(thread_ids.size()));
+        return it.first->second;
+    }
+
+    double ToMicroseconds(std::chrono::steady_clock::time_point t) const {
+        return std::chrono::duration<double, std::micro>(t - origin).count();
+    }
+
+    void AddEvent(TraceEvent event) {
+        if (static_cast<int64_t>(events.size()) < Profiler::kMaxTraceEvents) {
+            events.push_back(std::move(event));
+        }
+    }
+};
+
+ProfilerState& GetState() {
+    static ProfilerState state;
+    return state;
+}
+
+std::atomic<bool> s_enabled(false);
+
+/// Size of ProfilerState::allocations, readable without the mutex.
+std::atomic<int64_t> s_num_tracked_allocations(0);
+
+/// Allocations made by the current thread, to attribute them to ops.
+thread_local int64_t tl_num_allocations = 0;
+thread_local int64_t tl_allocated_byte_size = 0;
+
+}  // namespace
+
+constexpr int64_t Profiler::kMaxTraceEvents;
+
+void Profiler::Enable() { s_enabled = true; }
+
+void Profiler::Disable() { s_enabled = false; }
+
+bool Profiler::IsEnabled() { return s_enabled; }
+
+bool Profiler::HasTrackedAllocations() {
+    return s_num_tracked_allocations > 0;
+}
+
+void Profiler::Reset() {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.op_statistics.clear();
+    state.memory_statistics.clear();
+    state.allocations.clear();
+    s_num_tracked_allocations = 0;
+    state.events.clear();
+    state.origin = std::chrono::steady_clock::now();
+}
+
+std::map<std::string, ProfilerOpStatistics> Profiler::GetOpStatistics() {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.op_statistics;
+}
+
+std::map<std::string, ProfilerMemoryStatistics>
+Profiler::GetMemoryStatistics() {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.memory_statistics;
+}
+
+std::string Profiler::GetSummary() {
+    std::vector<std::pair<std::string, ProfilerOpStatistics>> ops;
+    for (const auto& kv : GetOpStatistics()) {
+        ops.push_back(kv);
+    }
+    std::sort(ops.begin(), ops.end(), [](const auto& a, const auto& b) {
+        return a.second.time_ms > b.second.time_ms;
+    });
+
+    const double kMB = 1024.0 * 1024.0;
+    std::ostringstream rc;
+    rc << fmt::format("{:<16}{:>10}{:>14}{:>14}{:>10}{:>14}\n", "Op", "Calls",
+                      "Time (ms)", "Bytes (MB)", "Allocs", "Alloc (MB)");
+    for (const auto& kv : ops) {
+        const ProfilerOpStatistics& op = kv.second;
+        rc << fmt::format("{:<16}{:>10}{:>14.3f}{:>14.3f}{:>10}{:>14.3f}\n",
+                          kv.first, op.num_calls, op.time_ms,
+                          op.num_bytes / kMB, op.num_allocations,
+                          op.allocated_byte_size / kMB);
+    }
+    for (const auto& kv : GetMemoryStatistics()) {
+        const ProfilerMemoryStatistics& memory = kv.second;
+        rc << fmt::format(
+                "{}: {} allocations, {:.3f} MB allocated, largest {:.3f} MB, "
+                "peak {:.3f} MB, {:.3f} MB not freed\n",
+                kv.first, memory.num_allocations,
+                memory.allocated_byte_size / kMB,
+                memory.max_allocation_byte_size / kMB,
+                memory.peak_byte_size / kMB, memory.current_byte_size / kMB);
+    }
+    return rc.str();
+}
+
+void Profiler::ExportChromeTrace(const std::string& file_name) {
+    std::ofstream file(file_name);
+    if (!file) {
+        utility::LogError("Cannot open {} for writing.", file_name);
+    }
+
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    file << "{\"traceEvents\": [";
+    for (size_t i = 0; i < state.events.size(); ++i) {
+        const TraceEvent& event = state.events[i];
+        file << (i == 0 ? "\n" : ",\n");
+        if (event.phase == 'X') {
+            file << fmt::format(
+                    "{{\"name\": \"{}\", \"cat\": \"op\", \"ph\": \"X\", "
+                    "\"pid\": 0, \"tid\": {}, \"ts\": {:.3f}, \"dur\": {:.3f}, "
+                    "\"args\": {{\"bytes\": {}}}}}",
+                    event.name, event.thread_id, event.timestamp_us,
+                    event.duration_us, event.num_bytes);
+        } else {
+            file << fmt::format(
+                    "{{\"name\": \"{}\", \"ph\": \"C\", \"pid\": 0, "
+                    "\"tid\": {}, \"ts\": {:.3f}, "
+                    "\"args\": {{\"bytes\": {}}}}}",
+                    event.name, event.thread_id, event.timestamp_us,
+                    event.num_bytes);
+        }
+    }
+    file << "\n], \"displayTimeUnit\": \"ms\"}\n";
+    if (!file) {
+        utility::LogError("Failed to write {}.", file_name);
+    }
+}
+
+void Profiler::RecordOp(const char* op_name,
+                        int64_t num_bytes,
+                        std::chrono::steady_clock::time_point start,
+                        std::chrono::steady_clock::time_point end,
+                        int64_t num_allocations,
+                        int64_t allocated_byte_size) {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    ProfilerOpStatistics& op = state.op_statistics[op_name];
+    op.num_calls++;
+    op.num_bytes += num_bytes;
+    op.time_ms +=
+            std::chrono::duration<double, std::milli>(end - start).count();
+    op.num_allocations += num_allocations;
+    op.allocated_byte_size += allocated_byte_size;
+
+    double start_us = state.ToMicroseconds(start);
+    state.AddEvent({op_name, 'X', state.GetThreadId(), start_us,
+                    state.ToMicroseconds(end) - start_us, num_bytes});
+}
+
+void Profiler::RecordMalloc(const void* ptr,
+                            size_t byte_size,
+                            const Device& device) {
+    tl_num_allocations++;
+    tl_allocated_byte_size += byte_size;
+
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::string device_str = device.ToString();
+    ProfilerMemoryStatistics& memory = state.memory_statistics[device_str];
+    memory.num_allocations++;
+    memory.allocated_byte_size += byte_size;
+    memory.max_allocation_byte_size = std::max(
+            memory.max_allocation_byte_size, static_cast<int64_t>(byte_size));
+    memory.current_byte_size += byte_size;
+    memory.peak_byte_size =
+            std::max(memory.peak_byte_size, memory.current_byte_size);
+    state.allocations[ptr] = {static_cast<int64_t>(byte_size), device_str};
+    s_num_tracked_allocations = static_cast<int64_t>(state.allocations.size());
+
+    state.AddEvent({"Memory " + device_str, 'C', 0,
+                    state.ToMicroseconds(std::chrono::steady_clock::now()), 0,
+                    memory.current_byte_size});
+}
+
+void Profiler::RecordFree(const void* ptr, const Device& device) {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    // Memory allocated before profiling was enabled is not tracked.
+    auto it = state.allocations.find(ptr);
+    if (it == state.allocations.end()) {
+        return;
+    }
+    ProfilerMemoryStatistics& memory =
+            state.memory_statistics[it->second.second];
+    memory.current_byte_size -= it->second.first;
+    if (s_enabled) {
+        state.AddEvent({"Memory " + it->second.second, 'C', 0,
+                        state.ToMicroseconds(std::chrono::steady_clock::now()),
+                        0, memory.current_byte_size});
+    }
+    state.allocations.erase(it);
+    s_num_tracked_allocations = static_cast<int64_t>(state.allocations.size());
+}
+
+ProfilerScope::ProfilerScope(
+        const char* op_name,
+        std::initializer_list<std::reference_wrapper<const Tensor>> tensors) {
+    if (!Profiler::IsEnabled()) {
+        return;
+    }
+    op_name_ = op_name;
+    for (const Tensor& tensor : tensors) {
+        num_bytes_ += tensor.NumElements() *
+                      DtypeUtil::ByteSize(tensor.GetDtype());
+    }
+    num_allocations_ = tl_num_allocations;
+    allocated_byte_size_ = tl_allocated_byte_size;
+    start_ = std::chrono::steady_clock::now();
+}
+
+ProfilerScope::~ProfilerScope() {
+    if (op_name_ == nullptr) {
+        return;
+    }
+    Profiler::RecordOp(op_name_, num_bytes_, start_,
+                       std::chrono::steady_clock::now(),
+                       tl_num_allocations - num_allocations_,
+                       tl_allocated_byte_size - allocated_byte_size_);
+}
+
+}  // namespace open3d
@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <map>
+#include <string>
+
+#include "Open3D/Core/Device.h"
+
+namespace open3d {
+
+class Tensor;
+
+/// Aggregated statistics of one op, e.g. "Add" or "IndexGet".
+struct ProfilerOpStatistics {
+    /// Number of calls.
+    int64_t num_calls = 0;
+    /// Total byte size of the tensors read and written by the calls.
+    int64_t num_bytes = 0;
+    /// Total wall time of the calls in milliseconds.
+    double time_ms = 0;
+    /// Number of MemoryManager allocations made during the calls.
+    int64_t num_allocations = 0;
+    /// Total byte size of the allocations made during the calls.
+    int64_t allocated_byte_size = 0;
+};
+
+/// MemoryManager allocations of one device while profiling was enabled.
+struct ProfilerMemoryStatistics {
+    int64_t num_allocations = 0;
+    /// Total byte size of all allocations.
+    int64_t allocated_byte_size = 0;
+    /// Byte size of the largest allocation.
+    int64_t max_allocation_byte_size = 0;
+    /// Byte size of the allocations that are not freed yet.
+    int64_t current_byte_size = 0;
+    /// Maximum of current_byte_size.
+    int64_t peak_byte_size = 0;
+};
+
+/// Opt-in profiler for Core ops and MemoryManager allocations.
+///
+/// When enabled, the kernel dispatchers record the call count, the bytes of
+/// the tensors involved and the wall time of each op, and MemoryManager
+/// records every allocation. Allocations are attributed to the op that is
+/// running on the allocating thread. Nested ops, e.g. a Copy inside IndexGet,
+/// are included in the outer op's time. CUDA kernels are asynchronous, so
+/// their time only covers the launch unless the op synchronizes.
+///
+/// ```cpp
+/// Profiler::Enable();
+/// RunPipeline();
+/// Profiler::Disable();
+/// utility::LogInfo("{}", Profiler::GetSummary());
+/// Profiler::ExportChromeTrace("trace.json");  // Open in chrome://tracing.
+/// ```
+class Profiler {
+public:
+    /// Starts recording. Statistics accumulate until Reset() is called.
+    static void Enable();
+
+    /// Stops recording. Collected statistics are kept, and frees of the
+    /// allocations recorded so far still update them.
+    static void Disable();
+
+    static bool IsEnabled();
+
+    /// Returns true while allocations recorded when profiling was enabled are
+    /// not freed yet. MemoryManager keeps recording frees until then, also
+    /// after Disable(), such that the live allocation statistics stay exact.
+    static bool HasTrackedAllocations();
+
+    /// Discards all collected statistics and trace events.
+    static void Reset();
+
+    /// Returns the statistics per op name.
+    static std::map<std::string, ProfilerOpStatistics> GetOpStatistics();
+
+    /// Returns the allocation statistics per device, e.g. "CPU:0".
+    static std::map<std::string, ProfilerMemoryStatistics>
+    GetMemoryStatistics();
+
+    /// Returns a table of the op statistics sorted by time, followed by the
+    /// allocation statistics of each device.
+    static std::string GetSummary();
+
+    /// Writes the recorded op calls and memory usage as a Chrome trace JSON
+    /// file, to be viewed in chrome://tracing or Perfetto. At most
+    /// kMaxTraceEvents events are kept.
+    static void ExportChromeTrace(const std::string& file_name);
+
+    static constexpr int64_t kMaxTraceEvents = 1 << 20;
+
+    /// Records one call of \p op_name, called by ProfilerScope.
+    static void RecordOp(const char* op_name,
+                         int64_t num_bytes,
+                         std::chrono::steady_clock::time_point start,
+                         std::chrono::steady_clock::time_point end,
+                         int64_t num_allocations,
+                         int64_t allocated_byte_size);
+
+    /// Records an allocation, called by MemoryManager if enabled.
+    static void RecordMalloc(const void* ptr,
+                             size_t byte_size,
+                             const Device& device);
+
+    /// Records a deallocation, called by MemoryManager if enabled or if
+    /// HasTrackedAllocations().
+    static void RecordFree(const void* ptr, const Device& device);
+};
+
+/// Records the enclosing op call when the Profiler is enabled, and does
+/// nothing otherwise.
+///
+/// ```cpp
+/// ProfilerScope scope("Add", {lhs, rhs, dst});
+/// ```
+class ProfilerScope {
+public:
+    /// \param op_name Name of the op, must outlive the scope.
+    /// \param tensors Tensors read or written by the op.
+    ProfilerScope(
+            const char* op_name,
+            std::initializer_list<std::reference_wrapper<const Tensor>>
+                    tensors);
+    ~ProfilerScope();
+
+    ProfilerScope(const ProfilerScope&) = delete;
+    ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+private:
+    /// nullptr if the Profiler was disabled when the scope started.
+    const char* op_name_ = nullptr;
+    int64_t num_bytes_ = 0;
+    int64_t num_allocations_ = 0;
+    int64_t allocated_byte_size_ = 0;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace open3d
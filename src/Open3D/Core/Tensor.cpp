@@ -26,7 +26,9 @@
 
 #include "Open3D/Core/Tensor.h"
 
+#include <algorithm>
 #include <sstream>
+#include <unordered_map>
 
 #include "Open3D/Core/AdvancedIndexing.h"
 #include "Open3D/Core/Blob.h"
@@ -34,10 +36,12 @@
 #include "Open3D/Core/Dispatch.h"
 #include "Open3D/Core/Dtype.h"
 #include "Open3D/Core/Kernel/Kernel.h"
+#include "Open3D/Core/NumpyIO.h"
 #include "Open3D/Core/ShapeUtil.h"
 #include "Open3D/Core/SizeVector.h"
 #include "Open3D/Core/TensorKey.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
 
 namespace open3d {
 
@@ -545,7 +549,53 @@ Tensor Tensor::Slice(int64_t dim,
     return Tensor(new_shape, new_strides, new_data_ptr, dtype_, blob_);
 }
 
+/// Whether indexing \p t with the single index tensor \p index can use the
+/// row kernels, which gather or scatter whole rows with memcpy.
+static bool CanIndexRows(const Tensor& t, const Tensor& index) {
+    if (t.GetDevice().GetType() != Device::DeviceType::CPU ||
+        index.GetDevice() != t.GetDevice() ||
+        index.GetDtype() != Dtype::Int64 || t.NumDims() == 0 ||
+        index.NumDims() == 0) {
+        return false;
+    }
+    const SizeVector& shape = t.GetShapeRef();
+    const SizeVector& strides = t.GetStridesRef();
+    SizeVector row_shape(shape.begin() + 1, shape.end());
+    SizeVector row_strides(strides.begin() + 1, strides.end());
+    return row_strides == Tensor::DefaultStrides(row_shape);
+}
+
+/// Shape of the rows of \p t selected by \p index, (index.shape, t.shape[1:]).
+static SizeVector IndexedRowsShape(const Tensor& t, const Tensor& index) {
+    SizeVector shape = index.GetShape();
+    shape.insert(shape.end(), t.GetShapeRef().begin() + 1,
+                 t.GetShapeRef().end());
+    return shape;
+}
+
 Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
+    // A single Bool mask over the leading dimensions selects rows, which is
+    // done without expanding the mask to index tensors.
+    if (index_tensors.size() == 1 &&
+        GetDevice().GetType() == Device::DeviceType::CPU) {
+        const Tensor& mask = index_tensors[0];
+        if (mask.GetDtype() == Dtype::Bool && mask.NumDims() > 0 &&
+            mask.NumDims() <= NumDims() && mask.GetDevice() == GetDevice() &&
+            std::equal(mask.GetShapeRef().begin(), mask.GetShapeRef().end(),
+                       shape_.begin())) {
+            return MaskedSelect(mask);
+        }
+    }
+    // A single integer index tensor gathers whole rows, e.g. points[idx].
+    if (index_tensors.size() == 1 && CanIndexRows(*this, index_tensors[0])) {
+        const Tensor& index = index_tensors[0];
+        SizeVector dst_shape = IndexedRowsShape(*this, index);
+        SizeVector dst_rows_shape(shape_);
+        dst_rows_shape[0] = index.NumElements();
+        Tensor dst(dst_rows_shape, dtype_, GetDevice());
+        kernel::IndexGetRows(*this, index, dst);
+        return dst.View(dst_shape);
+    }
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
     kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
@@ -556,12 +606,45 @@ Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
 
 void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                       const Tensor& src_tensor) {
+    // A single integer index tensor scatters whole rows, if src_tensor does
+    // not need to be broadcasted or copied to another device or dtype.
+    if (index_tensors.size() == 1 && CanIndexRows(*this, index_tensors[0]) &&
+        src_tensor.GetDevice() == GetDevice() &&
+        src_tensor.GetDtype() == dtype_ &&
+        src_tensor.GetShape() == IndexedRowsShape(*this, index_tensors[0])) {
+        SizeVector src_rows_shape(shape_);
+        src_rows_shape[0] = index_tensors[0].NumElements();
+        kernel::IndexSetRows(src_tensor.Reshape(src_rows_shape),
+                             index_tensors[0], *this);
+        return;
+    }
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor pre_processed_dst = aip.GetTensor();
     kernel::IndexSet(src_tensor, pre_processed_dst, aip.GetIndexTensors(),
                      aip.GetIndexedShape(), aip.GetIndexedStrides());
 }
 
+Tensor Tensor::IndexAdd_(const Tensor& index, const Tensor& src) {
+    if (NumDims() == 0) {
+        utility::LogError("IndexAdd_ is not supported for 0-dim tensors.");
+    }
+    if (src.GetShape() != IndexedRowsShape(*this, index)) {
+        utility::LogError("Expected src of shape {}, but got {}.",
+                          IndexedRowsShape(*this, index), src.GetShape());
+    }
+    SizeVector src_rows_shape(shape_);
+    src_rows_shape[0] = index.NumElements();
+    Tensor src_rows = src.Reshape(src_rows_shape);
+    if (CanIndexRows(*this, index)) {
+        kernel::IndexAddRows(src_rows, index, *this);
+    } else {
+        Tensor dst = Contiguous();
+        kernel::IndexAddRows(src_rows, index, dst);
+        AsRvalue() = dst;
+    }
+    return *this;
+}
+
 Tensor Tensor::Permute(const SizeVector& dims) const {
     // Check dimension size
     if (static_cast<int64_t>(dims.size()) != NumDims()) {
@@ -629,10 +712,14 @@ Tensor Tensor::T() const {
 Tensor Tensor::Add(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
-    kernel::Add(*this, value, dst_tensor);
+    Add(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Add(const Tensor& value, Tensor& dst) const {
+    kernel::Add(*this, value, dst);
+}
+
 Tensor Tensor::Add_(const Tensor& value) {
     kernel::Add(*this, value, *this);
     return *this;
@@ -641,10 +728,14 @@ Tensor Tensor::Add_(const Tensor& value) {
 Tensor Tensor::Sub(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
-    kernel::Sub(*this, value, dst_tensor);
+    Sub(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Sub(const Tensor& value, Tensor& dst) const {
+    kernel::Sub(*this, value, dst);
+}
+
 Tensor Tensor::Sub_(const Tensor& value) {
     kernel::Sub(*this, value, *this);
     return *this;
@@ -653,10 +744,14 @@ Tensor Tensor::Sub_(const Tensor& value) {
 Tensor Tensor::Mul(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
-    kernel::Mul(*this, value, dst_tensor);
+    Mul(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Mul(const Tensor& value, Tensor& dst) const {
+    kernel::Mul(*this, value, dst);
+}
+
 Tensor Tensor::Mul_(const Tensor& value) {
     kernel::Mul(*this, value, *this);
     return *this;
@@ -665,15 +760,107 @@ Tensor Tensor::Mul_(const Tensor& value) {
 Tensor Tensor::Div(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
-    kernel::Div(*this, value, dst_tensor);
+    Div(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Div(const Tensor& value, Tensor& dst) const {
+    kernel::Div(*this, value, dst);
+}
+
 Tensor Tensor::Div_(const Tensor& value) {
     kernel::Div(*this, value, *this);
     return *this;
 }
 
+Tensor Tensor::Maximum(const Tensor& value) const {
+    Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
+                      dtype_, GetDevice());
+    Maximum(value, dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Maximum(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Maximum);
+}
+
+Tensor Tensor::Maximum_(const Tensor& value) {
+    kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::Maximum);
+    return *this;
+}
+
+Tensor Tensor::Minimum(const Tensor& value) const {
+    Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
+                      dtype_, GetDevice());
+    Minimum(value, dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Minimum(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Minimum);
+}
+
+Tensor Tensor::Minimum_(const Tensor& value) {
+    kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::Minimum);
+    return *this;
+}
+
+Tensor Tensor::Pow(const Tensor& value) const {
+    Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
+                      dtype_, GetDevice());
+    Pow(value, dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Pow(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Pow);
+}
+
+Tensor Tensor::Pow_(const Tensor& value) {
+    kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::Pow);
+    return *this;
+}
+
+Tensor Tensor::Clamp(const Tensor& min_val, const Tensor& max_val) const {
+    Tensor dst_tensor(
+            shape_util::BroadcastedShape(
+                    shape_util::BroadcastedShape(shape_, min_val.shape_),
+                    max_val.shape_),
+            dtype_, GetDevice());
+    Clamp(min_val, max_val, dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Clamp(const Tensor& min_val,
+                   const Tensor& max_val,
+                   Tensor& dst) const {
+    kernel::Clamp(*this, min_val, max_val, dst);
+}
+
+Tensor Tensor::Clamp_(const Tensor& min_val, const Tensor& max_val) {
+    kernel::Clamp(*this, min_val, max_val, *this);
+    return *this;
+}
+
+Tensor Tensor::Where(const Tensor& condition,
+                     const Tensor& x,
+                     const Tensor& y) {
+    Tensor dst_tensor(
+            shape_util::BroadcastedShape(
+                    shape_util::BroadcastedShape(condition.shape_, x.shape_),
+                    y.shape_),
+            x.dtype_, x.GetDevice());
+    Where(condition, x, y, dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Where(const Tensor& condition,
+                   const Tensor& x,
+                   const Tensor& y,
+                   Tensor& dst) {
+    kernel::Where(condition, x, y, dst);
+}
+
 Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -734,12 +921,162 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+Tensor Tensor::Cumsum(int64_t dim, bool exclusive) const {
+    if (NumDims() == 0) {
+        return Reshape({1}).Cumsum(0, exclusive).Reshape({});
+    }
+    Tensor dst(shape_, dtype_, GetDevice());
+    kernel::Scan(*this, dst, dim, exclusive, kernel::ScanOpCode::Sum);
+    return dst;
+}
+
+Tensor Tensor::Cumprod(int64_t dim, bool exclusive) const {
+    if (NumDims() == 0) {
+        return Reshape({1}).Cumprod(0, exclusive).Reshape({});
+    }
+    Tensor dst(shape_, dtype_, GetDevice());
+    kernel::Scan(*this, dst, dim, exclusive, kernel::ScanOpCode::Prod);
+    return dst;
+}
+
+/// Allocates the output of a segment reduction and runs it.
+static Tensor SegmentReduction(const Tensor& values,
+                               const Tensor& prefix_sum,
+                               kernel::SegmentReductionOpCode op_code) {
+    if (values.NumDims() == 0 || prefix_sum.NumDims() != 1) {
+        utility::LogError(
+                "Segment reductions expect values with at least one "
+                "dimension and a 1D prefix_sum, but got shapes {} and {}.",
+                values.GetShape(), prefix_sum.GetShape());
+    }
+    SizeVector dst_shape = values.GetShape();
+    dst_shape[0] = prefix_sum.GetShape()[0];
+    bool arg_reduction = op_code == kernel::SegmentReductionOpCode::ArgMin ||
+                         op_code == kernel::SegmentReductionOpCode::ArgMax;
+    Tensor dst(dst_shape, arg_reduction ? Dtype::Int64 : values.GetDtype(),
+               values.GetDevice());
+    kernel::SegmentReduce(values, prefix_sum, dst, op_code);
+    return dst;
+}
+
+Tensor Tensor::SegmentSum(const Tensor& prefix_sum) const {
+    return SegmentReduction(*this, prefix_sum,
+                            kernel::SegmentReductionOpCode::Sum);
+}
+
+Tensor Tensor::SegmentMean(const Tensor& prefix_sum) const {
+    if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+        utility::LogError(
+                "Can only compute mean for Float32 or Float64, got {} instead.",
+                DtypeUtil::ToString(dtype_));
+    }
+    return SegmentReduction(*this, prefix_sum,
+                            kernel::SegmentReductionOpCode::Mean);
+}
+
+Tensor Tensor::SegmentMin(const Tensor& prefix_sum) const {
+    return SegmentReduction(*this, prefix_sum,
+                            kernel::SegmentReductionOpCode::Min);
+}
+
+Tensor Tensor::SegmentMax(const Tensor& prefix_sum) const {
+    return SegmentReduction(*this, prefix_sum,
+                            kernel::SegmentReductionOpCode::Max);
+}
+
+Tensor Tensor::SegmentArgMin(const Tensor& prefix_sum) const {
+    return SegmentReduction(*this, prefix_sum,
+                            kernel::SegmentReductionOpCode::ArgMin);
+}
+
+Tensor Tensor::SegmentArgMax(const Tensor& prefix_sum) const {
+    return SegmentReduction(*this, prefix_sum,
+                            kernel::SegmentReductionOpCode::ArgMax);
+}
+
+Tensor Tensor::Load(const std::string& file_name) {
+    std::string ext =
+            utility::filesystem::GetFileExtensionInLowerCase(file_name);
+    if (ext == "npy") {
+        return ReadNpy(file_name);
+    } else if (ext == "npz") {
+        std::unordered_map<std::string, Tensor> tensors = ReadNpz(file_name);
+        if (tensors.size() != 1) {
+            utility::LogError(
+                    "Expected a single array in {}, but got {}. Use ReadNpz "
+                    "to read all arrays.",
+                    file_name, tensors.size());
+        }
+        return tensors.begin()->second;
+    }
+    utility::LogError(
+            "Unsupported file extension of {}, expected .npy or .npz.",
+            file_name);
+}
+
+void Tensor::Save(const std::string& file_name) const {
+    std::string ext =
+            utility::filesystem::GetFileExtensionInLowerCase(file_name);
+    if (ext == "npy") {
+        WriteNpy(file_name, *this);
+    } else if (ext == "npz") {
+        WriteNpz(file_name, {{"arr_0", *this}});
+    } else {
+        utility::LogError(
+                "Unsupported file extension of {}, expected .npy or .npz.",
+                file_name);
+    }
+}
+
+Tensor Tensor::Sort(int64_t dim, bool descending) const {
+    if (NumDims() == 0) {
+        return Reshape({1}).Sort(0, descending).Reshape({});
+    }
+    Tensor dst_values(shape_, dtype_, GetDevice());
+    Tensor dst_indices(shape_, Dtype::Int64, GetDevice());
+    kernel::Sort(*this, dst_values, dst_indices, dim, descending);
+    return dst_values;
+}
+
+Tensor Tensor::ArgSort(int64_t dim, bool descending) const {
+    if (NumDims() == 0) {
+        return Reshape({1}).ArgSort(0, descending).Reshape({});
+    }
+    Tensor dst_values(shape_, dtype_, GetDevice());
+    Tensor dst_indices(shape_, Dtype::Int64, GetDevice());
+    kernel::Sort(*this, dst_values, dst_indices, dim, descending);
+    return dst_indices;
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique() const {
+    return kernel::Unique(*this);
+}
+
+std::pair<Tensor, Tensor> Tensor::TopK(int64_t k,
+                                       int64_t dim,
+                                       bool largest) const {
+    if (NumDims() == 0) {
+        return Reshape({1}).TopK(k, 0, largest);
+    }
+    dim = shape_util::WrapDim(dim, NumDims());
+    SizeVector dst_shape = shape_;
+    dst_shape[dim] = k;
+    Tensor dst_values(dst_shape, dtype_, GetDevice());
+    Tensor dst_indices(dst_shape, Dtype::Int64, GetDevice());
+    kernel::TopK(*this, dst_values, dst_indices, k, dim, largest);
+    return std::make_pair(dst_values, dst_indices);
+}
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
-    kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
+    Sqrt(dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Sqrt(Tensor& dst) const {
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Sqrt);
+}
+
 Tensor Tensor::Sqrt_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Sqrt);
     return *this;
@@ -747,10 +1084,14 @@ Tensor Tensor::Sqrt_() {
 
 Tensor Tensor::Sin() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
-    kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sin);
+    Sin(dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Sin(Tensor& dst) const {
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Sin);
+}
+
 Tensor Tensor::Sin_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Sin);
     return *this;
@@ -758,10 +1099,14 @@ Tensor Tensor::Sin_() {
 
 Tensor Tensor::Cos() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
-    kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Cos);
+    Cos(dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Cos(Tensor& dst) const {
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Cos);
+}
+
 Tensor Tensor::Cos_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Cos);
     return *this;
@@ -769,10 +1114,14 @@ Tensor Tensor::Cos_() {
 
 Tensor Tensor::Neg() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
-    kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Neg);
+    Neg(dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Neg(Tensor& dst) const {
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Neg);
+}
+
 Tensor Tensor::Neg_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Neg);
     return *this;
@@ -780,10 +1129,14 @@ Tensor Tensor::Neg_() {
 
 Tensor Tensor::Exp() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
-    kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Exp);
+    Exp(dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Exp(Tensor& dst) const {
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Exp);
+}
+
 Tensor Tensor::Exp_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Exp);
     return *this;
@@ -791,15 +1144,89 @@ Tensor Tensor::Exp_() {
 
 Tensor Tensor::Abs() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
-    kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Abs);
+    Abs(dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Abs(Tensor& dst) const {
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Abs);
+}
+
 Tensor Tensor::Abs_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Abs);
     return *this;
 }
 
+Tensor Tensor::Floor() const {
+    Tensor dst_tensor(shape_, dtype_, GetDevice());
+    Floor(dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Floor(Tensor& dst) const {
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Floor);
+}
+
+Tensor Tensor::Floor_() {
+    kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Floor);
+    return *this;
+}
+
+Tensor Tensor::Log() const {
+    Tensor dst_tensor(shape_, dtype_, GetDevice());
+    Log(dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Log(Tensor& dst) const {
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Log);
+}
+
+Tensor Tensor::Log_() {
+    kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Log);
+    return *this;
+}
+
+Tensor Tensor::Matmul(const Tensor& rhs) const {
+    if (NumDims() < 2 || rhs.NumDims() < 2) {
+        utility::LogError(
+                "Matmul expects tensors with at least 2 dimensions, but got "
+                "shapes {} and {}.",
+                shape_, rhs.shape_);
+    }
+    SizeVector dst_shape = shape_util::BroadcastedShape(
+            SizeVector(shape_.begin(), shape_.end() - 2),
+            SizeVector(rhs.shape_.begin(), rhs.shape_.end() - 2));
+    dst_shape.push_back(shape_[NumDims() - 2]);
+    dst_shape.push_back(rhs.shape_[rhs.NumDims() - 1]);
+    Tensor dst_tensor(dst_shape, dtype_, GetDevice());
+    kernel::Matmul(*this, rhs, dst_tensor);
+    return dst_tensor;
+}
+
+Tensor Tensor::Inverse() const {
+    Tensor dst_tensor(shape_, dtype_, GetDevice());
+    kernel::Inverse(*this, dst_tensor);
+    return dst_tensor;
+}
+
+Tensor Tensor::Solve(const Tensor& rhs) const {
+    Tensor dst_tensor(rhs.shape_, dtype_, GetDevice());
+    kernel::Solve(*this, rhs, dst_tensor);
+    return dst_tensor;
+}
+
+std::pair<Tensor, Tensor> Tensor::SymmetricEigen() const {
+    if (NumDims() < 1) {
+        utility::LogError("SymmetricEigen expects a (..., n, n) tensor.");
+    }
+    Tensor eigenvalues(SizeVector(shape_.begin(), shape_.end() - 1), dtype_,
+                       GetDevice());
+    Tensor eigenvectors(shape_, dtype_, GetDevice());
+    kernel::SymmetricEigen(*this, eigenvalues, eigenvectors);
+    return std::make_pair(eigenvalues, eigenvectors);
+}
+
 Device Tensor::GetDevice() const {
     if (blob_ == nullptr) {
         utility::LogError("Blob is null, cannot get device");
@@ -809,10 +1236,14 @@ Device Tensor::GetDevice() const {
 
 Tensor Tensor::LogicalNot() const {
     Tensor dst_tensor(shape_, Dtype::Bool, GetDevice());
-    kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::LogicalNot);
+    LogicalNot(dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::LogicalNot(Tensor& dst) const {
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::LogicalNot);
+}
+
 Tensor Tensor::LogicalNot_() {
     kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::LogicalNot);
     return *this;
@@ -821,11 +1252,14 @@ Tensor Tensor::LogicalNot_() {
 Tensor Tensor::LogicalAnd(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
-    kernel::BinaryEW(*this, value, dst_tensor,
-                     kernel::BinaryEWOpCode::LogicalAnd);
+    LogicalAnd(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::LogicalAnd(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::LogicalAnd);
+}
+
 Tensor Tensor::LogicalAnd_(const Tensor& value) {
     kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::LogicalAnd);
     return *this;
@@ -834,11 +1268,14 @@ Tensor Tensor::LogicalAnd_(const Tensor& value) {
 Tensor Tensor::LogicalOr(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
-    kernel::BinaryEW(*this, value, dst_tensor,
-                     kernel::BinaryEWOpCode::LogicalOr);
+    LogicalOr(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::LogicalOr(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::LogicalOr);
+}
+
 Tensor Tensor::LogicalOr_(const Tensor& value) {
     kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::LogicalOr);
     return *this;
@@ -847,11 +1284,14 @@ Tensor Tensor::LogicalOr_(const Tensor& value) {
 Tensor Tensor::LogicalXor(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
-    kernel::BinaryEW(*this, value, dst_tensor,
-                     kernel::BinaryEWOpCode::LogicalXor);
+    LogicalXor(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::LogicalXor(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::LogicalXor);
+}
+
 Tensor Tensor::LogicalXor_(const Tensor& value) {
     kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::LogicalXor);
     return *this;
@@ -860,10 +1300,14 @@ Tensor Tensor::LogicalXor_(const Tensor& value) {
 Tensor Tensor::Gt(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
-    kernel::BinaryEW(*this, value, dst_tensor, kernel::BinaryEWOpCode::Gt);
+    Gt(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Gt(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Gt);
+}
+
 Tensor Tensor::Gt_(const Tensor& value) {
     kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::Gt);
     return *this;
@@ -872,10 +1316,14 @@ Tensor Tensor::Gt_(const Tensor& value) {
 Tensor Tensor::Lt(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
-    kernel::BinaryEW(*this, value, dst_tensor, kernel::BinaryEWOpCode::Lt);
+    Lt(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Lt(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Lt);
+}
+
 Tensor Tensor::Lt_(const Tensor& value) {
     kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::Lt);
     return *this;
@@ -884,10 +1332,14 @@ Tensor Tensor::Lt_(const Tensor& value) {
 Tensor Tensor::Ge(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
-    kernel::BinaryEW(*this, value, dst_tensor, kernel::BinaryEWOpCode::Ge);
+    Ge(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Ge(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Ge);
+}
+
 Tensor Tensor::Ge_(const Tensor& value) {
     kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::Ge);
     return *this;
@@ -896,10 +1348,14 @@ Tensor Tensor::Ge_(const Tensor& value) {
 Tensor Tensor::Le(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
-    kernel::BinaryEW(*this, value, dst_tensor, kernel::BinaryEWOpCode::Le);
+    Le(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Le(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Le);
+}
+
 Tensor Tensor::Le_(const Tensor& value) {
     kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::Le);
     return *this;
@@ -908,10 +1364,14 @@ Tensor Tensor::Le_(const Tensor& value) {
 Tensor Tensor::Eq(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
-    kernel::BinaryEW(*this, value, dst_tensor, kernel::BinaryEWOpCode::Eq);
+    Eq(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Eq(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Eq);
+}
+
 Tensor Tensor::Eq_(const Tensor& value) {
     kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::Eq);
     return *this;
@@ -920,10 +1380,14 @@ Tensor Tensor::Eq_(const Tensor& value) {
 Tensor Tensor::Ne(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
-    kernel::BinaryEW(*this, value, dst_tensor, kernel::BinaryEWOpCode::Ne);
+    Ne(value, dst_tensor);
     return dst_tensor;
 }
 
+void Tensor::Ne(const Tensor& value, Tensor& dst) const {
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Ne);
+}
+
 Tensor Tensor::Ne_(const Tensor& value) {
     kernel::BinaryEW(*this, value, *this, kernel::BinaryEWOpCode::Ne);
     return *this;
@@ -940,4 +1404,8 @@ std::vector<Tensor> Tensor::NonZeroNumpy() const {
 
 Tensor Tensor::NonZero() const { return kernel::NonZero(*this); }
 
+Tensor Tensor::MaskedSelect(const Tensor& mask) const {
+    return kernel::MaskedSelect(*this, mask);
+}
+
 }  // namespace open3d
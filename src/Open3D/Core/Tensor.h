@@ -29,6 +29,9 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "Open3D/Core/Blob.h"
 #include "Open3D/Core/DLPack/DLPackConverter.h"
@@ -259,6 +262,13 @@ public:
         return dlpack::FromDLPack(src);
     }
 
+    /// Loads a tensor from a NumPy .npy file, or from a .npz file holding a
+    /// single array. Uncompressed files are memory-mapped, see ReadNpy.
+    static Tensor Load(const std::string& file_name);
+
+    /// Saves the tensor to a NumPy .npy file, or to a .npz file as "arr_0".
+    void Save(const std::string& file_name) const;
+
     /// Assign (copy) values from another Tensor, shape, dtype, device may
     /// change. Slices of the original Tensor still keeps the original memory.
     /// After assignment, the Tensor will be contiguous.
@@ -362,6 +372,12 @@ public:
     void IndexSet(const std::vector<Tensor>& index_tensors,
                   const Tensor& src_tensor);
 
+    /// Scatter-add of rows along dimension 0, `tensor[index[i]] += src[i]`,
+    /// where src has shape (index.shape, shape[1:]). Unlike IndexSet with
+    /// Add, duplicate indices accumulate all their rows, in the order of i.
+    /// Only CPU tensors are supported. Returns the current tensor.
+    Tensor IndexAdd_(const Tensor& index, const Tensor& src);
+
     /// \brief Permute (dimension shuffle) the Tensor, returns a view.
     ///
     /// \param dims The desired ordering of dimensions.
@@ -409,6 +425,12 @@ public:
         return Add(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Adds a tensor and writes the result to \p dst, which must already have
+    /// the broadcasted shape, the same dtype and the same device. \p dst may
+    /// be the tensor itself or \p value, and no memory is allocated, so this
+    /// can be used in loops that reuse buffers, e.g. per-frame processing.
+    void Add(const Tensor& value, Tensor& dst) const;
+
     /// Inplace version of Tensor::Add. Adds a tensor to the current tensor and
     /// returns the current tensor.
     Tensor Add_(const Tensor& value);
@@ -434,6 +456,10 @@ public:
         return Sub(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Substracts a tensor and writes the result to preallocated \p dst, see
+    /// Tensor::Add(const Tensor&, Tensor&) const.
+    void Sub(const Tensor& value, Tensor& dst) const;
+
     /// Inplace version of Tensor::Sub. Substracts a tensor to the current
     /// tensor and returns the current tensor.
     Tensor Sub_(const Tensor& value);
@@ -459,6 +485,10 @@ public:
         return Mul(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Multiplies a tensor and writes the result to preallocated \p dst, see
+    /// Tensor::Add(const Tensor&, Tensor&) const.
+    void Mul(const Tensor& value, Tensor& dst) const;
+
     /// Inplace version of Tensor::Mul. Multiplies a tensor to the current
     /// tensor and returns the current tensor.
     Tensor Mul_(const Tensor& value);
@@ -484,6 +514,10 @@ public:
         return Div(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Divides a tensor and writes the result to preallocated \p dst, see
+    /// Tensor::Add(const Tensor&, Tensor&) const.
+    void Div(const Tensor& value, Tensor& dst) const;
+
     /// Inplace version of Tensor::Div. Divides a tensor to the current
     /// tensor and returns the current tensor.
     Tensor Div_(const Tensor& value);
@@ -497,6 +531,88 @@ public:
         return Div_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Element-wise maximum of tensors, returning a new tensor. \p value is
+    /// broadcasted to the tensor's shape.
+    Tensor Maximum(const Tensor& value) const;
+    template <typename T>
+    Tensor Maximum(T scalar_value) const {
+        return Maximum(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+    }
+
+    /// Element-wise maximum of tensors, writing to preallocated \p dst.
+    void Maximum(const Tensor& value, Tensor& dst) const;
+
+    /// Element-wise maximum of tensors, in-place.
+    Tensor Maximum_(const Tensor& value);
+
+    /// Element-wise minimum of tensors, returning a new tensor. \p value is
+    /// broadcasted to the tensor's shape.
+    Tensor Minimum(const Tensor& value) const;
+    template <typename T>
+    Tensor Minimum(T scalar_value) const {
+        return Minimum(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+    }
+
+    /// Element-wise minimum of tensors, writing to preallocated \p dst.
+    void Minimum(const Tensor& value, Tensor& dst) const;
+
+    /// Element-wise minimum of tensors, in-place.
+    Tensor Minimum_(const Tensor& value);
+
+    /// Element-wise power of the tensor to the exponents \p value, returning
+    /// a new tensor. The power is computed in double precision and casted
+    /// back to the tensor's dtype.
+    Tensor Pow(const Tensor& value) const;
+    template <typename T>
+    Tensor Pow(T scalar_value) const {
+        return Pow(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+    }
+
+    /// Element-wise power of tensors, writing to preallocated \p dst.
+    void Pow(const Tensor& value, Tensor& dst) const;
+
+    /// Element-wise power of tensors, in-place.
+    Tensor Pow_(const Tensor& value);
+    template <typename T>
+    Tensor Pow_(T scalar_value) {
+        return Pow_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+    }
+
+    /// Element-wise clamp of the tensor to [\p min_val, \p max_val],
+    /// returning a new tensor. The bounds are broadcasted to the tensor's
+    /// shape, and NaNs are propagated.
+    Tensor Clamp(const Tensor& min_val, const Tensor& max_val) const;
+    template <typename T>
+    Tensor Clamp(T min_val, T max_val) const {
+        return Clamp(Tensor::Full({}, min_val, dtype_, GetDevice()),
+                     Tensor::Full({}, max_val, dtype_, GetDevice()));
+    }
+
+    /// Element-wise clamp of the tensor, writing to preallocated \p dst.
+    void Clamp(const Tensor& min_val, const Tensor& max_val, Tensor& dst) const;
+
+    /// Element-wise clamp of the tensor, in-place.
+    Tensor Clamp_(const Tensor& min_val, const Tensor& max_val);
+    template <typename T>
+    Tensor Clamp_(T min_val, T max_val) {
+        return Clamp_(Tensor::Full({}, min_val, dtype_, GetDevice()),
+                      Tensor::Full({}, max_val, dtype_, GetDevice()));
+    }
+
+    /// Selects elements from \p x where the Bool \p condition is true and
+    /// from \p y elsewhere, like np.where(condition, x, y). All three are
+    /// broadcasted to a common shape, and \p x and \p y must have the same
+    /// dtype.
+    static Tensor Where(const Tensor& condition,
+                        const Tensor& x,
+                        const Tensor& y);
+
+    /// Same as Where(condition, x, y), but writes to preallocated \p dst.
+    static void Where(const Tensor& condition,
+                      const Tensor& x,
+                      const Tensor& y,
+                      Tensor& dst);
+
     /// Returns the sum of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
@@ -542,47 +658,172 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Returns the cumulative sum of the tensor along \p dim.
+    /// \param exclusive If true, the i-th element of the result is the sum of
+    /// the elements before i, starting from 0.
+    Tensor Cumsum(int64_t dim, bool exclusive = false) const;
+
+    /// Returns the cumulative product of the tensor along \p dim.
+    /// \param exclusive If true, the i-th element of the result is the
+    /// product of the elements before i, starting from 1.
+    Tensor Cumprod(int64_t dim, bool exclusive = false) const;
+
+    /// Returns the sums of consecutive segments of the tensor along dimension
+    /// 0, e.g. of the neighbors of each point in a flattened neighbor list.
+    /// \param prefix_sum Int64 (S,) exclusive prefix sum of the segment
+    /// lengths, starting with 0. Segment i covers rows
+    /// [prefix_sum[i], prefix_sum[i + 1]) and the last segment ends at the
+    /// last row. The result has shape (S, ...), and empty segments are 0.
+    Tensor SegmentSum(const Tensor& prefix_sum) const;
+
+    /// Returns the means of consecutive segments along dimension 0, see
+    /// SegmentSum. Only Float32 and Float64 are supported.
+    Tensor SegmentMean(const Tensor& prefix_sum) const;
+
+    /// Returns the minimums of consecutive segments along dimension 0, see
+    /// SegmentSum.
+    Tensor SegmentMin(const Tensor& prefix_sum) const;
+
+    /// Returns the maximums of consecutive segments along dimension 0, see
+    /// SegmentSum.
+    Tensor SegmentMax(const Tensor& prefix_sum) const;
+
+    /// Returns the Int64 row indices of the minimums of consecutive segments
+    /// along dimension 0, see SegmentSum. Empty segments are -1.
+    Tensor SegmentArgMin(const Tensor& prefix_sum) const;
+
+    /// Returns the Int64 row indices of the maximums of consecutive segments
+    /// along dimension 0, see SegmentSum. Empty segments are -1.
+    Tensor SegmentArgMax(const Tensor& prefix_sum) const;
+
+    /// Returns the tensor sorted along \p dim. The sort is stable and NaNs
+    /// are sorted after all other values, also in descending order.
+    Tensor Sort(int64_t dim = -1, bool descending = false) const;
+
+    /// Returns the Int64 indices along \p dim that sort the tensor, see Sort.
+    Tensor ArgSort(int64_t dim = -1, bool descending = false) const;
+
+    /// Returns the unique rows of the tensor along dimension 0 in ascending
+    /// lexicographic order, or the unique elements of a 1D tensor.
+    /// \return A tuple of the unique rows (U, ...), the Int64 inverse
+    /// indices (N,) and the Int64 counts (U,) of each unique row.
+    std::tuple<Tensor, Tensor, Tensor> Unique() const;
+
+    /// Returns the \p k largest (or smallest) elements along \p dim in
+    /// sorted order, and their Int64 indices along \p dim. Ties are resolved
+    /// to the smallest index. NaNs are ranked after all other values, so they
+    /// are only selected if there are fewer than \p k other values.
+    std::pair<Tensor, Tensor> TopK(int64_t k,
+                                   int64_t dim = -1,
+                                   bool largest = true) const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
+    /// Element-wise square root of a tensor, writing to preallocated \p dst.
+    void Sqrt(Tensor& dst) const;
+
     /// Element-wise square root of a tensor, in-place.
     Tensor Sqrt_();
 
     /// Element-wise sine of a tensor, returning a new tensor.
     Tensor Sin() const;
 
+    /// Element-wise sine of a tensor, writing to preallocated \p dst.
+    void Sin(Tensor& dst) const;
+
     /// Element-wise sine of a tensor, in-place.
     Tensor Sin_();
 
     /// Element-wise cosine of a tensor, returning a new tensor.
     Tensor Cos() const;
 
+    /// Element-wise cosine of a tensor, writing to preallocated \p dst.
+    void Cos(Tensor& dst) const;
+
     /// Element-wise cosine of a tensor, in-place.
     Tensor Cos_();
 
     /// Element-wise negation of a tensor, returning a new tensor.
     Tensor Neg() const;
 
+    /// Element-wise negation of a tensor, writing to preallocated \p dst.
+    void Neg(Tensor& dst) const;
+
     /// Element-wise negation of a tensor, in-place.
     Tensor Neg_();
 
     /// Element-wise exponential of a tensor, returning a new tensor.
     Tensor Exp() const;
 
+    /// Element-wise exponential of a tensor, writing to preallocated \p dst.
+    void Exp(Tensor& dst) const;
+
     /// Element-wise base-e exponential of a tensor, in-place.
     Tensor Exp_();
 
     /// Element-wise absolute value of a tensor, returning a new tensor.
     Tensor Abs() const;
 
+    /// Element-wise absolute value of a tensor, writing to preallocated \p dst.
+    void Abs(Tensor& dst) const;
+
     /// Element-wise absolute value of a tensor, in-place.
     Tensor Abs_();
+
+    /// Element-wise floor of a tensor, returning a new tensor.
+    Tensor Floor() const;
+
+    /// Element-wise floor of a tensor, writing to preallocated \p dst.
+    void Floor(Tensor& dst) const;
+
+    /// Element-wise floor of a tensor, in-place.
+    Tensor Floor_();
+
+    /// Element-wise natural logarithm of a tensor, returning a new tensor.
+    Tensor Log() const;
+
+    /// Element-wise natural logarithm of a tensor, writing to preallocated
+    /// \p dst.
+    void Log(Tensor& dst) const;
+
+    /// Element-wise natural logarithm of a tensor, in-place.
+    Tensor Log_();
+
+    /// Matrix product with \p rhs. The last two dimensions are multiplied as
+    /// matrices, (..., M, K) x (..., K, N) -> (..., M, N), and the leading
+    /// batch dimensions are broadcasted, e.g. (N, 3) x (3, 3) transforms N
+    /// points and (B, 4, 4) x (B, 4, 4) multiplies B poses.
+    Tensor Matmul(const Tensor& rhs) const;
+
+    /// Inverse of each square matrix of a (..., n, n) tensor. Singular
+    /// matrices result in non-finite values. Only Float32 and Float64 are
+    /// supported.
+    Tensor Inverse() const;
+
+    /// Solves A X = B for X, where A is this (..., n, n) tensor and B is
+    /// \p rhs of shape (..., n, k). Only Float32 and Float64 are supported.
+    Tensor Solve(const Tensor& rhs) const;
+
+    /// Eigendecomposition of each symmetric matrix of a (..., n, n) tensor.
+    /// Only the lower triangle is read. Only Float32 and Float64 are
+    /// supported.
+    ///
+    /// \return A pair of eigenvalues (..., n) in ascending order and
+    /// eigenvectors (..., n, n), where the i-th column is the eigenvector of
+    /// the i-th eigenvalue.
+    std::pair<Tensor, Tensor> SymmetricEigen() const;
+
     /// Element-wise logical not of a tensor, returning a new boolean tensor.
     ///
     /// If the tensor is not boolean, 0 will be treated as False, while non-zero
     /// will be treated as True.
     Tensor LogicalNot() const;
 
+    /// Element-wise logical not of a tensor, writing to preallocated \p dst.
+    /// \p dst is boolean or has the tensor's dtype.
+    void LogicalNot(Tensor& dst) const;
+
     /// Element-wise logical not of a tensor, in-place. This operation won't
     /// change the tensor's dtype.
     ///
@@ -598,6 +839,10 @@ public:
     Tensor LogicalAnd(const Tensor& value) const;
     Tensor operator&&(const Tensor& value) const { return LogicalAnd(value); }
 
+    /// Same as LogicalAnd(value), but writes to preallocated \p dst, which is
+    /// boolean or has the tensor's dtype.
+    void LogicalAnd(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise logical and of tensors, in-place. This operation won't
     /// change the tensor's dtype.
     ///
@@ -613,6 +858,10 @@ public:
     Tensor LogicalOr(const Tensor& value) const;
     Tensor operator||(const Tensor& value) const { return LogicalOr(value); }
 
+    /// Same as LogicalOr(value), but writes to preallocated \p dst, which is
+    /// boolean or has the tensor's dtype.
+    void LogicalOr(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise logical or of tensors, in-place. This operation won't
     /// change the tensor's dtype.
     ///
@@ -628,6 +877,10 @@ public:
     /// non-zero values will be treated as True.
     Tensor LogicalXor(const Tensor& value) const;
 
+    /// Same as LogicalXor(value), but writes to preallocated \p dst, which is
+    /// boolean or has the tensor's dtype.
+    void LogicalXor(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise logical exclusive-or of tensors, in-place. This operation
     /// won't change the tensor's dtype.
     ///
@@ -640,6 +893,10 @@ public:
     Tensor Gt(const Tensor& value) const;
     Tensor operator>(const Tensor& value) const { return Gt(value); }
 
+    /// Same as Gt(value), but writes to preallocated \p dst, which is boolean
+    /// or has the tensor's dtype.
+    void Gt(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise greater-than of tensors, in-place. This operation
     /// won't change the tensor's dtype.
     Tensor Gt_(const Tensor& value);
@@ -648,6 +905,10 @@ public:
     Tensor Lt(const Tensor& value) const;
     Tensor operator<(const Tensor& value) const { return Lt(value); }
 
+    /// Same as Lt(value), but writes to preallocated \p dst, which is boolean
+    /// or has the tensor's dtype.
+    void Lt(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise less-than of tensors, in-place. This operation won't change
     /// the tensor's dtype.
     Tensor Lt_(const Tensor& value);
@@ -657,6 +918,10 @@ public:
     Tensor Ge(const Tensor& value) const;
     Tensor operator>=(const Tensor& value) const { return Ge(value); }
 
+    /// Same as Ge(value), but writes to preallocated \p dst, which is boolean
+    /// or has the tensor's dtype.
+    void Ge(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise greater-than-or-equals-to of tensors, in-place. This
     /// operation won't change the tensor's dtype.
     Tensor Ge_(const Tensor& value);
@@ -666,6 +931,10 @@ public:
     Tensor Le(const Tensor& value) const;
     Tensor operator<=(const Tensor& value) const { return Le(value); }
 
+    /// Same as Le(value), but writes to preallocated \p dst, which is boolean
+    /// or has the tensor's dtype.
+    void Le(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise less-than-or-equals-to of tensors, in-place. This operation
     /// won't change the tensor's dtype.
     Tensor Le_(const Tensor& value);
@@ -674,6 +943,10 @@ public:
     Tensor Eq(const Tensor& value) const;
     Tensor operator==(const Tensor& value) const { return Eq(value); }
 
+    /// Same as Eq(value), but writes to preallocated \p dst, which is boolean
+    /// or has the tensor's dtype.
+    void Eq(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise equals-to of tensors, in-place. This
     /// operation won't change the tensor's dtype.
     Tensor Eq_(const Tensor& value);
@@ -682,6 +955,10 @@ public:
     Tensor Ne(const Tensor& value) const;
     Tensor operator!=(const Tensor& value) const { return Ne(value); }
 
+    /// Same as Ne(value), but writes to preallocated \p dst, which is boolean
+    /// or has the tensor's dtype.
+    void Ne(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise equals-to of tensors, in-place. This
     /// operation won't change the tensor's dtype.
     Tensor Ne_(const Tensor& value);
@@ -697,6 +974,12 @@ public:
     /// tensor.
     Tensor NonZero() const;
 
+    /// Returns the rows selected by a Bool \p mask whose shape equals the
+    /// leading dimensions of the tensor, like `tensor[mask]` in NumPy. The
+    /// result has shape (num_selected, shape[mask.NumDims():]) and is
+    /// compacted directly, without computing index tensors.
+    Tensor MaskedSelect(const Tensor& mask) const;
+
     /// Retrive all values as an std::vector, for debugging and testing
     template <typename T>
     std::vector<T> ToFlatVector() const {
@@ -0,0 +1,580 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/TensorExpr.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/Kernel/FusedEW.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+/// A node of the expression graph. The shape, dtype and device of the result
+/// are inferred when the node is recorded.
+struct TensorExpr::Node {
+    enum class Type { Leaf, Unary, Binary, Reduction };
+
+    Type type_ = Type::Leaf;
+    SizeVector shape_;
+    Dtype dtype_ = Dtype::Undefined;
+    Device device_;
+
+    /// The wrapped tensor for leaves, or the cached result once evaluated.
+    Tensor tensor_;
+    bool evaluated_ = false;
+
+    kernel::UnaryEWOpCode unary_op_code_ = kernel::UnaryEWOpCode::Neg;
+    kernel::BinaryEWOpCode binary_op_code_ = kernel::BinaryEWOpCode::Add;
+    kernel::ReductionOpCode reduction_op_code_ = kernel::ReductionOpCode::Sum;
+    SizeVector dims_;
+    bool keepdim_ = false;
+
+    /// Operand of unary and reduction nodes, or lhs of binary nodes.
+    std::shared_ptr<Node> lhs_;
+    /// Rhs of binary nodes.
+    std::shared_ptr<Node> rhs_;
+
+    /// Releases the operands iteratively, such that destroying a long chain
+    /// of nodes does not overflow the call stack.
+    ~Node() {
+        std::vector<std::shared_ptr<Node>> stack;
+        auto release = [&stack](std::shared_ptr<Node>& operand) {
+            if (operand && operand.use_count() == 1) {
+                stack.push_back(std::move(operand));
+            }
+            operand = nullptr;
+        };
+        release(lhs_);
+        release(rhs_);
+        while (!stack.empty()) {
+            std::shared_ptr<Node> node = std::move(stack.back());
+            stack.pop_back();
+            release(node->lhs_);
+            release(node->rhs_);
+        }
+    }
+};
+
+typedef std::shared_ptr<TensorExpr::Node> NodePtr;
+
+static bool IsFloatDtype(Dtype dtype) {
+    return dtype == Dtype::Float32 || dtype == Dtype::Float64;
+}
+
+/// Returns true if \p node's result is an input of a fused program rather
+/// than a part of it.
+static bool IsFusedInput(const TensorExpr::Node* node) {
+    return node->evaluated_ || node->type_ == TensorExpr::Node::Type::Leaf ||
+           node->type_ == TensorExpr::Node::Type::Reduction;
+}
+
+/// Returns true if the fused kernels can evaluate \p root. Otherwise the eager
+/// ops are used, which also raise the appropriate errors.
+static bool CanFuse(const NodePtr& root) {
+    // The graph is a DAG, visit shared nodes once.
+    std::unordered_set<TensorExpr::Node*> visited{root.get()};
+    std::vector<TensorExpr::Node*> stack{root.get()};
+    auto push = [&](TensorExpr::Node* node) {
+        if (visited.insert(node).second) {
+            stack.push_back(node);
+        }
+    };
+    while (!stack.empty()) {
+        TensorExpr::Node* node = stack.back();
+        stack.pop_back();
+        if (node->device_.GetType() != Device::DeviceType::CPU) {
+            return false;
+        }
+        switch (node->dtype_) {
+            case Dtype::Float32:
+            case Dtype::Float64:
+            case Dtype::Int32:
+            case Dtype::Int64:
+            case Dtype::UInt8:
+                break;
+            default:
+                return false;
+        }
+        if (IsFusedInput(node)) {
+            continue;
+        }
+        if (node->type_ == TensorExpr::Node::Type::Unary) {
+            if (node->unary_op_code_ != kernel::UnaryEWOpCode::Neg &&
+                node->unary_op_code_ != kernel::UnaryEWOpCode::Abs &&
+                node->unary_op_code_ != kernel::UnaryEWOpCode::Floor &&
+                !IsFloatDtype(node->dtype_)) {
+                return false;
+            }
+            push(node->lhs_.get());
+        } else {
+            push(node->lhs_.get());
+            push(node->rhs_.get());
+        }
+    }
+    return true;
+}
+
+/// Returns the unevaluated reductions that are inputs of the fused program of
+/// \p root. They must be evaluated before the program is compiled.
+static std::vector<NodePtr> GetPendingFusedInputs(const NodePtr& root) {
+    std::vector<NodePtr> pending;
+    std::unordered_set<TensorExpr::Node*> visited{root.get()};
+    std::vector<NodePtr> stack{root};
+    auto push = [&](const NodePtr& node) {
+        if (visited.insert(node.get()).second) {
+            stack.push_back(node);
+        }
+    };
+    while (!stack.empty()) {
+        NodePtr node = stack.back();
+        stack.pop_back();
+        if (IsFusedInput(node.get())) {
+            if (!node->evaluated_ &&
+                node->type_ != TensorExpr::Node::Type::Leaf) {
+                pending.push_back(node);
+            }
+            continue;
+        }
+        push(node->lhs_);
+        if (node->type_ == TensorExpr::Node::Type::Binary) {
+            push(node->rhs_);
+        }
+    }
+    return pending;
+}
+
+/// Returns true if \p lhs and \p rhs view the same memory in the same way.
+static bool IsSameView(const Tensor& lhs, const Tensor& rhs) {
+    return lhs.GetDataPtr() == rhs.GetDataPtr() &&
+           lhs.GetDtype() == rhs.GetDtype() &&
+           lhs.GetShapeRef() == rhs.GetShapeRef() &&
+           lhs.GetStridesRef() == rhs.GetStridesRef();
+}
+
+/// Compiles \p root to a postfix program and collects its inputs. Inputs are
+/// deduplicated and must have been evaluated. Operations used more than once
+/// are computed once and kept in a register. Returns false if the number of
+/// inputs exceeds what the Indexer supports.
+static bool CompileNode(const NodePtr& root,
+                        std::vector<Tensor>& inputs,
+                        kernel::FusedEWProgram& program) {
+    // Count the uses of each operation within the program, visiting the
+    // operands of shared operations once.
+    std::unordered_map<TensorExpr::Node*, int64_t> num_uses;
+    std::vector<TensorExpr::Node*> count_stack{root.get()};
+    while (!count_stack.empty()) {
+        TensorExpr::Node* node = count_stack.back();
+        count_stack.pop_back();
+        if (IsFusedInput(node) || num_uses[node]++ > 0) {
+            continue;
+        }
+        count_stack.push_back(node->lhs_.get());
+        if (node->type_ == TensorExpr::Node::Type::Binary) {
+            count_stack.push_back(node->rhs_.get());
+        }
+    }
+
+    // Post-order traversal. A node is emitted once its operands are.
+    std::unordered_map<TensorExpr::Node*, int64_t> registers;
+    std::vector<std::pair<TensorExpr::Node*, bool>> stack{{root.get(), false}};
+    while (!stack.empty()) {
+        TensorExpr::Node* node = stack.back().first;
+        bool operands_emitted = stack.back().second;
+        stack.pop_back();
+        if (IsFusedInput(node)) {
+            const Tensor& tensor = node->tensor_;
+            int64_t input_idx = 0;
+            while (input_idx < static_cast<int64_t>(inputs.size()) &&
+                   !IsSameView(inputs[input_idx], tensor)) {
+                input_idx++;
+            }
+            if (input_idx == static_cast<int64_t>(inputs.size())) {
+                if (input_idx == MAX_INPUTS) {
+                    return false;
+                }
+                inputs.push_back(tensor);
+            }
+            program.push_back(kernel::FusedEWInstruction::Input(input_idx));
+        } else if (operands_emitted) {
+            if (node->type_ == TensorExpr::Node::Type::Unary) {
+                program.push_back(kernel::FusedEWInstruction::Unary(
+                        node->unary_op_code_));
+            } else {
+                program.push_back(kernel::FusedEWInstruction::Binary(
+                        node->binary_op_code_));
+            }
+            if (num_uses[node] > 1) {
+                int64_t register_idx = static_cast<int64_t>(registers.size());
+                registers[node] = register_idx;
+                program.push_back(
+                        kernel::FusedEWInstruction::Store(register_idx));
+            }
+        } else if (registers.count(node)) {
+            // A shared operation is computed once, later uses load it.
+            program.push_back(
+                    kernel::FusedEWInstruction::Load(registers.at(node)));
+        } else {
+            stack.emplace_back(node, true);
+            if (node->type_ == TensorExpr::Node::Type::Binary) {
+                stack.emplace_back(node->rhs_.get(), false);
+            }
+            stack.emplace_back(node->lhs_.get(), false);
+        }
+    }
+    return true;
+}
+
+/// Evaluates \p node with one eager Tensor op. Its operands must have been
+/// evaluated.
+static Tensor EvaluateNodeEager(const NodePtr& node) {
+    switch (node->type_) {
+        case TensorExpr::Node::Type::Unary: {
+            const Tensor& src = node->lhs_->tensor_;
+            switch (node->unary_op_code_) {
+                case kernel::UnaryEWOpCode::Sqrt:
+                    return src.Sqrt();
+                case kernel::UnaryEWOpCode::Sin:
+                    return src.Sin();
+                case kernel::UnaryEWOpCode::Cos:
+                    return src.Cos();
+                case kernel::UnaryEWOpCode::Neg:
+                    return src.Neg();
+                case kernel::UnaryEWOpCode::Exp:
+                    return src.Exp();
+                case kernel::UnaryEWOpCode::Abs:
+                    return src.Abs();
+                case kernel::UnaryEWOpCode::Floor:
+                    return src.Floor();
+                case kernel::UnaryEWOpCode::Log:
+                    return src.Log();
+                default:
+                    break;
+            }
+            break;
+        }
+        case TensorExpr::Node::Type::Binary: {
+            const Tensor& lhs = node->lhs_->tensor_;
+            const Tensor& rhs = node->rhs_->tensor_;
+            switch (node->binary_op_code_) {
+                case kernel::BinaryEWOpCode::Add:
+                    return lhs.Add(rhs);
+                case kernel::BinaryEWOpCode::Sub:
+                    return lhs.Sub(rhs);
+                case kernel::BinaryEWOpCode::Mul:
+                    return lhs.Mul(rhs);
+                case kernel::BinaryEWOpCode::Div:
+                    return lhs.Div(rhs);
+                case kernel::BinaryEWOpCode::Maximum:
+                    return lhs.Maximum(rhs);
+                case kernel::BinaryEWOpCode::Minimum:
+                    return lhs.Minimum(rhs);
+                case kernel::BinaryEWOpCode::Pow:
+                    return lhs.Pow(rhs);
+                default:
+                    break;
+            }
+            break;
+        }
+        case TensorExpr::Node::Type::Reduction: {
+            const Tensor& src = node->lhs_->tensor_;
+            switch (node->reduction_op_code_) {
+                case kernel::ReductionOpCode::Sum:
+                    return src.Sum(node->dims_, node->keepdim_);
+                case kernel::ReductionOpCode::Prod:
+                    return src.Prod(node->dims_, node->keepdim_);
+                case kernel::ReductionOpCode::Min:
+                    return src.Min(node->dims_, node->keepdim_);
+                case kernel::ReductionOpCode::Max:
+                    return src.Max(node->dims_, node->keepdim_);
+                default:
+                    break;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    utility::LogError("Internal error: unsupported expression node.");
+    return Tensor();
+}
+
+/// Returns the root of the fused program that evaluates \p node, or nullptr
+/// if \p node cannot be fused. A reduction of a tensor is already a single
+/// pass, so it is only fused with an element-wise operand.
+static NodePtr GetFusedRoot(const NodePtr& node) {
+    if (node->type_ == TensorExpr::Node::Type::Reduction) {
+        if (IsFusedInput(node->lhs_.get()) || !CanFuse(node->lhs_)) {
+            return nullptr;
+        }
+        return node->lhs_;
+    }
+    return CanFuse(node) ? node : nullptr;
+}
+
+/// Evaluates \p node with the fused kernels. Its fused inputs must have been
+/// evaluated. Returns false if the program has too many inputs, in which case
+/// \p dst is untouched.
+static bool EvaluateNodeFused(const NodePtr& node, Tensor& dst) {
+    bool is_reduction = node->type_ == TensorExpr::Node::Type::Reduction;
+    std::vector<Tensor> inputs;
+    kernel::FusedEWProgram program;
+    if (!CompileNode(is_reduction ? node->lhs_ : node, inputs, program)) {
+        return false;
+    }
+    dst = Tensor(node->shape_, node->dtype_, node->device_);
+    if (is_reduction) {
+        kernel::FusedEWReduction(inputs, program, dst, node->dims_,
+                                 node->keepdim_, node->reduction_op_code_);
+    } else {
+        kernel::FusedEW(inputs, program, dst);
+    }
+    return true;
+}
+
+/// Evaluates \p root, fusing as much as possible. Nodes are processed with an
+/// explicit work stack, such that long expression chains do not overflow the
+/// call stack.
+static Tensor EvaluateNode(const NodePtr& root) {
+    // A node is expanded first, which pushes the nodes it depends on. It is
+    // evaluated when it is popped again, after its dependencies.
+    enum class Step { Expand, Fused, Eager };
+    std::vector<std::pair<NodePtr, Step>> stack{{root, Step::Expand}};
+    auto push_eager = [&stack](const NodePtr& node) {
+        stack.emplace_back(node, Step::Eager);
+        stack.emplace_back(node->lhs_, Step::Expand);
+        if (node->type_ == TensorExpr::Node::Type::Binary) {
+            stack.emplace_back(node->rhs_, Step::Expand);
+        }
+    };
+
+    while (!stack.empty()) {
+        NodePtr node = stack.back().first;
+        Step step = stack.back().second;
+        stack.pop_back();
+        if (node->evaluated_ || node->type_ == TensorExpr::Node::Type::Leaf) {
+            continue;
+        }
+
+        if (step == Step::Expand) {
+            NodePtr fused_root = GetFusedRoot(node);
+            if (fused_root) {
+                stack.emplace_back(node, Step::Fused);
+                for (const NodePtr& input : GetPendingFusedInputs(fused_root)) {
+                    stack.emplace_back(input, Step::Expand);
+                }
+            } else {
+                push_eager(node);
+            }
+            continue;
+        }
+
+        Tensor result;
+        if (step == Step::Fused) {
+            if (!EvaluateNodeFused(node, result)) {
+                // Too many inputs, evaluate the operands separately.
+                push_eager(node);
+                continue;
+            }
+        } else {
+            result = EvaluateNodeEager(node);
+        }
+        node->tensor_ = result;
+        node->evaluated_ = true;
+
+        // Operands are no longer needed, release them and their cached
+        // results.
+        node->lhs_ = nullptr;
+        node->rhs_ = nullptr;
+    }
+    return root->tensor_;
+}
+
+static NodePtr MakeUnaryNode(const NodePtr& src,
+                             kernel::UnaryEWOpCode op_code) {
+    NodePtr node = std::make_shared<TensorExpr::Node>();
+    node->type_ = TensorExpr::Node::Type::Unary;
+    node->shape_ = src->shape_;
+    node->dtype_ = src->dtype_;
+    node->device_ = src->device_;
+    node->unary_op_code_ = op_code;
+    node->lhs_ = src;
+    return node;
+}
+
+static NodePtr MakeBinaryNode(const NodePtr& lhs,
+                              const NodePtr& rhs,
+                              kernel::BinaryEWOpCode op_code) {
+    if (lhs->device_ != rhs->device_) {
+        utility::LogError("Device mismatch {} != {}.",
+                          lhs->device_.ToString(), rhs->device_.ToString());
+    }
+    if (lhs->dtype_ != rhs->dtype_) {
+        utility::LogError("Dype mismatch {} != {}.",
+                          DtypeUtil::ToString(lhs->dtype_),
+                          DtypeUtil::ToString(rhs->dtype_));
+    }
+    NodePtr node = std::make_shared<TensorExpr::Node>();
+    node->type_ = TensorExpr::Node::Type::Binary;
+    node->shape_ = shape_util::BroadcastedShape(lhs->shape_, rhs->shape_);
+    node->dtype_ = lhs->dtype_;
+    node->device_ = lhs->device_;
+    node->binary_op_code_ = op_code;
+    node->lhs_ = lhs;
+    node->rhs_ = rhs;
+    return node;
+}
+
+static NodePtr MakeReductionNode(const NodePtr& src,
+                                 const SizeVector& dims,
+                                 bool keepdim,
+                                 kernel::ReductionOpCode op_code) {
+    NodePtr node = std::make_shared<TensorExpr::Node>();
+    node->type_ = TensorExpr::Node::Type::Reduction;
+    node->shape_ = shape_util::ReductionShape(src->shape_, dims, keepdim);
+    node->dtype_ = src->dtype_;
+    node->device_ = src->device_;
+    node->reduction_op_code_ = op_code;
+    node->dims_ = dims;
+    node->keepdim_ = keepdim;
+    node->lhs_ = src;
+    return node;
+}
+
+TensorExpr::TensorExpr(const Tensor& tensor)
+    : node_(std::make_shared<Node>()) {
+    node_->type_ = Node::Type::Leaf;
+    node_->shape_ = tensor.GetShape();
+    node_->dtype_ = tensor.GetDtype();
+    node_->device_ = tensor.GetDevice();
+    node_->tensor_ = tensor;
+}
+
+Tensor TensorExpr::Eval() const { return EvaluateNode(node_); }
+
+bool TensorExpr::IsEvaluated() const {
+    return node_->evaluated_ || node_->type_ == Node::Type::Leaf;
+}
+
+SizeVector TensorExpr::GetShape() const { return node_->shape_; }
+
+Dtype TensorExpr::GetDtype() const { return node_->dtype_; }
+
+Device TensorExpr::GetDevice() const { return node_->device_; }
+
+TensorExpr TensorExpr::Add(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(node_, value.node_, kernel::BinaryEWOpCode::Add));
+}
+
+TensorExpr TensorExpr::Sub(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(node_, value.node_, kernel::BinaryEWOpCode::Sub));
+}
+
+TensorExpr TensorExpr::Mul(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(node_, value.node_, kernel::BinaryEWOpCode::Mul));
+}
+
+TensorExpr TensorExpr::Div(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(node_, value.node_, kernel::BinaryEWOpCode::Div));
+}
+
+TensorExpr TensorExpr::Maximum(const TensorExpr& value) const {
+    return TensorExpr(MakeBinaryNode(node_, value.node_,
+                                     kernel::BinaryEWOpCode::Maximum));
+}
+
+TensorExpr TensorExpr::Minimum(const TensorExpr& value) const {
+    return TensorExpr(MakeBinaryNode(node_, value.node_,
+                                     kernel::BinaryEWOpCode::Minimum));
+}
+
+TensorExpr TensorExpr::Pow(const TensorExpr& value) const {
+    return TensorExpr(MakeBinaryNode(node_, value.node_,
+                                     kernel::BinaryEWOpCode::Pow));
+}
+
+TensorExpr TensorExpr::Sqrt() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Sqrt));
+}
+
+TensorExpr TensorExpr::Sin() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Sin));
+}
+
+TensorExpr TensorExpr::Cos() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Cos));
+}
+
+TensorExpr TensorExpr::Neg() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Neg));
+}
+
+TensorExpr TensorExpr::Exp() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Exp));
+}
+
+TensorExpr TensorExpr::Abs() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Abs));
+}
+
+TensorExpr TensorExpr::Floor() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Floor));
+}
+
+TensorExpr TensorExpr::Log() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Log));
+}
+
+TensorExpr TensorExpr::Sum(const SizeVector& dims, bool keepdim) const {
+    return TensorExpr(MakeReductionNode(node_, dims, keepdim,
+                                        kernel::ReductionOpCode::Sum));
+}
+
+TensorExpr TensorExpr::Prod(const SizeVector& dims, bool keepdim) const {
+    return TensorExpr(MakeReductionNode(node_, dims, keepdim,
+                                        kernel::ReductionOpCode::Prod));
+}
+
+TensorExpr TensorExpr::Min(const SizeVector& dims, bool keepdim) const {
+    return TensorExpr(MakeReductionNode(node_, dims, keepdim,
+                                        kernel::ReductionOpCode::Min));
+}
+
+TensorExpr TensorExpr::Max(const SizeVector& dims, bool keepdim) const {
+    return TensorExpr(MakeReductionNode(node_, dims, keepdim,
+                                        kernel::ReductionOpCode::Max));
+}
+
+}  // namespace open3d
@@ -0,0 +1,239 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+
+/// TensorExpr is an opt-in lazy counterpart of the element-wise Tensor ops.
+///
+/// Ops on a TensorExpr only record an expression graph, nothing is computed
+/// until Eval() is called. At evaluation, chains of element-wise ops and an
+/// optional trailing reduction are fused into a single pass over the inputs.
+/// E.g. the following reads a and b once and allocates no temporaries for
+/// the squared differences, and computes diff once per element:
+///
+/// \code
+/// TensorExpr diff = TensorExpr(a) - b;
+/// Tensor dist = (diff * diff).Sum({1}).Sqrt().Eval();
+/// \endcode
+///
+/// The result is computed on the first Eval() and cached. Expressions that
+/// cannot be fused (e.g. non-CPU devices, or too many distinct input tensors)
+/// are evaluated op by op with the eager Tensor ops, with the same results.
+///
+/// TensorExpr is not thread-safe. Evaluation caches results in the nodes of
+/// the graph, which are shared by all expressions built from them, so
+/// expressions that share nodes must not be evaluated concurrently.
+class TensorExpr {
+public:
+    /// Wraps \p tensor as a leaf of the expression graph. No data is copied.
+    TensorExpr(const Tensor& tensor);
+
+    /// Evaluates the expression, or returns the cached result. Not
+    /// thread-safe, see the class documentation.
+    Tensor Eval() const;
+
+    /// Returns true if the expression has been evaluated and cached.
+    bool IsEvaluated() const;
+
+    /// Shape of the result, known without evaluation.
+    SizeVector GetShape() const;
+
+    /// Dtype of the result, known without evaluation.
+    Dtype GetDtype() const;
+
+    /// Device of the result, known without evaluation.
+    Device GetDevice() const;
+
+    TensorExpr Add(const TensorExpr& value) const;
+    TensorExpr Sub(const TensorExpr& value) const;
+    TensorExpr Mul(const TensorExpr& value) const;
+    TensorExpr Div(const TensorExpr& value) const;
+    TensorExpr Maximum(const TensorExpr& value) const;
+    TensorExpr Minimum(const TensorExpr& value) const;
+    TensorExpr Pow(const TensorExpr& value) const;
+
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Add(T scalar_value) const {
+        return Add(FullLike(scalar_value));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Sub(T scalar_value) const {
+        return Sub(FullLike(scalar_value));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Mul(T scalar_value) const {
+        return Mul(FullLike(scalar_value));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Div(T scalar_value) const {
+        return Div(FullLike(scalar_value));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Maximum(T scalar_value) const {
+        return Maximum(FullLike(scalar_value));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Minimum(T scalar_value) const {
+        return Minimum(FullLike(scalar_value));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Pow(T scalar_value) const {
+        return Pow(FullLike(scalar_value));
+    }
+
+    TensorExpr operator+(const TensorExpr& value) const { return Add(value); }
+    TensorExpr operator-(const TensorExpr& value) const { return Sub(value); }
+    TensorExpr operator*(const TensorExpr& value) const { return Mul(value); }
+    TensorExpr operator/(const TensorExpr& value) const { return Div(value); }
+
+    // Exact-match overloads for Tensor operands, such that the scalar operator
+    // templates of Tensor are not selected.
+    TensorExpr operator+(const Tensor& value) const { return Add(value); }
+    TensorExpr operator-(const Tensor& value) const { return Sub(value); }
+    TensorExpr operator*(const Tensor& value) const { return Mul(value); }
+    TensorExpr operator/(const Tensor& value) const { return Div(value); }
+
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator+(T scalar_value) const {
+        return Add(scalar_value);
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator-(T scalar_value) const {
+        return Sub(scalar_value);
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator*(T scalar_value) const {
+        return Mul(scalar_value);
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator/(T scalar_value) const {
+        return Div(scalar_value);
+    }
+
+    TensorExpr Sqrt() const;
+    TensorExpr Sin() const;
+    TensorExpr Cos() const;
+    TensorExpr Neg() const;
+    TensorExpr Exp() const;
+    TensorExpr Abs() const;
+    TensorExpr Floor() const;
+    TensorExpr Log() const;
+    TensorExpr operator-() const { return Neg(); }
+
+    /// Records a reduction along \p dims. If the operand is an unevaluated
+    /// element-wise expression, the reduction is fused into its pass.
+    TensorExpr Sum(const SizeVector& dims, bool keepdim = false) const;
+    TensorExpr Prod(const SizeVector& dims, bool keepdim = false) const;
+    TensorExpr Min(const SizeVector& dims, bool keepdim = false) const;
+    TensorExpr Max(const SizeVector& dims, bool keepdim = false) const;
+
+    struct Node;
+
+protected:
+    explicit TensorExpr(const std::shared_ptr<Node>& node) : node_(node) {}
+
+    template <typename T>
+    TensorExpr FullLike(T scalar_value) const {
+        return TensorExpr(
+                Tensor::Full({}, scalar_value, GetDtype(), GetDevice()));
+    }
+
+    std::shared_ptr<Node> node_;
+};
+
+inline TensorExpr operator+(const Tensor& lhs, const TensorExpr& rhs) {
+    return TensorExpr(lhs).Add(rhs);
+}
+
+inline TensorExpr operator-(const Tensor& lhs, const TensorExpr& rhs) {
+    return TensorExpr(lhs).Sub(rhs);
+}
+
+inline TensorExpr operator*(const Tensor& lhs, const TensorExpr& rhs) {
+    return TensorExpr(lhs).Mul(rhs);
+}
+
+inline TensorExpr operator/(const Tensor& lhs, const TensorExpr& rhs) {
+    return TensorExpr(lhs).Div(rhs);
+}
+
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+inline TensorExpr operator+(T scalar_lhs, const TensorExpr& rhs) {
+    return rhs + scalar_lhs;
+}
+
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+inline TensorExpr operator-(T scalar_lhs, const TensorExpr& rhs) {
+    return Tensor::Full({}, scalar_lhs, rhs.GetDtype(), rhs.GetDevice()) - rhs;
+}
+
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+inline TensorExpr operator*(T scalar_lhs, const TensorExpr& rhs) {
+    return rhs * scalar_lhs;
+}
+
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+inline TensorExpr operator/(T scalar_lhs, const TensorExpr& rhs) {
+    return Tensor::Full({}, scalar_lhs, rhs.GetDtype(), rhs.GetDevice()) / rhs;
+}
+
+}  // namespace open3d
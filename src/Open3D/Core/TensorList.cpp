@@ -25,6 +25,10 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Core/TensorList.h"
+
+#include <algorithm>
+#include <cmath>
+
 #include "Open3D/Core/SizeVector.h"
 
 namespace open3d {
@@ -82,6 +86,22 @@ TensorList TensorList::FromTensor(const Tensor& tensor, bool inplace) {
     return TensorList(tensor, inplace);
 }
 
+TensorList TensorList::Chunked(const SizeVector& shape,
+                               Dtype dtype,
+                               int64_t chunk_size,
+                               const Device& device /* = Device("CPU:0") */) {
+    if (chunk_size <= 0) {
+        utility::LogError("Chunk size must be positive, but got {}.",
+                          chunk_size);
+    }
+    TensorList tensor_list(shape, dtype, device);
+    tensor_list.chunk_size_ = chunk_size;
+    tensor_list.reserved_size_ = 0;
+    tensor_list.internal_tensor_ =
+            Tensor(ExpandFrontDim(shape, 0), dtype, device);
+    return tensor_list;
+}
+
 TensorList::TensorList(const TensorList& other) { CopyFrom(other); }
 
 void TensorList::CopyFrom(const TensorList& other) {
@@ -91,6 +111,12 @@ void TensorList::CopyFrom(const TensorList& other) {
     size_ = other.GetSize();
     reserved_size_ = other.GetReservedSize();
     internal_tensor_.Assign(other.GetInternalTensor());
+    chunk_size_ = other.GetChunkSize();
+    growth_factor_ = other.GetGrowthFactor();
+    chunks_.clear();
+    for (const Tensor& chunk : other.GetChunks()) {
+        chunks_.push_back(chunk.Copy(device_));
+    }
 }
 
 TensorList& TensorList::operator=(const TensorList& other) & {
@@ -105,22 +131,54 @@ void TensorList::ShallowCopyFrom(const TensorList& other) {
     size_ = other.GetSize();
     reserved_size_ = other.GetReservedSize();
     internal_tensor_.ShallowCopyFrom(other.GetInternalTensor());
+    chunk_size_ = other.GetChunkSize();
+    growth_factor_ = other.GetGrowthFactor();
+    chunks_ = other.GetChunks();
 }
 
 Tensor TensorList::AsTensor() const {
-    return internal_tensor_.Slice(0 /* dim */, 0, size_);
+    if (!IsChunked()) {
+        return internal_tensor_.Slice(0 /* dim */, 0, size_);
+    }
+    if (chunks_.size() == 1) {
+        return chunks_[0].Slice(0 /* dim */, 0, size_);
+    }
+
+    // Lazily concatenate the blocks.
+    Tensor tensor(ExpandFrontDim(shape_, size_), dtype_, device_);
+    int64_t offset = 0;
+    for (const Tensor& segment : GetSegments()) {
+        int64_t num_elements = segment.GetShape(0);
+        tensor.Slice(0 /* dim */, offset, offset + num_elements) = segment;
+        offset += num_elements;
+    }
+    return tensor;
 }
 
 void TensorList::Resize(int64_t n) {
-    // Increase internal tensor size
-    int64_t new_reserved_size = ReserveSize(n);
-    if (new_reserved_size > reserved_size_) {
-        ExpandTensor(new_reserved_size);
+    if (n < 0) {
+        utility::LogError("Negative tensor list size {} is unsupported.", n);
     }
+    ReserveCapacity(n);
 
     if (n > size_) {
-        // Now new_reserved_size <= reserved_size, safe to fill in data
-        internal_tensor_.Slice(0 /* dim */, size_, n).Fill(0);
+        // The capacity is reserved, safe to fill in data
+        if (IsChunked()) {
+            for (int64_t i = size_; i < n;) {
+                int64_t offset = i % chunk_size_;
+                int64_t num_elements = std::min(n - i, chunk_size_ - offset);
+                chunks_[i / chunk_size_]
+                        .Slice(0 /* dim */, offset, offset + num_elements)
+                        .Fill(0);
+                i += num_elements;
+            }
+        } else {
+            internal_tensor_.Slice(0 /* dim */, size_, n).Fill(0);
+        }
+    } else if (IsChunked()) {
+        // Release the blocks that are no longer used.
+        chunks_.resize((n + chunk_size_ - 1) / chunk_size_);
+        reserved_size_ = chunks_.size() * chunk_size_;
     }
     size_ = n;
 }
@@ -131,13 +189,14 @@ void TensorList::PushBack(const Tensor& tensor) {
                           tensor.GetShape());
     }
 
-    int64_t new_reserved_size = ReserveSize(size_ + 1);
-    if (new_reserved_size > reserved_size_) {
-        ExpandTensor(new_reserved_size);
-    }
+    ReserveCapacity(size_ + 1);
 
     // Copy tensor
-    internal_tensor_[size_] = tensor;
+    if (IsChunked()) {
+        chunks_[size_ / chunk_size_][size_ % chunk_size_] = tensor;
+    } else {
+        internal_tensor_[size_] = tensor;
+    }
     ++size_;
 }
 
@@ -172,27 +231,48 @@ void TensorList::Extend(const TensorList& other) {  // Check consistency
     // Shallow copy by default
     TensorList extension = other;
 
-    // Make a deep copy to avoid corrupting duplicate data
-    if (GetInternalTensor().GetDataPtr() ==
-        other.GetInternalTensor().GetDataPtr()) {
+    // Make a deep copy to avoid corrupting duplicate data. Blocks are never
+    // reallocated, so chunked lists can extend themselves without a copy.
+    if (!IsChunked() && GetInternalTensor().GetDataPtr() ==
+                                other.GetInternalTensor().GetDataPtr()) {
         extension = TensorList(*this);
     }
 
-    int64_t new_reserved_size = ReserveSize(size_ + extension.GetSize());
-    if (new_reserved_size > reserved_size_) {
-        ExpandTensor(new_reserved_size);
+    std::vector<Tensor> segments = extension.GetSegments();
+    ReserveCapacity(size_ + extension.GetSize());
+    for (const Tensor& segment : segments) {
+        SetElements(size_, segment);
+        size_ += segment.GetShape(0);
     }
-    internal_tensor_.Slice(0 /* dim */, size_, size_ + extension.GetSize()) =
-            extension.AsTensor();
-    size_ = size_ + extension.GetSize();
 }
 
 Tensor TensorList::operator[](int64_t index) const {
     index = WrapDim(index, size_);  // WrapDim asserts index is within range.
+    if (IsChunked()) {
+        return chunks_[index / chunk_size_][index % chunk_size_];
+    }
     return internal_tensor_[index];
 }
 
-void TensorList::Clear() { *this = TensorList(shape_, dtype_, device_); }
+void TensorList::Clear() {
+    size_ = 0;
+    if (IsChunked()) {
+        chunks_.clear();
+        reserved_size_ = 0;
+    } else {
+        reserved_size_ = ReserveSize(0);
+        internal_tensor_ =
+                Tensor(ExpandFrontDim(shape_, reserved_size_), dtype_, device_);
+    }
+}
+
+void TensorList::SetGrowthFactor(double growth_factor) {
+    if (!(growth_factor > 1)) {
+        utility::LogError("Growth factor must be larger than 1, but got {}.",
+                          growth_factor);
+    }
+    growth_factor_ = growth_factor;
+}
 
 // Protected
 void TensorList::ExpandTensor(int64_t new_reserved_size) {
@@ -210,6 +290,59 @@ void TensorList::ExpandTensor(int64_t new_reserved_size) {
     reserved_size_ = new_reserved_size;
 }
 
+void TensorList::ReserveCapacity(int64_t n) {
+    if (!IsChunked() && growth_factor_ == 0) {
+        int64_t new_reserved_size = ReserveSize(n);
+        if (new_reserved_size > reserved_size_) {
+            ExpandTensor(new_reserved_size);
+        }
+        return;
+    }
+    if (n <= reserved_size_) {
+        return;
+    }
+
+    if (IsChunked()) {
+        while (reserved_size_ < n) {
+            chunks_.emplace_back(ExpandFrontDim(shape_, chunk_size_), dtype_,
+                                 device_);
+            reserved_size_ += chunk_size_;
+        }
+    } else {
+        int64_t grown_size = static_cast<int64_t>(std::ceil(
+                static_cast<double>(reserved_size_) * growth_factor_));
+        ExpandTensor(std::max(n, grown_size));
+    }
+}
+
+std::vector<Tensor> TensorList::GetSegments() const {
+    if (!IsChunked()) {
+        return {AsTensor()};
+    }
+    std::vector<Tensor> segments;
+    for (int64_t i = 0; i * chunk_size_ < size_; ++i) {
+        int64_t num_elements = std::min(chunk_size_, size_ - i * chunk_size_);
+        segments.push_back(chunks_[i].Slice(0 /* dim */, 0, num_elements));
+    }
+    return segments;
+}
+
+void TensorList::SetElements(int64_t begin, const Tensor& src) {
+    int64_t end = begin + src.GetShape(0);
+    if (!IsChunked()) {
+        internal_tensor_.Slice(0 /* dim */, begin, end) = src;
+        return;
+    }
+    for (int64_t i = begin; i < end;) {
+        int64_t offset = i % chunk_size_;
+        int64_t num_elements = std::min(end - i, chunk_size_ - offset);
+        chunks_[i / chunk_size_].Slice(0 /* dim */, offset,
+                                       offset + num_elements) =
+                src.Slice(0 /* dim */, i - begin, i - begin + num_elements);
+        i += num_elements;
+    }
+}
+
 SizeVector TensorList::ExpandFrontDim(const SizeVector& shape,
                                       int64_t new_dim_size /* = 1 */) {
     SizeVector expanded_shape = {new_dim_size};
@@ -251,6 +384,9 @@ std::string TensorList::ToString() const {
     rc << fmt::format("\nTensorList[size={}, shape={}, {}, {}]", size_,
                       shape_.ToString(), DtypeUtil::ToString(dtype_),
                       GetDevice().ToString());
+    if (IsChunked()) {
+        rc << fmt::format(" in {} chunks of {}", chunks_.size(), chunk_size_);
+    }
     return rc.str();
 }
 }  // namespace open3d
@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Open3D/Core/Blob.h"
 #include "Open3D/Core/Device.h"
@@ -46,6 +47,11 @@ namespace open3d {
 /// Typical use cases:
 /// - Pointcloud: (N, 3)
 /// - Sparse Voxel Grid: (N, 8, 8, 8)
+///
+/// By default, elements are stored in one internal tensor that is reallocated
+/// and copied when it runs out of capacity. A chunked TensorList instead
+/// stores elements in fixed-size blocks that are never moved, which bounds the
+/// peak memory when accumulating large streams, e.g. frames of a scan.
 class TensorList {
 public:
     /// Constructor for creating an (empty by default) tensor list.
@@ -102,6 +108,21 @@ public:
     /// Factory constructor from a raw tensor
     static TensorList FromTensor(const Tensor& tensor, bool inplace = false);
 
+    /// Factory constructor for a chunked tensor list.
+    ///
+    /// Elements are stored in blocks of \p chunk_size elements. Appending
+    /// allocates a new block when the last one is full and never copies
+    /// existing elements. AsTensor() concatenates the blocks on demand.
+    ///
+    /// \param shape Shape for the contained tensors.
+    /// \param dtype Type for the contained tensors.
+    /// \param chunk_size Number of elements per block, must be positive.
+    /// \param device Device to store the contained tensors.
+    static TensorList Chunked(const SizeVector& shape,
+                              Dtype dtype,
+                              int64_t chunk_size,
+                              const Device& device = Device("CPU:0"));
+
     /// Copy constructor from a tensor list.
     /// Create a new tensor list with copy of data.
     TensorList(const TensorList& other);
@@ -120,6 +141,9 @@ public:
     void ShallowCopyFrom(const TensorList& other);
 
     /// Return the reference of the contained valid tensors with shared memory.
+    /// For a chunked TensorList with more than one block, the blocks are
+    /// concatenated into a new tensor instead, so writes to the result are not
+    /// reflected in the list.
     Tensor AsTensor() const;
 
     /// Resize an existing tensor list.
@@ -171,8 +195,27 @@ public:
 
     int64_t GetReservedSize() const { return reserved_size_; }
 
+    /// Return the internal tensor. For a chunked TensorList, the data is held
+    /// in GetChunks() instead and the internal tensor is empty.
     const Tensor& GetInternalTensor() const { return internal_tensor_; }
 
+    bool IsChunked() const { return chunk_size_ > 0; }
+
+    /// Number of elements per block, or 0 if the TensorList is not chunked.
+    int64_t GetChunkSize() const { return chunk_size_; }
+
+    /// Blocks of a chunked TensorList, each of shape (chunk_size, *shape).
+    const std::vector<Tensor>& GetChunks() const { return chunks_; }
+
+    /// Set the factor by which the reserved size grows when the TensorList
+    /// runs out of capacity, e.g. 1.5 to lower the peak memory of growing a
+    /// large list. The factor must be larger than 1. By default, the reserved
+    /// size is rounded up to a power of two, see ReserveSize().
+    void SetGrowthFactor(double growth_factor);
+
+    /// Return the growth factor, or 0 if the default policy is used.
+    double GetGrowthFactor() const { return growth_factor_; }
+
 protected:
     // The shared internal constructor for iterators.
     template <class InputIterator>
@@ -222,6 +265,18 @@ protected:
     /// Expand the size of the internal tensor.
     void ExpandTensor(int64_t new_reserved_size);
 
+    /// Make room for \p n elements, by growing the internal tensor or by
+    /// appending blocks in chunked mode. Existing elements are kept.
+    void ReserveCapacity(int64_t n);
+
+    /// Views of the valid elements: the active part of the internal tensor,
+    /// or the active part of each block in chunked mode.
+    std::vector<Tensor> GetSegments() const;
+
+    /// Copy \p src of shape (m, *shape_) to elements [begin, begin + m). The
+    /// capacity must already be reserved.
+    void SetElements(int64_t begin, const Tensor& src);
+
     /// Expand the shape in the first indexing dimension.
     /// e.g. (8, 8, 8) -> (1, 8, 8, 8)
     static SizeVector ExpandFrontDim(const SizeVector& shape,
@@ -253,5 +308,15 @@ protected:
 
     /// The internal tensor for data storage.
     Tensor internal_tensor_;
+
+    /// Number of elements per block in chunked mode, 0 otherwise.
+    int64_t chunk_size_ = 0;
+
+    /// Blocks for data storage in chunked mode, replacing internal_tensor_.
+    /// reserved_size_ == chunks_.size() * chunk_size_.
+    std::vector<Tensor> chunks_;
+
+    /// Growth factor of reserved_size_, 0 for the power-of-two policy.
+    double growth_factor_ = 0;
 };
 }  // namespace open3d
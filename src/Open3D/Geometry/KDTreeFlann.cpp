@@ -31,8 +31,13 @@
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 
+#include <algorithm>
 #include <flann/flann.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
@@ -41,36 +46,260 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+template <typename Scalar>
+using FlannIndex = flann::Index<flann::L2<Scalar>>;
+
+/// Search parameters for batched queries, which FLANN distributes over the
+/// OpenMP threads.
+flann::SearchParams BatchSearchParams() {
+    flann::SearchParams param(-1, 0.0);
+#ifdef _OPENMP
+    param.cores = omp_get_max_threads();
+#endif
+    return param;
+}
+
+/// Converts a single query to single precision. A per-thread buffer is used
+/// so that heavily repeated searches do not allocate.
+const float *FloatQuery(const double *query, size_t dimension) {
+    static thread_local std::vector<float> buffer;
+    buffer.assign(query, query + dimension);
+    return buffer.data();
+}
+
+/// Per-thread buffer for the single precision distances of a single query.
+std::vector<float> &FloatDistanceBuffer() {
+    static thread_local std::vector<float> buffer;
+    return buffer;
+}
+
+/// Views queries stored one per column as a FLANN matrix with one query per
+/// row.
+flann::Matrix<double> FlannQueries(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries) {
+    return flann::Matrix<double>((double *)queries.data(), queries.cols(),
+                                 queries.rows(),
+                                 queries.outerStride() * sizeof(double));
+}
+
+flann::Matrix<float> FlannQueries(const Eigen::MatrixXf &queries) {
+    return flann::Matrix<float>((float *)queries.data(), queries.cols(),
+                                queries.rows());
+}
+
+template <typename Scalar>
+int SearchKNNFlann(const FlannIndex<Scalar> &index,
+                   const Scalar *query,
+                   size_t dimension,
+                   int knn,
+                   std::vector<int> &indices,
+                   std::vector<Scalar> &distance2) {
+    flann::Matrix<Scalar> query_flann((Scalar *)query, 1, dimension);
+    indices.resize(knn);
+    distance2.resize(knn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
+    flann::Matrix<Scalar> dists_flann(distance2.data(), query_flann.rows, knn);
+    int k = index.knnSearch(query_flann, indices_flann, dists_flann, knn,
+                            flann::SearchParams(-1, 0.0));
+    indices.resize(k);
+    distance2.resize(k);
+    return k;
+}
+
+template <typename Scalar>
+int SearchRadiusFlann(const FlannIndex<Scalar> &index,
+                      const Scalar *query,
+                      size_t dimension,
+                      double radius,
+                      std::vector<int> &indices,
+                      std::vector<Scalar> &distance2) {
+    flann::Matrix<Scalar> query_flann((Scalar *)query, 1, dimension);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = -1;
+    std::vector<std::vector<int>> indices_vec(1);
+    std::vector<std::vector<Scalar>> dists_vec(1);
+    int k = index.radiusSearch(query_flann, indices_vec, dists_vec,
+                               float(radius * radius), param);
+    indices = indices_vec[0];
+    distance2 = dists_vec[0];
+    return k;
+}
+
+template <typename Scalar>
+int SearchHybridFlann(const FlannIndex<Scalar> &index,
+                      const Scalar *query,
+                      size_t dimension,
+                      double radius,
+                      int max_nn,
+                      std::vector<int> &indices,
+                      std::vector<Scalar> &distance2) {
+    flann::Matrix<Scalar> query_flann((Scalar *)query, 1, dimension);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = max_nn;
+    indices.resize(max_nn);
+    distance2.resize(max_nn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, max_nn);
+    flann::Matrix<Scalar> dists_flann(distance2.data(), query_flann.rows,
+                                      max_nn);
+    int k = index.radiusSearch(query_flann, indices_flann, dists_flann,
+                               float(radius * radius), param);
+    indices.resize(k);
+    distance2.resize(k);
+    return k;
+}
+
+/// Searches the k nearest neighbors of all queries, writing k results per
+/// query in place.
+template <typename Scalar>
+void SearchKNNBatchFlann(const FlannIndex<Scalar> &index,
+                         const flann::Matrix<Scalar> &queries,
+                         int k,
+                         std::vector<int> &indices,
+                         std::vector<Scalar> &distance2) {
+    indices.resize(queries.rows * k);
+    distance2.resize(queries.rows * k);
+    if (queries.rows == 0 || k == 0) {
+        return;
+    }
+    flann::Matrix<int> indices_flann(indices.data(), queries.rows, k);
+    flann::Matrix<Scalar> dists_flann(distance2.data(), queries.rows, k);
+    index.knnSearch(queries, indices_flann, dists_flann, k,
+                    BatchSearchParams());
+}
+
+template <typename Scalar>
+int64_t SearchRadiusBatchFlann(const FlannIndex<Scalar> &index,
+                               const flann::Matrix<Scalar> &queries,
+                               double radius,
+                               std::vector<int64_t> &offsets,
+                               std::vector<int> &indices,
+                               std::vector<double> &distance2) {
+    const int64_t num_queries = queries.rows;
+    offsets.assign(num_queries + 1, 0);
+    indices.clear();
+    distance2.clear();
+    if (num_queries == 0) {
+        return 0;
+    }
+    std::vector<std::vector<int>> indices_vec(num_queries);
+    std::vector<std::vector<Scalar>> dists_vec(num_queries);
+    index.radiusSearch(queries, indices_vec, dists_vec, float(radius * radius),
+                       BatchSearchParams());
+    for (int64_t i = 0; i < num_queries; i++) {
+        offsets[i + 1] = offsets[i] + int64_t(indices_vec[i].size());
+    }
+    indices.resize(offsets[num_queries]);
+    distance2.resize(offsets[num_queries]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < num_queries; i++) {
+        std::copy(indices_vec[i].begin(), indices_vec[i].end(),
+                  indices.begin() + offsets[i]);
+        std::copy(dists_vec[i].begin(), dists_vec[i].end(),
+                  distance2.begin() + offsets[i]);
+    }
+    return offsets[num_queries];
+}
+
+template <typename Scalar>
+int64_t SearchHybridBatchFlann(const FlannIndex<Scalar> &index,
+                               const flann::Matrix<Scalar> &queries,
+                               double radius,
+                               int max_nn,
+                               std::vector<int64_t> &offsets,
+                               std::vector<int> &indices,
+                               std::vector<double> &distance2) {
+    const int64_t num_queries = queries.rows;
+    offsets.assign(num_queries + 1, 0);
+    indices.clear();
+    distance2.clear();
+    if (num_queries == 0 || max_nn == 0) {
+        return 0;
+    }
+    // FLANN fills max_nn slots per query and marks the end of shorter rows
+    // with index -1, the rows are compacted afterwards.
+    std::vector<int> indices_padded(num_queries * max_nn);
+    std::vector<Scalar> dists_padded(num_queries * max_nn);
+    flann::Matrix<int> indices_flann(indices_padded.data(), num_queries,
+                                     max_nn);
+    flann::Matrix<Scalar> dists_flann(dists_padded.data(), num_queries,
+                                      max_nn);
+    flann::SearchParams param = BatchSearchParams();
+    param.max_neighbors = max_nn;
+    index.radiusSearch(queries, indices_flann, dists_flann,
+                       float(radius * radius), param);
+    for (int64_t i = 0; i < num_queries; i++) {
+        const int *row = indices_flann[i];
+        int k = 0;
+        while (k < max_nn && row[k] != -1) {
+            k++;
+        }
+        offsets[i + 1] = offsets[i] + k;
+    }
+    indices.resize(offsets[num_queries]);
+    distance2.resize(offsets[num_queries]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < num_queries; i++) {
+        const int64_t k = offsets[i + 1] - offsets[i];
+        std::copy(indices_padded.begin() + i * max_nn,
+                  indices_padded.begin() + i * max_nn + k,
+                  indices.begin() + offsets[i]);
+        std::copy(dists_padded.begin() + i * max_nn,
+                  dists_padded.begin() + i * max_nn + k,
+                  distance2.begin() + offsets[i]);
+    }
+    return offsets[num_queries];
+}
+
+}  // unnamed namespace
+
 KDTreeFlann::KDTreeFlann() {}
 
-KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
+KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data, bool use_float32) {
+    SetMatrixData(data, use_float32);
+}
 
-KDTreeFlann::KDTreeFlann(const Geometry &geometry) { SetGeometry(geometry); }
+KDTreeFlann::KDTreeFlann(const Geometry &geometry, bool use_float32) {
+    SetGeometry(geometry, use_float32);
+}
 
-KDTreeFlann::KDTreeFlann(const registration::Feature &feature) {
-    SetFeature(feature);
+KDTreeFlann::KDTreeFlann(const registration::Feature &feature,
+                         bool use_float32) {
+    SetFeature(feature, use_float32);
 }
 
 KDTreeFlann::~KDTreeFlann() {}
 
-bool KDTreeFlann::SetMatrixData(const Eigen::MatrixXd &data) {
+bool KDTreeFlann::SetMatrixData(const Eigen::MatrixXd &data,
+                                bool use_float32) {
     return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-            data.data(), data.rows(), data.cols()));
+                              data.data(), data.rows(), data.cols()),
+                      use_float32);
 }
 
-bool KDTreeFlann::SetGeometry(const Geometry &geometry) {
+bool KDTreeFlann::SetGeometry(const Geometry &geometry, bool use_float32) {
     switch (geometry.GetGeometryType()) {
         case Geometry::GeometryType::PointCloud:
-            return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-                    (const double *)((const PointCloud &)geometry)
-                            .points_.data(),
-                    3, ((const PointCloud &)geometry).points_.size()));
+            return SetRawData(
+                    Eigen::Map<const Eigen::MatrixXd>(
+                            (const double *)((const PointCloud &)geometry)
+                                    .points_.data(),
+                            3, ((const PointCloud &)geometry).points_.size()),
+                    use_float32);
         case Geometry::GeometryType::TriangleMesh:
         case Geometry::GeometryType::HalfEdgeTriangleMesh:
-            return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
-                    (const double *)((const TriangleMesh &)geometry)
-                            .vertices_.data(),
-                    3, ((const TriangleMesh &)geometry).vertices_.size()));
+            return SetRawData(
+                    Eigen::Map<const Eigen::MatrixXd>(
+                            (const double *)((const TriangleMesh &)geometry)
+                                    .vertices_.data(),
+                            3,
+                            ((const TriangleMesh &)geometry).vertices_.size()),
+                    use_float32);
         case Geometry::GeometryType::Image:
         case Geometry::GeometryType::Unspecified:
         default:
@@ -80,8 +309,9 @@ bool KDTreeFlann::SetGeometry(const Geometry &geometry) {
     }
 }
 
-bool KDTreeFlann::SetFeature(const registration::Feature &feature) {
-    return SetMatrixData(feature.data_);
+bool KDTreeFlann::SetFeature(const registration::Feature &feature,
+                             bool use_float32) {
+    return SetMatrixData(feature.data_, use_float32);
 }
 
 template <typename T>
@@ -116,20 +346,19 @@ int KDTreeFlann::SearchKNN(const T &query,
     // This is optimized code for heavily repeated search.
     // Other flann::Index::knnSearch() implementations lose performance due to
     // memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || knn < 0) {
+    if (dataset_size_ == 0 || size_t(query.rows()) != dimension_ || knn < 0) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    indices.resize(knn);
-    distance2.resize(knn);
-    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
-    flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows, knn);
-    int k = flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
-                                    knn, flann::SearchParams(-1, 0.0));
-    indices.resize(k);
-    distance2.resize(k);
-    return k;
+    if (flann_index_float_) {
+        std::vector<float> &dists = FloatDistanceBuffer();
+        int k = SearchKNNFlann(*flann_index_float_,
+                               FloatQuery(query.data(), dimension_),
+                               dimension_, knn, indices, dists);
+        distance2.assign(dists.begin(), dists.end());
+        return k;
+    }
+    return SearchKNNFlann(*flann_index_, query.data(), dimension_, knn,
+                          indices, distance2);
 }
 
 template <typename T>
@@ -141,20 +370,19 @@ int KDTreeFlann::SearchRadius(const T &query,
     // Since max_nn is not given, we let flann to do its own memory management.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory management and CPU caching.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_) {
+    if (dataset_size_ == 0 || size_t(query.rows()) != dimension_) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
-    param.max_neighbors = -1;
-    std::vector<std::vector<int>> indices_vec(1);
-    std::vector<std::vector<double>> dists_vec(1);
-    int k = flann_index_->radiusSearch(query_flann, indices_vec, dists_vec,
-                                       float(radius * radius), param);
-    indices = indices_vec[0];
-    distance2 = dists_vec[0];
-    return k;
+    if (flann_index_float_) {
+        std::vector<float> &dists = FloatDistanceBuffer();
+        int k = SearchRadiusFlann(*flann_index_float_,
+                                  FloatQuery(query.data(), dimension_),
+                                  dimension_, radius, indices, dists);
+        distance2.assign(dists.begin(), dists.end());
+        return k;
+    }
+    return SearchRadiusFlann(*flann_index_, query.data(), dimension_, radius,
+                             indices, distance2);
 }
 
 template <typename T>
@@ -167,40 +395,148 @@ int KDTreeFlann::SearchHybrid(const T &query,
     // It is also the recommended setting for search.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || max_nn < 0) {
+    if (dataset_size_ == 0 || size_t(query.rows()) != dimension_ ||
+        max_nn < 0) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
-    param.max_neighbors = max_nn;
-    indices.resize(max_nn);
-    distance2.resize(max_nn);
-    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, max_nn);
-    flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows,
-                                      max_nn);
-    int k = flann_index_->radiusSearch(query_flann, indices_flann, dists_flann,
-                                       float(radius * radius), param);
-    indices.resize(k);
-    distance2.resize(k);
-    return k;
+    if (flann_index_float_) {
+        std::vector<float> &dists = FloatDistanceBuffer();
+        int k = SearchHybridFlann(*flann_index_float_,
+                                  FloatQuery(query.data(), dimension_),
+                                  dimension_, radius, max_nn, indices, dists);
+        distance2.assign(dists.begin(), dists.end());
+        return k;
+    }
+    return SearchHybridFlann(*flann_index_, query.data(), dimension_, radius,
+                             max_nn, indices, distance2);
 }
 
-bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
-    dimension_ = data.rows();
-    dataset_size_ = data.cols();
-    if (dimension_ == 0 || dataset_size_ == 0) {
+int64_t KDTreeFlann::SearchBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        const KDTreeSearchParam &param,
+        std::vector<int64_t> &offsets,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return SearchKNNBatch(queries,
+                                  ((const KDTreeSearchParamKNN &)param).knn_,
+                                  offsets, indices, distance2);
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadiusBatch(
+                    queries, ((const KDTreeSearchParamRadius &)param).radius_,
+                    offsets, indices, distance2);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybridBatch(
+                    queries, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, offsets,
+                    indices, distance2);
+        default:
+            return -1;
+    }
+    return -1;
+}
+
+int64_t KDTreeFlann::SearchKNNBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        int knn,
+        std::vector<int64_t> &offsets,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    if (dataset_size_ == 0 || size_t(queries.rows()) != dimension_ ||
+        knn < 0) {
+        return -1;
+    }
+    // Every query finds the same number of neighbors, so FLANN can write the
+    // results in place.
+    const int64_t num_queries = queries.cols();
+    const int k = int(std::min(size_t(knn), dataset_size_));
+    offsets.resize(num_queries + 1);
+    for (int64_t i = 0; i <= num_queries; i++) {
+        offsets[i] = i * k;
+    }
+    if (flann_index_float_) {
+        const Eigen::MatrixXf queries_float = queries.cast<float>();
+        std::vector<float> dists;
+        SearchKNNBatchFlann(*flann_index_float_, FlannQueries(queries_float),
+                            k, indices, dists);
+        distance2.assign(dists.begin(), dists.end());
+    } else {
+        SearchKNNBatchFlann(*flann_index_, FlannQueries(queries), k, indices,
+                            distance2);
+    }
+    return num_queries * k;
+}
+
+int64_t KDTreeFlann::SearchRadiusBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        std::vector<int64_t> &offsets,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    if (dataset_size_ == 0 || size_t(queries.rows()) != dimension_) {
+        return -1;
+    }
+    if (flann_index_float_) {
+        const Eigen::MatrixXf queries_float = queries.cast<float>();
+        return SearchRadiusBatchFlann(*flann_index_float_,
+                                      FlannQueries(queries_float), radius,
+                                      offsets, indices, distance2);
+    }
+    return SearchRadiusBatchFlann(*flann_index_, FlannQueries(queries), radius,
+                                  offsets, indices, distance2);
+}
+
+int64_t KDTreeFlann::SearchHybridBatch(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        int max_nn,
+        std::vector<int64_t> &offsets,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const {
+    if (dataset_size_ == 0 || size_t(queries.rows()) != dimension_ ||
+        max_nn < 0) {
+        return -1;
+    }
+    if (flann_index_float_) {
+        const Eigen::MatrixXf queries_float = queries.cast<float>();
+        return SearchHybridBatchFlann(*flann_index_float_,
+                                      FlannQueries(queries_float), radius,
+                                      max_nn, offsets, indices, distance2);
+    }
+    return SearchHybridBatchFlann(*flann_index_, FlannQueries(queries), radius,
+                                  max_nn, offsets, indices, distance2);
+}
+
+bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data,
+                             bool use_float32) {
+    flann_index_.reset();
+    flann_index_float_.reset();
+    dimension_ = 0;
+    dataset_size_ = 0;
+    if (data.rows() == 0 || data.cols() == 0) {
         utility::LogWarning("[KDTreeFlann::SetRawData] Failed due to no data.");
         return false;
     }
-    data_.resize(dataset_size_ * dimension_);
-    memcpy(data_.data(), data.data(),
-           dataset_size_ * dimension_ * sizeof(double));
-    flann_dataset_.reset(new flann::Matrix<double>((double *)data_.data(),
-                                                   dataset_size_, dimension_));
-    flann_index_.reset(new flann::Index<flann::L2<double>>(
-            *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
-    flann_index_->buildIndex();
+    dimension_ = data.rows();
+    dataset_size_ = data.cols();
+    // The single index copies the points into its own reordered storage when
+    // it is built and searches only that copy, so the input is not copied
+    // here and does not need to outlive the tree.
+    if (use_float32) {
+        Eigen::MatrixXf data_float = data.cast<float>();
+        flann_index_float_.reset(new FlannIndex<float>(
+                flann::Matrix<float>(data_float.data(), dataset_size_,
+                                     dimension_),
+                flann::KDTreeSingleIndexParams(15)));
+        flann_index_float_->buildIndex();
+    } else {
+        flann_index_.reset(new FlannIndex<double>(
+                flann::Matrix<double>((double *)data.data(), dataset_size_,
+                                      dimension_),
+                flann::KDTreeSingleIndexParams(15)));
+        flann_index_->buildIndex();
+    }
     return true;
 }
 
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -36,8 +37,6 @@
 
 namespace flann {
 template <typename T>
-class Matrix;
-template <typename T>
 struct L2;
 template <typename T>
 class Index;
@@ -49,6 +48,11 @@ namespace geometry {
 /// \class KDTreeFlann
 ///
 /// \brief KDTree with FLANN for nearest neighbor search.
+///
+/// The tree keeps its own copy of the points, so the data it was built from
+/// does not need to outlive it. With use_float32 the points are stored and
+/// compared in single precision, which halves the memory of the tree and is
+/// faster to search, at the cost of float rounding in the distances.
 class KDTreeFlann {
 public:
     /// \brief Default Constructor.
@@ -56,16 +60,20 @@ public:
     /// \brief Parameterized Constructor.
     ///
     /// \param data Provides set of data points for KDTree construction.
-    KDTreeFlann(const Eigen::MatrixXd &data);
+    /// \param use_float32 Builds a single precision tree.
+    KDTreeFlann(const Eigen::MatrixXd &data, bool use_float32 = false);
     /// \brief Parameterized Constructor.
     ///
     /// \param geometry Provides geometry from which KDTree is constructed.
-    KDTreeFlann(const Geometry &geometry);
+    /// \param use_float32 Builds a single precision tree.
+    KDTreeFlann(const Geometry &geometry, bool use_float32 = false);
     /// \brief Parameterized Constructor.
     ///
     /// \param feature Provides a set of features from which the KDTree is
     /// constructed.
-    KDTreeFlann(const registration::Feature &feature);
+    /// \param use_float32 Builds a single precision tree.
+    KDTreeFlann(const registration::Feature &feature,
+                bool use_float32 = false);
     ~KDTreeFlann();
     KDTreeFlann(const KDTreeFlann &) = delete;
     KDTreeFlann &operator=(const KDTreeFlann &) = delete;
@@ -74,15 +82,19 @@ public:
     /// Sets the data for the KDTree from a matrix.
     ///
     /// \param data Data points for KDTree Construction.
-    bool SetMatrixData(const Eigen::MatrixXd &data);
+    /// \param use_float32 Builds a single precision tree.
+    bool SetMatrixData(const Eigen::MatrixXd &data, bool use_float32 = false);
     /// Sets the data for the KDTree from geometry.
     ///
     /// \param geometry Geometry for KDTree Construction.
-    bool SetGeometry(const Geometry &geometry);
+    /// \param use_float32 Builds a single precision tree.
+    bool SetGeometry(const Geometry &geometry, bool use_float32 = false);
     /// Sets the data for the KDTree from the feature data.
     ///
     /// \param feature Set of features for KDTree construction.
-    bool SetFeature(const registration::Feature &feature);
+    /// \param use_float32 Builds a single precision tree.
+    bool SetFeature(const registration::Feature &feature,
+                    bool use_float32 = false);
 
     template <typename T>
     int Search(const T &query,
@@ -109,17 +121,63 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Searches the neighbors of a batch of queries in parallel.
+    ///
+    /// The results are returned in compressed sparse row layout: the
+    /// neighbors of query i are indices[offsets[i]] to
+    /// indices[offsets[i + 1] - 1], sorted by their squared distances in
+    /// distance2.
+    ///
+    /// \param queries Query points, one per column.
+    /// \param param Search parameters.
+    /// \param offsets Offsets of the neighbors of each query, of size
+    /// queries.cols() + 1.
+    /// \param indices Indices of the neighbors of all queries.
+    /// \param distance2 Squared distances of the neighbors of all queries.
+    /// \return The total number of neighbors found, or -1 on invalid input.
+    int64_t SearchBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                        const KDTreeSearchParam &param,
+                        std::vector<int64_t> &offsets,
+                        std::vector<int> &indices,
+                        std::vector<double> &distance2) const;
+
+    /// Batched version of SearchKNN, see SearchBatch for the result layout.
+    int64_t SearchKNNBatch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                           int knn,
+                           std::vector<int64_t> &offsets,
+                           std::vector<int> &indices,
+                           std::vector<double> &distance2) const;
+
+    /// Batched version of SearchRadius, see SearchBatch for the result
+    /// layout.
+    int64_t SearchRadiusBatch(
+            const Eigen::Ref<const Eigen::MatrixXd> &queries,
+            double radius,
+            std::vector<int64_t> &offsets,
+            std::vector<int> &indices,
+            std::vector<double> &distance2) const;
+
+    /// Batched version of SearchHybrid, see SearchBatch for the result
+    /// layout.
+    int64_t SearchHybridBatch(
+            const Eigen::Ref<const Eigen::MatrixXd> &queries,
+            double radius,
+            int max_nn,
+            std::vector<int64_t> &offsets,
+            std::vector<int> &indices,
+            std::vector<double> &distance2) const;
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
     /// Internal method that sets all the members of KDTree by data provided by
     /// features, geometry, etc.
-    bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
+    bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data,
+                    bool use_float32);
 
 protected:
-    std::vector<double> data_;
-    std::unique_ptr<flann::Matrix<double>> flann_dataset_;
     std::unique_ptr<flann::Index<flann::L2<double>>> flann_index_;
+    std::unique_ptr<flann::Index<flann::L2<float>>> flann_index_float_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
 };
@@ -29,12 +29,18 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <cstdint>
 #include <numeric>
 
+#include "Open3D/Core/Kernel/RadixSort.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/Qhull.h"
 #include "Open3D/Utility/Console.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace open3d {
 namespace geometry {
 
@@ -316,27 +322,182 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    const int64_t num_points = int64_t(points_.size());
+    if (num_points == 0) {
+        return output;
+    }
+    auto voxel_index = [&](int i) {
+        Eigen::Vector3d ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
+        return Eigen::Vector3i(int(floor(ref_coord(0))),
+                               int(floor(ref_coord(1))),
+                               int(floor(ref_coord(2))));
+    };
+
+    // Group the points by voxel with a stable sort of the point indices, such
+    // that the output is ordered by voxel index (x varying fastest) and each
+    // voxel accumulates its points in the input order. Voxel indices are
+    // packed into one key if the voxel grid is small enough, otherwise the
+    // indices are sorted by the x, y and z voxel indices in turn.
+    const Eigen::Array3d grid_size =
+            ((voxel_max_bound - voxel_min_bound) / voxel_size).array().floor() +
+            1.0;
+    const bool use_packed_keys = grid_size.prod() < std::pow(2.0, 62);
+    const uint64_t grid_x = uint64_t(grid_size(0));
+    const uint64_t grid_y = uint64_t(grid_size(1));
+    const uint64_t grid_z = uint64_t(grid_size(2));
+    std::vector<uint64_t> keys(num_points);
+    std::vector<int> indices(num_points);
+    std::iota(indices.begin(), indices.end(), 0);
+    if (use_packed_keys) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < num_points; i++) {
+            Eigen::Vector3i index = voxel_index(int(i));
+            keys[i] = uint64_t(index(0)) +
+                      grid_x * (uint64_t(index(1)) +
+                                grid_y * uint64_t(index(2)));
+        }
+        const uint64_t num_grid_voxels = grid_x * grid_y * grid_z;
+        if (num_grid_voxels <= uint64_t(num_points) / 4) {
+            // Coarse grids accumulate into a dense array of voxels instead,
+            // each thread owning a range of voxels. The points are first
+            // partitioned by owner, keeping the input order within each
+            // owner, such that every thread only visits its own points.
+            std::vector<AccumulatedPoint> voxels(num_grid_voxels);
+#ifdef _OPENMP
+            const int max_threads = omp_get_max_threads();
+#else
+            const int max_threads = 1;
+#endif
+            std::vector<int64_t> offsets(max_threads * (max_threads + 1));
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+#ifdef _OPENMP
+                const uint64_t thread_id = uint64_t(omp_get_thread_num());
+                const uint64_t num_threads = uint64_t(omp_get_num_threads());
+#else
+                const uint64_t thread_id = 0;
+                const uint64_t num_threads = 1;
+#endif
+                auto owner = [&](uint64_t key) {
+                    return key * num_threads / num_grid_voxels;
+                };
+                const int64_t begin = num_points * thread_id / num_threads;
+                const int64_t end = num_points * (thread_id + 1) / num_threads;
+
+                // offsets[t * num_threads + o] counts the points of thread
+                // t's input range that are owned by thread o.
+                int64_t *thread_offsets =
+                        offsets.data() + thread_id * num_threads;
+                for (int64_t i = begin; i < end; i++) {
+                    thread_offsets[owner(keys[i])]++;
+                }
+#ifdef _OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+                {
+                    // Exclusive prefix sum in (owner, thread) order. The
+                    // last row holds the start of each owner's points.
+                    int64_t *owner_starts =
+                            offsets.data() + num_threads * num_threads;
+                    int64_t offset = 0;
+                    for (uint64_t o = 0; o < num_threads; o++) {
+                        owner_starts[o] = offset;
+                        for (uint64_t t = 0; t < num_threads; t++) {
+                            int64_t count = offsets[t * num_threads + o];
+                            offsets[t * num_threads + o] = offset;
+                            offset += count;
+                        }
+                    }
+                }
+                for (int64_t i = begin; i < end; i++) {
+                    indices[thread_offsets[owner(keys[i])]++] = int(i);
+                }
+#ifdef _OPENMP
+#pragma omp barrier
+#endif
+                const int64_t *owner_starts =
+                        offsets.data() + num_threads * num_threads;
+                const int64_t owner_end = thread_id + 1 < num_threads
+                                                  ? owner_starts[thread_id + 1]
+                                                  : num_points;
+                for (int64_t k = owner_starts[thread_id]; k < owner_end;
+                     k++) {
+                    voxels[keys[indices[k]]].AddPoint(*this, indices[k]);
+                }
+            }
+            for (const AccumulatedPoint &accpoint : voxels) {
+                if (accpoint.num_of_points_ == 0) {
+                    continue;
+                }
+                output->points_.push_back(accpoint.GetAveragePoint());
+                if (HasNormals()) {
+                    output->normals_.push_back(accpoint.GetAverageNormal());
+                }
+                if (HasColors()) {
+                    output->colors_.push_back(accpoint.GetAverageColor());
+                }
+            }
+            utility::LogDebug(
+                    "Pointcloud down sampled from {:d} points to {:d} "
+                    "points.",
+                    (int)points_.size(), (int)output->points_.size());
+            return output;
+        }
+        kernel::RadixSortPairs(keys, indices, true);
+    } else {
+        for (int c = 0; c < 3; c++) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int64_t i = 0; i < num_points; i++) {
+                keys[i] = uint64_t(voxel_index(indices[i])(c));
+            }
+            kernel::RadixSortPairs(keys, indices, true);
+        }
+    }
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
+    // Points of voxel v are indices[voxel_starts[v]:voxel_starts[v + 1]].
+    std::vector<int64_t> voxel_starts(1, 0);
+    for (int64_t i = 1; i < num_points; i++) {
+        bool is_new_voxel = use_packed_keys
+                                    ? keys[i] != keys[i - 1]
+                                    : voxel_index(indices[i]) !=
+                                              voxel_index(indices[i - 1]);
+        if (is_new_voxel) {
+            voxel_starts.push_back(i);
+        }
     }
+    voxel_starts.push_back(num_points);
+
+    const int64_t num_voxels = int64_t(voxel_starts.size()) - 1;
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t v = 0; v < num_voxels; v++) {
+        AccumulatedPoint accpoint;
+        for (int64_t i = voxel_starts[v]; i < voxel_starts[v + 1]; i++) {
+            accpoint.AddPoint(*this, indices[i]);
+        }
+        output->points_[v] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+            output->colors_[v] = accpoint.GetAverageColor();
         }
     }
     utility::LogDebug(
@@ -133,7 +133,10 @@ public:
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
-    /// Normals and colors are averaged if they exist.
+    /// Normals and colors are averaged if they exist. The points are grouped
+    /// by a parallel radix sort of their voxel indices, and the output is
+    /// ordered by voxel index with x varying fastest, independent of the
+    /// number of threads.
     ///
     /// \param voxel_size Defines the resolution of the voxel grid,
     /// smaller value leads to denser output point cloud.
@@ -0,0 +1,527 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/RaycastingScene.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+/// Returns the distance at which the ray enters the box, or infinity if it
+/// misses the box within (0, t_max].
+double IntersectRayBox(const Eigen::Vector3d &origin,
+                       const Eigen::Vector3d &inv_direction,
+                       const Eigen::Vector3d &min_bound,
+                       const Eigen::Vector3d &max_bound,
+                       double t_max) {
+    double t_near = 0.0;
+    double t_far = t_max;
+    for (int axis = 0; axis < 3; ++axis) {
+        double t0 = (min_bound(axis) - origin(axis)) * inv_direction(axis);
+        double t1 = (max_bound(axis) - origin(axis)) * inv_direction(axis);
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        // NaN, for rays parallel to and starting on a slab boundary, leaves
+        // the interval unchanged.
+        t_near = t0 > t_near ? t0 : t_near;
+        t_far = t1 < t_far ? t1 : t_far;
+    }
+    return t_near <= t_far ? t_near : kInf;
+}
+
+/// Moeller-Trumbore ray triangle intersection for the triangle with vertices
+/// v0, v0 + e1 and v0 + e2.
+bool IntersectRayTriangle(const Eigen::Vector3d &origin,
+                          const Eigen::Vector3d &direction,
+                          const Eigen::Vector3d &v0,
+                          const Eigen::Vector3d &e1,
+                          const Eigen::Vector3d &e2,
+                          double &t,
+                          double &u,
+                          double &v) {
+    Eigen::Vector3d p = direction.cross(e2);
+    double det = e1.dot(p);
+    if (det == 0.0) {
+        return false;
+    }
+    double inv_det = 1.0 / det;
+    Eigen::Vector3d s = origin - v0;
+    u = s.dot(p) * inv_det;
+    if (u < 0.0 || u > 1.0) {
+        return false;
+    }
+    Eigen::Vector3d q = s.cross(e1);
+    v = direction.dot(q) * inv_det;
+    if (v < 0.0 || u + v > 1.0) {
+        return false;
+    }
+    t = e2.dot(q) * inv_det;
+    return t > 0.0;
+}
+
+/// Returns the barycentric coordinates (u, v) of the point closest to p on
+/// the triangle with vertices v0, v0 + e1 and v0 + e2, following Ericson,
+/// Real-Time Collision Detection, 5.1.5.
+Eigen::Vector2d ClosestPointOnTriangle(const Eigen::Vector3d &p,
+                                       const Eigen::Vector3d &v0,
+                                       const Eigen::Vector3d &e1,
+                                       const Eigen::Vector3d &e2) {
+    Eigen::Vector3d ap = p - v0;
+    double d1 = e1.dot(ap);
+    double d2 = e2.dot(ap);
+    if (d1 <= 0.0 && d2 <= 0.0) {
+        return Eigen::Vector2d(0.0, 0.0);
+    }
+    Eigen::Vector3d bp = ap - e1;
+    double d3 = e1.dot(bp);
+    double d4 = e2.dot(bp);
+    if (d3 >= 0.0 && d4 <= d3) {
+        return Eigen::Vector2d(1.0, 0.0);
+    }
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+        return Eigen::Vector2d(d1 / (d1 - d3), 0.0);
+    }
+    Eigen::Vector3d cp = ap - e2;
+    double d5 = e1.dot(cp);
+    double d6 = e2.dot(cp);
+    if (d6 >= 0.0 && d5 <= d6) {
+        return Eigen::Vector2d(0.0, 1.0);
+    }
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+        return Eigen::Vector2d(0.0, d2 / (d2 - d6));
+    }
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && d4 - d3 >= 0.0 && d5 - d6 >= 0.0) {
+        double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return Eigen::Vector2d(1.0 - w, w);
+    }
+    double denom = 1.0 / (va + vb + vc);
+    return Eigen::Vector2d(vb * denom, vc * denom);
+}
+
+double SquaredDistanceToBox(const Eigen::Vector3d &p,
+                            const Eigen::Vector3d &min_bound,
+                            const Eigen::Vector3d &max_bound) {
+    return (min_bound - p).cwiseMax(p - max_bound).cwiseMax(0.0).squaredNorm();
+}
+
+/// Calls leaf_func(i) for the triangles i, in BVH order, of the leaves the
+/// ray enters before t_max, nearer nodes first. leaf_func may lower t_max.
+template <typename LeafFunc>
+void TraverseRay(const std::vector<TriangleBVH::Node> &nodes,
+                 const Eigen::Vector3d &origin,
+                 const Eigen::Vector3d &direction,
+                 const double &t_max,
+                 std::vector<std::pair<int, double>> &stack,
+                 LeafFunc leaf_func) {
+    if (nodes.empty()) {
+        return;
+    }
+    const Eigen::Vector3d inv_direction = direction.cwiseInverse();
+    stack.clear();
+    stack.push_back(std::make_pair(0, IntersectRayBox(origin, inv_direction,
+                                                      nodes[0].min_bound_,
+                                                      nodes[0].max_bound_,
+                                                      t_max)));
+    while (!stack.empty()) {
+        const int n = stack.back().first;
+        const double t_enter = stack.back().second;
+        stack.pop_back();
+        if (t_enter > t_max) {
+            continue;
+        }
+        const TriangleBVH::Node &node = nodes[n];
+        if (node.IsLeaf()) {
+            for (int i = node.begin_; i < node.end_; ++i) {
+                leaf_func(i);
+            }
+            continue;
+        }
+        int child0 = n + 1;
+        int child1 = node.second_child_;
+        double t0 = IntersectRayBox(origin, inv_direction,
+                                    nodes[child0].min_bound_,
+                                    nodes[child0].max_bound_, t_max);
+        double t1 = IntersectRayBox(origin, inv_direction,
+                                    nodes[child1].min_bound_,
+                                    nodes[child1].max_bound_, t_max);
+        if (t0 > t1) {
+            std::swap(child0, child1);
+            std::swap(t0, t1);
+        }
+        if (t1 < kInf) {
+            stack.push_back(std::make_pair(child1, t1));
+        }
+        if (t0 < kInf) {
+            stack.push_back(std::make_pair(child0, t0));
+        }
+    }
+}
+
+void CheckRays(const std::vector<Eigen::Vector3d> &origins,
+               const std::vector<Eigen::Vector3d> &directions) {
+    if (origins.size() != directions.size()) {
+        utility::LogError(
+                "[RaycastingScene] Number of origins {:d} and directions "
+                "{:d} differ.",
+                origins.size(), directions.size());
+    }
+}
+
+}  // unnamed namespace
+
+constexpr int RaycastingScene::INVALID_ID;
+
+RaycastingScene::RaycastingScene() {}
+
+RaycastingScene::~RaycastingScene() {}
+
+int RaycastingScene::AddTriangles(const TriangleMesh &mesh) {
+    const int geometry_id = int(triangle_offsets_.size());
+    const Eigen::Vector3i vertex_offset =
+            Eigen::Vector3i::Constant(int(mesh_.vertices_.size()));
+    triangle_offsets_.push_back(int(mesh_.triangles_.size()));
+    mesh_.vertices_.insert(mesh_.vertices_.end(), mesh.vertices_.begin(),
+                           mesh.vertices_.end());
+    for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+        mesh_.triangles_.push_back(triangle + vertex_offset);
+    }
+
+    bvh_is_current_ = false;
+    return geometry_id;
+}
+
+void RaycastingScene::UpdateBVH() const {
+    std::lock_guard<std::mutex> lock(bvh_mutex_);
+    if (bvh_is_current_) {
+        return;
+    }
+    bvh_.SetMesh(mesh_);
+    const std::vector<int> &triangle_indices = bvh_.GetTriangleIndices();
+    const int num_triangles = int(triangle_indices.size());
+    triangle_v0_.resize(num_triangles);
+    triangle_e1_.resize(num_triangles);
+    triangle_e2_.resize(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_triangles; ++i) {
+        const Eigen::Vector3i &triangle = mesh_.triangles_[triangle_indices[i]];
+        triangle_v0_[i] = mesh_.vertices_[triangle(0)];
+        triangle_e1_[i] = mesh_.vertices_[triangle(1)] - triangle_v0_[i];
+        triangle_e2_[i] = mesh_.vertices_[triangle(2)] - triangle_v0_[i];
+    }
+    bvh_is_current_ = true;
+}
+
+RaycastingScene::RaycastResult RaycastingScene::CastRays(
+        const std::vector<Eigen::Vector3d> &origins,
+        const std::vector<Eigen::Vector3d> &directions) const {
+    CheckRays(origins, directions);
+    UpdateBVH();
+    const int num_rays = int(origins.size());
+    RaycastResult result;
+    result.t_hit_.assign(num_rays, kInf);
+    result.geometry_ids_.assign(num_rays, INVALID_ID);
+    result.triangle_ids_.assign(num_rays, INVALID_ID);
+    result.triangle_uvs_.assign(num_rays, Eigen::Vector2d::Zero());
+    result.triangle_normals_.assign(num_rays, Eigen::Vector3d::Zero());
+    const std::vector<TriangleBVH::Node> &nodes = bvh_.GetNodes();
+    const std::vector<int> &triangle_indices = bvh_.GetTriangleIndices();
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<std::pair<int, double>> stack;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for (int r = 0; r < num_rays; ++r) {
+            const Eigen::Vector3d &origin = origins[r];
+            const Eigen::Vector3d &direction = directions[r];
+            double t_hit = kInf;
+            int hit = -1;
+            Eigen::Vector2d uv;
+            TraverseRay(nodes, origin, direction, t_hit, stack, [&](int i) {
+                double t, u, v;
+                if (IntersectRayTriangle(origin, direction, triangle_v0_[i],
+                                         triangle_e1_[i], triangle_e2_[i], t,
+                                         u, v) &&
+                    t < t_hit) {
+                    t_hit = t;
+                    hit = i;
+                    uv = Eigen::Vector2d(u, v);
+                }
+            });
+            if (hit < 0) {
+                continue;
+            }
+            const int triangle_id = triangle_indices[hit];
+            const int geometry_id =
+                    int(std::upper_bound(triangle_offsets_.begin(),
+                                         triangle_offsets_.end(),
+                                         triangle_id) -
+                        triangle_offsets_.begin()) -
+                    1;
+            result.t_hit_[r] = t_hit;
+            result.geometry_ids_[r] = geometry_id;
+            result.triangle_ids_[r] =
+                    triangle_id - triangle_offsets_[geometry_id];
+            result.triangle_uvs_[r] = uv;
+            result.triangle_normals_[r] =
+                    triangle_e1_[hit].cross(triangle_e2_[hit]).normalized();
+        }
+    }
+    return result;
+}
+
+std::vector<int> RaycastingScene::CountIntersections(
+        const std::vector<Eigen::Vector3d> &origins,
+        const std::vector<Eigen::Vector3d> &directions) const {
+    CheckRays(origins, directions);
+    UpdateBVH();
+    const int num_rays = int(origins.size());
+    std::vector<int> counts(num_rays, 0);
+    const std::vector<TriangleBVH::Node> &nodes = bvh_.GetNodes();
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<std::pair<int, double>> stack;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for (int r = 0; r < num_rays; ++r) {
+            const Eigen::Vector3d &origin = origins[r];
+            const Eigen::Vector3d &direction = directions[r];
+            int count = 0;
+            TraverseRay(nodes, origin, direction, kInf, stack, [&](int i) {
+                double t, u, v;
+                if (IntersectRayTriangle(origin, direction, triangle_v0_[i],
+                                         triangle_e1_[i], triangle_e2_[i], t,
+                                         u, v)) {
+                    count++;
+                }
+            });
+            counts[r] = count;
+        }
+    }
+    return counts;
+}
+
+RaycastingScene::ClosestPointResult RaycastingScene::ComputeClosestPoints(
+        const std::vector<Eigen::Vector3d> &query_points) const {
+    UpdateBVH();
+    const int num_points = int(query_points.size());
+    ClosestPointResult result;
+    result.points_.assign(num_points, Eigen::Vector3d::Constant(kInf));
+    result.geometry_ids_.assign(num_points, INVALID_ID);
+    result.triangle_ids_.assign(num_points, INVALID_ID);
+    result.triangle_uvs_.assign(num_points, Eigen::Vector2d::Zero());
+    result.triangle_normals_.assign(num_points, Eigen::Vector3d::Zero());
+    const std::vector<TriangleBVH::Node> &nodes = bvh_.GetNodes();
+    const std::vector<int> &triangle_indices = bvh_.GetTriangleIndices();
+    if (nodes.empty()) {
+        return result;
+    }
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<std::pair<int, double>> stack;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for (int q = 0; q < num_points; ++q) {
+            const Eigen::Vector3d &point = query_points[q];
+            double best_distance2 = kInf;
+            int best = -1;
+            Eigen::Vector2d best_uv;
+            stack.clear();
+            stack.push_back(std::make_pair(
+                    0, SquaredDistanceToBox(point, nodes[0].min_bound_,
+                                            nodes[0].max_bound_)));
+            while (!stack.empty()) {
+                const int n = stack.back().first;
+                const double distance2 = stack.back().second;
+                stack.pop_back();
+                if (distance2 >= best_distance2) {
+                    continue;
+                }
+                const TriangleBVH::Node &node = nodes[n];
+                if (node.IsLeaf()) {
+                    for (int i = node.begin_; i < node.end_; ++i) {
+                        Eigen::Vector2d uv = ClosestPointOnTriangle(
+                                point, triangle_v0_[i], triangle_e1_[i],
+                                triangle_e2_[i]);
+                        double d2 = (triangle_v0_[i] +
+                                     uv(0) * triangle_e1_[i] +
+                                     uv(1) * triangle_e2_[i] - point)
+                                            .squaredNorm();
+                        if (d2 < best_distance2) {
+                            best_distance2 = d2;
+                            best = i;
+                            best_uv = uv;
+                        }
+                    }
+                    continue;
+                }
+                int child0 = n + 1;
+                int child1 = node.second_child_;
+                double d0 = SquaredDistanceToBox(point,
+                                                 nodes[child0].min_bound_,
+                                                 nodes[child0].max_bound_);
+                double d1 = SquaredDistanceToBox(point,
+                                                 nodes[child1].min_bound_,
+                                                 nodes[child1].max_bound_);
+                if (d0 > d1) {
+                    std::swap(child0, child1);
+                    std::swap(d0, d1);
+                }
+                stack.push_back(std::make_pair(child1, d1));
+                stack.push_back(std::make_pair(child0, d0));
+            }
+
+            const int triangle_id = triangle_indices[best];
+            const int geometry_id =
+                    int(std::upper_bound(triangle_offsets_.begin(),
+                                         triangle_offsets_.end(),
+                                         triangle_id) -
+                        triangle_offsets_.begin()) -
+                    1;
+            result.points_[q] = triangle_v0_[best] +
+                                best_uv(0) * triangle_e1_[best] +
+                                best_uv(1) * triangle_e2_[best];
+            result.geometry_ids_[q] = geometry_id;
+            result.triangle_ids_[q] =
+                    triangle_id - triangle_offsets_[geometry_id];
+            result.triangle_uvs_[q] = best_uv;
+            result.triangle_normals_[q] =
+                    triangle_e1_[best].cross(triangle_e2_[best]).normalized();
+        }
+    }
+    return result;
+}
+
+std::vector<double> RaycastingScene::ComputeDistance(
+        const std::vector<Eigen::Vector3d> &query_points) const {
+    const std::vector<Eigen::Vector3d> closest_points =
+            ComputeClosestPoints(query_points).points_;
+    std::vector<double> distances(query_points.size());
+    for (size_t q = 0; q < query_points.size(); ++q) {
+        distances[q] = (closest_points[q] - query_points[q]).norm();
+    }
+    return distances;
+}
+
+std::vector<double> RaycastingScene::ComputeSignedDistance(
+        const std::vector<Eigen::Vector3d> &query_points) const {
+    std::vector<double> distances = ComputeDistance(query_points);
+    // A ray through an edge or vertex shared by several triangles counts
+    // each of them, which flips its parity. Such rays are rare, so a
+    // majority vote over three oblique directions is robust.
+    const Eigen::Vector3d kDirections[] = {{0.5547, 0.6078, 0.5681},
+                                           {-0.6429, 0.4932, 0.5860},
+                                           {0.4719, -0.5934, 0.6522}};
+    std::vector<int> num_odd(query_points.size(), 0);
+    for (const Eigen::Vector3d &direction : kDirections) {
+        const std::vector<Eigen::Vector3d> directions(query_points.size(),
+                                                      direction);
+        const std::vector<int> counts =
+                CountIntersections(query_points, directions);
+        for (size_t q = 0; q < query_points.size(); ++q) {
+            num_odd[q] += counts[q] % 2;
+        }
+    }
+    for (size_t q = 0; q < query_points.size(); ++q) {
+        if (num_odd[q] >= 2) {
+            distances[q] = -distances[q];
+        }
+    }
+    return distances;
+}
+
+void RaycastingScene::CreateRaysPinhole(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        std::vector<Eigen::Vector3d> &origins,
+        std::vector<Eigen::Vector3d> &directions) {
+    const int width = intrinsic.width_;
+    const int height = intrinsic.height_;
+    const auto focal_length = intrinsic.GetFocalLength();
+    const auto principal_point = intrinsic.GetPrincipalPoint();
+    const Eigen::Matrix4d camera_to_world = extrinsic.inverse();
+    const Eigen::Matrix3d rotation = camera_to_world.block<3, 3>(0, 0);
+    origins.assign(size_t(width) * height,
+                   camera_to_world.block<3, 1>(0, 3));
+    directions.resize(size_t(width) * height);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            directions[size_t(v) * width + u] =
+                    rotation *
+                    Eigen::Vector3d(
+                            (u - principal_point.first) / focal_length.first,
+                            (v - principal_point.second) / focal_length.second,
+                            1.0);
+        }
+    }
+}
+
+std::shared_ptr<Image> RaycastingScene::CreateDepthImage(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic) const {
+    std::vector<Eigen::Vector3d> origins;
+    std::vector<Eigen::Vector3d> directions;
+    CreateRaysPinhole(intrinsic, extrinsic, origins, directions);
+    const std::vector<double> t_hit = CastRays(origins, directions).t_hit_;
+
+    auto depth = std::make_shared<Image>();
+    depth->Prepare(intrinsic.width_, intrinsic.height_, 1, 4);
+    for (int v = 0; v < intrinsic.height_; ++v) {
+        for (int u = 0; u < intrinsic.width_; ++u) {
+            double t = t_hit[size_t(v) * intrinsic.width_ + u];
+            *depth->PointerAt<float>(u, v) = t < kInf ? float(t) : 0.0f;
+        }
+    }
+    return depth;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Open3D/Geometry/TriangleBVH.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraIntrinsic;
+}
+
+namespace geometry {
+
+class Image;
+
+/// \class RaycastingScene
+///
+/// \brief Scene of triangle meshes for ray casting and closest point queries
+/// on the CPU.
+///
+/// The triangles of all meshes added to the scene are kept in a single
+/// TriangleBVH, which is built over all triangles by the first query after
+/// meshes were added. All queries are batched and processed in parallel.
+class RaycastingScene {
+public:
+    /// Geometry and triangle id of rays that do not hit the scene.
+    static constexpr int INVALID_ID = -1;
+
+    /// \struct RaycastResult
+    ///
+    /// \brief Result of RaycastingScene::CastRays, one entry per ray.
+    struct RaycastResult {
+        /// Distance to the first hit in multiples of the ray direction, or
+        /// infinity if the ray does not hit the scene.
+        std::vector<double> t_hit_;
+        /// Id of the hit geometry, as returned by AddTriangles.
+        std::vector<int> geometry_ids_;
+        /// Index of the hit triangle in its geometry.
+        std::vector<int> triangle_ids_;
+        /// Barycentric coordinates (u, v) of the hit point, which is
+        /// (1 - u - v) * v0 + u * v1 + v * v2 for the triangle (v0, v1, v2).
+        std::vector<Eigen::Vector2d> triangle_uvs_;
+        /// Unit normal of the hit triangle, following its winding order.
+        std::vector<Eigen::Vector3d> triangle_normals_;
+    };
+
+    /// \struct ClosestPointResult
+    ///
+    /// \brief Result of RaycastingScene::ComputeClosestPoints, one entry per
+    /// query point.
+    struct ClosestPointResult {
+        /// Closest point on the surface of the scene.
+        std::vector<Eigen::Vector3d> points_;
+        /// Id of the geometry of the closest point.
+        std::vector<int> geometry_ids_;
+        /// Index of the triangle of the closest point in its geometry.
+        std::vector<int> triangle_ids_;
+        /// Barycentric coordinates (u, v) of the closest point.
+        std::vector<Eigen::Vector2d> triangle_uvs_;
+        /// Unit normal of the triangle of the closest point.
+        std::vector<Eigen::Vector3d> triangle_normals_;
+    };
+
+public:
+    /// \brief Default Constructor.
+    RaycastingScene();
+    ~RaycastingScene();
+    RaycastingScene(const RaycastingScene &) = delete;
+    RaycastingScene &operator=(const RaycastingScene &) = delete;
+
+public:
+    /// Adds the triangles of \p mesh to the scene and returns the id of the
+    /// new geometry. Ids are assigned consecutively starting from 0.
+    /// The BVH is rebuilt over all triangles by the next query, so add all
+    /// meshes before querying the scene.
+    int AddTriangles(const TriangleMesh &mesh);
+
+    /// Casts the rays origins[i] + t * directions[i], t > 0, and returns the
+    /// first hit of each ray. Directions need not be normalized.
+    RaycastResult CastRays(
+            const std::vector<Eigen::Vector3d> &origins,
+            const std::vector<Eigen::Vector3d> &directions) const;
+
+    /// Counts the triangles hit by each of the rays
+    /// origins[i] + t * directions[i], t > 0.
+    std::vector<int> CountIntersections(
+            const std::vector<Eigen::Vector3d> &origins,
+            const std::vector<Eigen::Vector3d> &directions) const;
+
+    /// Computes the closest point on the surface of the scene for each query
+    /// point.
+    ClosestPointResult ComputeClosestPoints(
+            const std::vector<Eigen::Vector3d> &query_points) const;
+
+    /// Computes the distance from each query point to the surface of the
+    /// scene.
+    std::vector<double> ComputeDistance(
+            const std::vector<Eigen::Vector3d> &query_points) const;
+
+    /// Computes the signed distance from each query point to the surface of
+    /// the scene, negative inside. A point is inside if a ray cast from it
+    /// crosses the surface an odd number of times, by majority over three
+    /// ray directions, which requires the meshes to be watertight.
+    std::vector<double> ComputeSignedDistance(
+            const std::vector<Eigen::Vector3d> &query_points) const;
+
+    /// Creates one ray per pixel of a pinhole camera, with directions scaled
+    /// such that the hit distance t is the depth along the optical axis.
+    ///
+    /// \param intrinsic Camera intrinsic parameters.
+    /// \param extrinsic World to camera transformation.
+    /// \param origins Ray origins, in row-major pixel order.
+    /// \param directions Ray directions, in row-major pixel order.
+    static void CreateRaysPinhole(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            std::vector<Eigen::Vector3d> &origins,
+            std::vector<Eigen::Vector3d> &directions);
+
+    /// Renders a float depth image of the scene as seen by a pinhole camera.
+    /// Pixels without a hit have depth 0.
+    ///
+    /// \param intrinsic Camera intrinsic parameters.
+    /// \param extrinsic World to camera transformation.
+    std::shared_ptr<Image> CreateDepthImage(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic =
+                    Eigen::Matrix4d::Identity()) const;
+
+    /// Returns the number of geometries added to the scene.
+    int GetNumGeometries() const { return int(triangle_offsets_.size()); }
+
+protected:
+    /// Rebuilds the BVH and the triangle data below if meshes were added
+    /// since the last build.
+    void UpdateBVH() const;
+
+protected:
+    /// Triangles of all geometries, the BVH is built over.
+    TriangleMesh mesh_;
+    mutable TriangleBVH bvh_;
+    mutable bool bvh_is_current_ = true;
+    mutable std::mutex bvh_mutex_;
+    /// First triangle of each geometry in mesh_.
+    std::vector<int> triangle_offsets_;
+    /// First vertex and edges (v1 - v0, v2 - v0) of each triangle, in the
+    /// order of TriangleBVH::GetTriangleIndices().
+    mutable std::vector<Eigen::Vector3d> triangle_v0_;
+    mutable std::vector<Eigen::Vector3d> triangle_e1_;
+    mutable std::vector<Eigen::Vector3d> triangle_e2_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
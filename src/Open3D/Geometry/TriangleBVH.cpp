@@ -0,0 +1,355 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleBVH.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+constexpr int kNumSAHBins = 16;
+
+double HalfSurfaceArea(const Eigen::Vector3d &min_bound,
+                       const Eigen::Vector3d &max_bound) {
+    Eigen::Vector3d extent = max_bound - min_bound;
+    return extent(0) * extent(1) + extent(1) * extent(2) +
+           extent(2) * extent(0);
+}
+
+bool BoundsOverlap(const Eigen::Vector3d &min0,
+                   const Eigen::Vector3d &max0,
+                   const Eigen::Vector3d &min1,
+                   const Eigen::Vector3d &max1) {
+    return (min0.array() <= max1.array()).all() &&
+           (min1.array() <= max0.array()).all();
+}
+
+}  // unnamed namespace
+
+TriangleBVH::TriangleBVH() {}
+
+TriangleBVH::TriangleBVH(const TriangleMesh &mesh,
+                         int max_triangles_per_leaf) {
+    SetMesh(mesh, max_triangles_per_leaf);
+}
+
+TriangleBVH::~TriangleBVH() {}
+
+bool TriangleBVH::SetMesh(const TriangleMesh &mesh,
+                          int max_triangles_per_leaf) {
+    if (max_triangles_per_leaf < 1) {
+        utility::LogError("[TriangleBVH] max_triangles_per_leaf < 1.");
+    }
+    nodes_.clear();
+    triangle_indices_.clear();
+    triangle_min_bounds_.clear();
+    triangle_max_bounds_.clear();
+    const int num_triangles = int(mesh.triangles_.size());
+    if (num_triangles == 0) {
+        return true;
+    }
+
+    std::vector<Eigen::Vector3d> min_bounds(num_triangles);
+    std::vector<Eigen::Vector3d> max_bounds(num_triangles);
+    std::vector<Eigen::Vector3d> centroids(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        const Eigen::Vector3i &triangle = mesh.triangles_[tidx];
+        const Eigen::Vector3d &v0 = mesh.vertices_[triangle(0)];
+        const Eigen::Vector3d &v1 = mesh.vertices_[triangle(1)];
+        const Eigen::Vector3d &v2 = mesh.vertices_[triangle(2)];
+        min_bounds[tidx] = v0.cwiseMin(v1).cwiseMin(v2);
+        max_bounds[tidx] = v0.cwiseMax(v1).cwiseMax(v2);
+        centroids[tidx] = (min_bounds[tidx] + max_bounds[tidx]) / 2.0;
+    }
+    triangle_indices_.resize(num_triangles);
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        triangle_indices_[tidx] = tidx;
+    }
+
+    // Nodes are created in depth-first order from a stack of pending triangle
+    // ranges, each with the index of the parent waiting for its second child.
+    struct PendingNode {
+        int parent_;
+        int begin_;
+        int end_;
+    };
+    std::vector<PendingNode> pending{{-1, 0, num_triangles}};
+    while (!pending.empty()) {
+        PendingNode range = pending.back();
+        pending.pop_back();
+        const int node_idx = int(nodes_.size());
+        if (range.parent_ >= 0) {
+            nodes_[range.parent_].second_child_ = node_idx;
+        }
+
+        Node node;
+        node.begin_ = range.begin_;
+        node.end_ = range.end_;
+        node.second_child_ = -1;
+        node.min_bound_ = min_bounds[triangle_indices_[range.begin_]];
+        node.max_bound_ = max_bounds[triangle_indices_[range.begin_]];
+        Eigen::Vector3d centroid_min =
+                centroids[triangle_indices_[range.begin_]];
+        Eigen::Vector3d centroid_max = centroid_min;
+        for (int i = range.begin_ + 1; i < range.end_; ++i) {
+            const int tidx = triangle_indices_[i];
+            node.min_bound_ = node.min_bound_.cwiseMin(min_bounds[tidx]);
+            node.max_bound_ = node.max_bound_.cwiseMax(max_bounds[tidx]);
+            centroid_min = centroid_min.cwiseMin(centroids[tidx]);
+            centroid_max = centroid_max.cwiseMax(centroids[tidx]);
+        }
+        nodes_.push_back(node);
+        if (range.end_ - range.begin_ <= max_triangles_per_leaf) {
+            continue;
+        }
+
+        // Bin the centroids along each axis and pick the bin boundary with
+        // the lowest SAH cost, area(left) * n(left) + area(right) * n(right).
+        const Eigen::Vector3d centroid_extent = centroid_max - centroid_min;
+        double best_cost = std::numeric_limits<double>::infinity();
+        int best_axis = -1;
+        int best_split = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (centroid_extent(axis) <= 0.0) {
+                continue;
+            }
+            const double scale = kNumSAHBins / centroid_extent(axis);
+            int bin_counts[kNumSAHBins] = {0};
+            Eigen::Vector3d bin_min[kNumSAHBins];
+            Eigen::Vector3d bin_max[kNumSAHBins];
+            for (int b = 0; b < kNumSAHBins; ++b) {
+                bin_min[b].setConstant(std::numeric_limits<double>::max());
+                bin_max[b].setConstant(std::numeric_limits<double>::lowest());
+            }
+            for (int i = range.begin_; i < range.end_; ++i) {
+                const int tidx = triangle_indices_[i];
+                int b = std::min(
+                        int((centroids[tidx](axis) - centroid_min(axis)) *
+                            scale),
+                        kNumSAHBins - 1);
+                bin_counts[b]++;
+                bin_min[b] = bin_min[b].cwiseMin(min_bounds[tidx]);
+                bin_max[b] = bin_max[b].cwiseMax(max_bounds[tidx]);
+            }
+            // Sweep from the right to get the cost of each right side, then
+            // from the left to combine it with the left side.
+            double right_costs[kNumSAHBins];
+            Eigen::Vector3d acc_min = bin_min[kNumSAHBins - 1];
+            Eigen::Vector3d acc_max = bin_max[kNumSAHBins - 1];
+            int acc_count = 0;
+            for (int b = kNumSAHBins - 1; b > 0; --b) {
+                acc_count += bin_counts[b];
+                acc_min = acc_min.cwiseMin(bin_min[b]);
+                acc_max = acc_max.cwiseMax(bin_max[b]);
+                right_costs[b] = HalfSurfaceArea(acc_min, acc_max) * acc_count;
+            }
+            acc_min = bin_min[0];
+            acc_max = bin_max[0];
+            acc_count = 0;
+            for (int b = 1; b < kNumSAHBins; ++b) {
+                acc_count += bin_counts[b - 1];
+                acc_min = acc_min.cwiseMin(bin_min[b - 1]);
+                acc_max = acc_max.cwiseMax(bin_max[b - 1]);
+                if (acc_count == 0 || acc_count == range.end_ - range.begin_) {
+                    continue;
+                }
+                double cost = HalfSurfaceArea(acc_min, acc_max) * acc_count +
+                              right_costs[b];
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_split = b;
+                }
+            }
+        }
+
+        int mid;
+        if (best_axis < 0) {
+            // All centroids coincide, split the range in half.
+            mid = (range.begin_ + range.end_) / 2;
+        } else {
+            const double scale = kNumSAHBins / centroid_extent(best_axis);
+            mid = int(std::partition(
+                              triangle_indices_.begin() + range.begin_,
+                              triangle_indices_.begin() + range.end_,
+                              [&](int tidx) {
+                                  int b = std::min(
+                                          int((centroids[tidx](best_axis) -
+                                               centroid_min(best_axis)) *
+                                              scale),
+                                          kNumSAHBins - 1);
+                                  return b < best_split;
+                              }) -
+                      triangle_indices_.begin());
+        }
+        // The first child is popped next and directly follows its parent.
+        pending.push_back({node_idx, mid, range.end_});
+        pending.push_back({-1, range.begin_, mid});
+    }
+
+    triangle_min_bounds_.resize(num_triangles);
+    triangle_max_bounds_.resize(num_triangles);
+    for (int i = 0; i < num_triangles; ++i) {
+        triangle_min_bounds_[i] = min_bounds[triangle_indices_[i]];
+        triangle_max_bounds_[i] = max_bounds[triangle_indices_[i]];
+    }
+    return true;
+}
+
+std::vector<Eigen::Vector2i> TriangleBVH::FindTrianglePairs(
+        const TriangleBVH &other,
+        const std::function<bool(int, int)> &predicate,
+        bool stop_at_first) const {
+    std::vector<Eigen::Vector2i> pairs;
+    if (nodes_.empty() || other.nodes_.empty()) {
+        return pairs;
+    }
+    const bool is_self = &other == this;
+    std::atomic<bool> found(false);
+
+    auto test_triangles = [&](int i, int j,
+                              std::vector<Eigen::Vector2i> &found_pairs) {
+        if (!BoundsOverlap(triangle_min_bounds_[i], triangle_max_bounds_[i],
+                           other.triangle_min_bounds_[j],
+                           other.triangle_max_bounds_[j])) {
+            return;
+        }
+        int tidx0 = triangle_indices_[i];
+        int tidx1 = other.triangle_indices_[j];
+        if (is_self && tidx0 > tidx1) {
+            std::swap(tidx0, tidx1);
+        }
+        if (predicate(tidx0, tidx1)) {
+            found_pairs.push_back(Eigen::Vector2i(tidx0, tidx1));
+            if (stop_at_first) {
+                found = true;
+            }
+        }
+    };
+
+    // Visits the node pair (n0, n1), n0 of this and n1 of other, testing the
+    // triangles of leaf pairs and pushing the child pairs to visit otherwise.
+    // For self tests only pairs with n0 <= n1 are visited.
+    auto visit = [&](const Eigen::Vector2i &node_pair,
+                     std::vector<Eigen::Vector2i> &next,
+                     std::vector<Eigen::Vector2i> &found_pairs) {
+        const int n0 = node_pair(0);
+        const int n1 = node_pair(1);
+        const Node &node0 = nodes_[n0];
+        const Node &node1 = other.nodes_[n1];
+        if (is_self && n0 == n1) {
+            if (node0.IsLeaf()) {
+                for (int i = node0.begin_; i < node0.end_; ++i) {
+                    for (int j = i + 1; j < node0.end_; ++j) {
+                        test_triangles(i, j, found_pairs);
+                    }
+                }
+            } else {
+                next.push_back(Eigen::Vector2i(n0 + 1, n0 + 1));
+                next.push_back(Eigen::Vector2i(n0 + 1, node0.second_child_));
+                next.push_back(Eigen::Vector2i(node0.second_child_,
+                                               node0.second_child_));
+            }
+            return;
+        }
+        if (!BoundsOverlap(node0.min_bound_, node0.max_bound_,
+                           node1.min_bound_, node1.max_bound_)) {
+            return;
+        }
+        if (node0.IsLeaf() && node1.IsLeaf()) {
+            for (int i = node0.begin_; i < node0.end_; ++i) {
+                for (int j = node1.begin_; j < node1.end_; ++j) {
+                    test_triangles(i, j, found_pairs);
+                }
+            }
+        } else if (node1.IsLeaf() ||
+                   (!node0.IsLeaf() &&
+                    HalfSurfaceArea(node0.min_bound_, node0.max_bound_) >=
+                            HalfSurfaceArea(node1.min_bound_,
+                                            node1.max_bound_))) {
+            // Descend into the larger node.
+            next.push_back(Eigen::Vector2i(n0 + 1, n1));
+            next.push_back(Eigen::Vector2i(node0.second_child_, n1));
+        } else {
+            next.push_back(Eigen::Vector2i(n0, n1 + 1));
+            next.push_back(Eigen::Vector2i(n0, node1.second_child_));
+        }
+    };
+
+    // Expand the root pair breadth-first into enough independent node pairs
+    // to balance the parallel traversal.
+#ifdef _OPENMP
+    const size_t num_tasks = 64 * size_t(omp_get_max_threads());
+#else
+    const size_t num_tasks = 1;
+#endif
+    std::vector<Eigen::Vector2i> tasks(1, Eigen::Vector2i(0, 0));
+    while (!tasks.empty() && tasks.size() < num_tasks && !found) {
+        std::vector<Eigen::Vector2i> next;
+        for (const Eigen::Vector2i &node_pair : tasks) {
+            visit(node_pair, next, pairs);
+        }
+        tasks.swap(next);
+    }
+
+    std::vector<std::vector<Eigen::Vector2i>> task_pairs(tasks.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int t = 0; t < int(tasks.size()); ++t) {
+        std::vector<Eigen::Vector2i> stack(1, tasks[t]);
+        while (!stack.empty() && !found) {
+            Eigen::Vector2i node_pair = stack.back();
+            stack.pop_back();
+            visit(node_pair, stack, task_pairs[t]);
+        }
+    }
+    for (const std::vector<Eigen::Vector2i> &p : task_pairs) {
+        pairs.insert(pairs.end(), p.begin(), p.end());
+    }
+    if (stop_at_first && pairs.size() > 1) {
+        pairs.resize(1);
+    }
+    return pairs;
+}
+
+}  // namespace geometry
+}  // namespace open3d
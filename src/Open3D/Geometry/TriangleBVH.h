@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <functional>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleBVH
+///
+/// \brief Bounding volume hierarchy over the triangles of a TriangleMesh.
+///
+/// The hierarchy is built top-down with the binned surface area heuristic
+/// (SAH) and stored as a flat array of nodes in depth-first order, the first
+/// child of an inner node directly following its parent. The BVH keeps no
+/// reference to the mesh it was built from.
+class TriangleBVH {
+public:
+    /// \struct Node
+    ///
+    /// \brief Axis-aligned bounding box of a contiguous range of triangles.
+    struct Node {
+        /// Returns true if the node has no children.
+        bool IsLeaf() const { return second_child_ < 0; }
+
+        Eigen::Vector3d min_bound_;
+        Eigen::Vector3d max_bound_;
+        /// Range [begin_, end_) of GetTriangleIndices() below the node.
+        int begin_;
+        int end_;
+        /// Index of the second child, or -1 for leaves.
+        int second_child_;
+    };
+
+public:
+    /// \brief Default Constructor.
+    TriangleBVH();
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh Provides the triangles from which the BVH is constructed.
+    /// \param max_triangles_per_leaf Nodes with at most this many triangles
+    /// are not split further.
+    TriangleBVH(const TriangleMesh &mesh, int max_triangles_per_leaf = 4);
+    ~TriangleBVH();
+    TriangleBVH(const TriangleBVH &) = delete;
+    TriangleBVH &operator=(const TriangleBVH &) = delete;
+
+public:
+    /// Builds the BVH over the triangles of \p mesh.
+    ///
+    /// \param mesh Triangle mesh for BVH construction.
+    /// \param max_triangles_per_leaf Nodes with at most this many triangles
+    /// are not split further.
+    bool SetMesh(const TriangleMesh &mesh, int max_triangles_per_leaf = 4);
+
+    /// Finds the pairs of triangles, one from this BVH and one from \p other,
+    /// whose bounding boxes overlap and for which \p predicate returns true.
+    /// Node pairs are traversed in parallel. If \p other is this BVH, each
+    /// unordered pair of distinct triangles is visited once and returned as
+    /// (i, j) with i < j.
+    ///
+    /// \param other BVH to test against, may be this BVH.
+    /// \param predicate Called with a triangle index of this BVH and a
+    /// triangle index of \p other. Must be safe to call concurrently.
+    /// \param stop_at_first If true, returns at most one pair.
+    /// \return The pairs of triangle indices, in no particular order.
+    std::vector<Eigen::Vector2i> FindTrianglePairs(
+            const TriangleBVH &other,
+            const std::function<bool(int, int)> &predicate,
+            bool stop_at_first = false) const;
+
+    /// Returns the nodes in depth-first order, the root being the first.
+    const std::vector<Node> &GetNodes() const { return nodes_; }
+    /// Returns the mesh triangle indices, ordered such that the triangles
+    /// below each node are contiguous.
+    const std::vector<int> &GetTriangleIndices() const {
+        return triangle_indices_;
+    }
+
+protected:
+    std::vector<Node> nodes_;
+    std::vector<int> triangle_indices_;
+    /// Triangle bounding boxes, in the order of triangle_indices_.
+    std::vector<Eigen::Vector3d> triangle_min_bounds_;
+    std::vector<Eigen::Vector3d> triangle_max_bounds_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
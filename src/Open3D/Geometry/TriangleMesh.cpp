@@ -30,8 +30,10 @@
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/Qhull.h"
+#include "Open3D/Geometry/TriangleBVH.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <numeric>
 #include <queue>
 #include <random>
@@ -1315,40 +1317,54 @@ bool TriangleMesh::IsVertexManifold() const {
     return GetNonManifoldVertices().empty();
 }
 
+/// Returns true if the triangles tidx0 and tidx1 of \p mesh intersect and do
+/// not share a vertex.
+static bool IsSelfIntersectingTrianglePair(const TriangleMesh &mesh,
+                                           int tidx0,
+                                           int tidx1) {
+    const Eigen::Vector3i &tria_p = mesh.triangles_[tidx0];
+    const Eigen::Vector3i &tria_q = mesh.triangles_[tidx1];
+    // check if neighbour triangle
+    if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
+        tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
+        tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
+        tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
+        tria_p(2) == tria_q(2)) {
+        return false;
+    }
+
+    // check for intersection
+    const std::vector<Eigen::Vector3d> &vertices = mesh.vertices_;
+    return IntersectionTest::TriangleTriangle3d(
+            vertices[tria_p(0)], vertices[tria_p(1)], vertices[tria_p(2)],
+            vertices[tria_q(0)], vertices[tria_q(1)], vertices[tria_q(2)]);
+}
+
 std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
         const {
-    std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
-
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
-            }
-        }
-    }
+    TriangleBVH bvh(*this);
+    std::vector<Eigen::Vector2i> self_intersecting_triangles =
+            bvh.FindTrianglePairs(bvh, [&](int tidx0, int tidx1) {
+                return IsSelfIntersectingTrianglePair(*this, tidx0, tidx1);
+            });
+    std::sort(self_intersecting_triangles.begin(),
+              self_intersecting_triangles.end(),
+              [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                  return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+              });
     return self_intersecting_triangles;
 }
 
 bool TriangleMesh::IsSelfIntersecting() const {
-    return !GetSelfIntersectingTriangles().empty();
+    TriangleBVH bvh(*this);
+    return !bvh.FindTrianglePairs(
+                       bvh,
+                       [&](int tidx0, int tidx1) {
+                           return IsSelfIntersectingTrianglePair(*this, tidx0,
+                                                                 tidx1);
+                       },
+                       true)
+                       .empty();
 }
 
 bool TriangleMesh::IsBoundingBoxIntersecting(const TriangleMesh &other) const {
@@ -1360,22 +1376,23 @@ bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
     if (!IsBoundingBoxIntersecting(other)) {
         return false;
     }
-    for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = 0; tidx1 < other.triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
-            const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                return true;
-            }
-        }
-    }
-    return false;
+    TriangleBVH bvh(*this);
+    TriangleBVH other_bvh(other);
+    return !bvh.FindTrianglePairs(
+                       other_bvh,
+                       [&](int tidx0, int tidx1) {
+                           const Eigen::Vector3i &tria_p = triangles_[tidx0];
+                           const Eigen::Vector3i &tria_q =
+                                   other.triangles_[tidx1];
+                           return IntersectionTest::TriangleTriangle3d(
+                                   vertices_[tria_p(0)], vertices_[tria_p(1)],
+                                   vertices_[tria_p(2)],
+                                   other.vertices_[tria_q(0)],
+                                   other.vertices_[tria_q(1)],
+                                   other.vertices_[tria_q(2)]);
+                       },
+                       true)
+                       .empty();
 }
 
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
@@ -254,11 +254,12 @@ public:
     bool IsVertexManifold() const;
 
     /// Function that returns a list of triangles that are intersecting the
-    /// mesh.
+    /// mesh. Each pair (i, j) has i < j and the list is sorted.
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
     /// Function that tests if the triangle mesh is self-intersecting.
-    /// Tests each triangle pair for intersection.
+    /// Tests the triangle pairs with overlapping bounding boxes, found with a
+    /// TriangleBVH, for intersection.
     bool IsSelfIntersecting() const;
 
     /// Function that tests if the bounding boxes of the triangle meshes are
@@ -266,7 +267,8 @@ public:
     bool IsBoundingBoxIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the triangle mesh intersects another triangle
-    /// mesh. Tests each triangle against each other triangle.
+    /// mesh. Tests the triangle pairs with overlapping bounding boxes, found
+    /// with a TriangleBVH of each mesh, for intersection.
     bool IsIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the given triangle mesh is orientable, i.e.
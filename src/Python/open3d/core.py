@@ -15,6 +15,14 @@ def _numpy_dtype_to_dtype(numpy_dtype):
         return o3d.Dtype.UInt8
     elif numpy_dtype == np.bool:
         return o3d.Dtype.Bool
+    elif numpy_dtype == np.float16:
+        return o3d.Dtype.Float16
+    elif numpy_dtype == np.int8:
+        return o3d.Dtype.Int8
+    elif numpy_dtype == np.int16:
+        return o3d.Dtype.Int16
+    elif numpy_dtype == np.uint16:
+        return o3d.Dtype.UInt16
     else:
         raise ValueError("Unsupported numpy dtype:", numpy_dtype)
 
@@ -209,6 +217,10 @@ class Tensor(o3d.pybind.Tensor):
         and the returned NumPy array shares the same memory as this tensor.
         Changes to the NumPy array will be reflected in the original tensor and
         vice versa.
+
+        CPU tensors also support the Python buffer protocol and
+        ``__array_interface__``, so ``np.asarray(tensor)`` and
+        ``memoryview(tensor)`` do not copy either.
         """
         return super(Tensor, self).numpy()
 
@@ -218,7 +230,8 @@ class Tensor(o3d.pybind.Tensor):
         """
         Returns a Tensor from NumPy array. The resulting tensor is a CPU tensor
         that shares the same memory as the NumPy array. Changes to the tensor
-        will be reflected in the original NumPy array and vice versa.
+        will be reflected in the original NumPy array and vice versa. The
+        NumPy array is kept alive for as long as the tensor uses its memory.
 
         Args:
             np_array: The Numpy array to be converted from.
@@ -309,6 +322,99 @@ class Tensor(o3d.pybind.Tensor):
         """
         return super(Tensor, self).abs_()
 
+    @cast_to_py_tensor
+    def floor(self):
+        """
+        Returns element-wise floor of a tensor.
+        """
+        return super(Tensor, self).floor()
+
+    @cast_to_py_tensor
+    def floor_(self):
+        """
+        Inplace version of Tensor.floor.
+        """
+        return super(Tensor, self).floor_()
+
+    @cast_to_py_tensor
+    def log(self):
+        """
+        Returns element-wise natural logarithm of a tensor.
+        """
+        return super(Tensor, self).log()
+
+    @cast_to_py_tensor
+    def log_(self):
+        """
+        Inplace version of Tensor.log.
+        """
+        return super(Tensor, self).log_()
+
+    @cast_to_py_tensor
+    def maximum(self, value):
+        """
+        Returns element-wise maximum of the tensor and value.
+        """
+        return super(Tensor, self).maximum(value)
+
+    @cast_to_py_tensor
+    def maximum_(self, value):
+        """
+        Inplace version of Tensor.maximum.
+        """
+        return super(Tensor, self).maximum_(value)
+
+    @cast_to_py_tensor
+    def minimum(self, value):
+        """
+        Returns element-wise minimum of the tensor and value.
+        """
+        return super(Tensor, self).minimum(value)
+
+    @cast_to_py_tensor
+    def minimum_(self, value):
+        """
+        Inplace version of Tensor.minimum.
+        """
+        return super(Tensor, self).minimum_(value)
+
+    @cast_to_py_tensor
+    def pow(self, value):
+        """
+        Returns element-wise power of the tensor to the exponents value.
+        """
+        return super(Tensor, self).pow(value)
+
+    @cast_to_py_tensor
+    def pow_(self, value):
+        """
+        Inplace version of Tensor.pow.
+        """
+        return super(Tensor, self).pow_(value)
+
+    @cast_to_py_tensor
+    def clamp(self, min_val, max_val):
+        """
+        Returns element-wise clamp of the tensor to [min_val, max_val].
+        """
+        return super(Tensor, self).clamp(min_val, max_val)
+
+    @cast_to_py_tensor
+    def clamp_(self, min_val, max_val):
+        """
+        Inplace version of Tensor.clamp.
+        """
+        return super(Tensor, self).clamp_(min_val, max_val)
+
+    @staticmethod
+    @cast_to_py_tensor
+    def where(condition, x, y):
+        """
+        Selects elements from x where the boolean condition is True and from y
+        elsewhere, like np.where(condition, x, y).
+        """
+        return super(Tensor, Tensor).where(condition, x, y)
+
     @cast_to_py_tensor
     def logical_and(self, value):
         """
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Core/EigenConverter.h"
+
+#include <vector>
+
+#include "UnitTest/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(EigenConverter, FromEigenVectorArray) {
+    std::vector<Eigen::Vector3d> points{{0, 1, 2}, {3, 4, 5}};
+    Tensor t = eigen_converter::FromEigenVectorArray(points);
+    EXPECT_EQ(t.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(t.GetDtype(), Dtype::Float64);
+    EXPECT_EQ(t.GetDataPtr(), static_cast<void*>(points.data()));
+    EXPECT_EQ(t.ToFlatVector<double>(),
+              std::vector<double>({0, 1, 2, 3, 4, 5}));
+
+    // Writes are visible on both sides.
+    t[1][2] = 10.0;
+    EXPECT_EQ(points[1](2), 10);
+    points[0](0) = -1;
+    EXPECT_EQ(t[0][0].Item<double>(), -1);
+
+    // Destroying the tensor must not free the vector's buffer.
+    t = Tensor();
+    EXPECT_EQ(points[1], Eigen::Vector3d(3, 4, 10));
+
+    // Moved-in vectors are owned by the tensor and its views.
+    std::vector<Eigen::Vector3i> indices{{0, 1, 2}, {3, 4, 5}};
+    const void* buffer = indices.data();
+    Tensor row;
+    {
+        Tensor owner =
+                eigen_converter::FromEigenVectorArray(std::move(indices));
+        EXPECT_EQ(owner.GetDtype(), Dtype::Int32);
+        EXPECT_EQ(owner.GetDataPtr(), buffer);
+        row = owner[1];
+    }
+    EXPECT_EQ(row.ToFlatVector<int32_t>(), std::vector<int32_t>({3, 4, 5}));
+
+    std::vector<Eigen::Vector3d> empty;
+    EXPECT_EQ(eigen_converter::FromEigenVectorArray(empty).GetShape(),
+              SizeVector({0, 3}));
+}
+
+TEST(EigenConverter, AsEigenMap) {
+    Tensor t = Tensor::Ones({4, 3}, Dtype::Float64, Device("CPU:0"));
+    eigen_converter::EigenMatrixMap<double> map =
+            eigen_converter::AsEigenMap<double>(t);
+    EXPECT_EQ(map.rows(), 4);
+    EXPECT_EQ(map.cols(), 3);
+    map.row(2) = Eigen::Vector3d(1, 2, 3).transpose();
+    EXPECT_EQ(t[2].ToFlatVector<double>(), std::vector<double>({1, 2, 3}));
+    EXPECT_EQ(eigen_converter::AsEigenMap<double>(t).colwise().sum(),
+              Eigen::RowVector3d(4, 5, 6));
+
+    // Round trip through the legacy representation without copies.
+    std::vector<Eigen::Vector3d> points(5, Eigen::Vector3d(1, 2, 3));
+    const Tensor alias = eigen_converter::FromEigenVectorArray(points);
+    EXPECT_EQ(eigen_converter::AsEigenMap<double>(alias).data(),
+              points[0].data());
+    EXPECT_EQ(eigen_converter::AsEigenMap<double>(alias).row(4),
+              Eigen::RowVector3d(1, 2, 3));
+
+    EXPECT_THROW(eigen_converter::AsEigenMap<float>(t), std::runtime_error);
+    EXPECT_THROW(eigen_converter::AsEigenMap<double>(t.T()),
+                 std::runtime_error);
+    EXPECT_THROW(eigen_converter::AsEigenMap<double>(t.Reshape({12})),
+                 std::runtime_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
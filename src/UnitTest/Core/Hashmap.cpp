@@ -0,0 +1,270 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Hashmap.h"
+
+#include <numeric>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "Core/CoreTest.h"
+#include "UnitTest/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class HashmapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Hashmap,
+                         HashmapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(HashmapPermuteDevices, InsertFindErase) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        EXPECT_THROW(Hashmap(10, Dtype::Int32, {3}, Dtype::Float32, {1},
+                             device),
+                     std::runtime_error);
+        return;
+    }
+
+    Hashmap hashmap(10, Dtype::Int32, {3}, Dtype::Float32, {1}, device);
+    EXPECT_EQ(hashmap.Size(), 0);
+    EXPECT_EQ(hashmap.GetCapacity(), 10);
+
+    // The last key duplicates the first one.
+    Tensor keys(std::vector<int32_t>({0, 0, 0, 1, 2, 3, -1, 0, 5, 0, 0, 0}),
+                {4, 3}, Dtype::Int32, device);
+    Tensor values(std::vector<float>({10, 11, 12, 13}), {4, 1}, Dtype::Float32,
+                  device);
+    Tensor addrs, masks;
+    std::tie(addrs, masks) = hashmap.Insert(keys, values);
+    EXPECT_EQ(masks.ToFlatVector<bool>(),
+              std::vector<bool>({true, true, true, false}));
+    std::vector<int64_t> addrs_vec = addrs.ToFlatVector<int64_t>();
+    EXPECT_EQ(addrs_vec[0], addrs_vec[3]);
+    EXPECT_EQ(std::set<int64_t>(addrs_vec.begin(), addrs_vec.end()).size(),
+              3u);
+    EXPECT_EQ(hashmap.Size(), 3);
+
+    // Existing keys keep their values.
+    std::tie(addrs, masks) = hashmap.Insert(
+            keys.Slice(0, 1, 2),
+            Tensor(std::vector<float>({100}), {1, 1}, Dtype::Float32, device));
+    EXPECT_EQ(masks.ToFlatVector<bool>(), std::vector<bool>({false}));
+    EXPECT_EQ(addrs.ToFlatVector<int64_t>()[0], addrs_vec[1]);
+
+    Tensor queries(std::vector<int32_t>({-1, 0, 5, 7, 7, 7, 1, 2, 3}), {3, 3},
+                   Dtype::Int32, device);
+    std::tie(addrs, masks) = hashmap.Find(queries);
+    EXPECT_EQ(masks.ToFlatVector<bool>(),
+              std::vector<bool>({true, false, true}));
+    std::vector<int64_t> found = addrs.ToFlatVector<int64_t>();
+    EXPECT_EQ(found[0], addrs_vec[2]);
+    EXPECT_EQ(found[2], addrs_vec[1]);
+    std::vector<float> arena = hashmap.GetValueTensor().ToFlatVector<float>();
+    EXPECT_EQ(arena[found[0]], 12);
+    EXPECT_EQ(arena[found[2]], 11);
+
+    EXPECT_EQ(hashmap.GetActiveIndices().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2}));
+
+    // Erase, including a missing key.
+    masks = hashmap.Erase(queries);
+    EXPECT_EQ(masks.ToFlatVector<bool>(),
+              std::vector<bool>({true, false, true}));
+    EXPECT_EQ(hashmap.Size(), 1);
+    std::tie(addrs, masks) = hashmap.Find(queries);
+    EXPECT_EQ(masks.ToFlatVector<bool>(),
+              std::vector<bool>({false, false, false}));
+    EXPECT_EQ(hashmap.GetActiveIndices().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({addrs_vec[0]}));
+
+    // Erased addresses are reused.
+    std::tie(addrs, masks) = hashmap.Activate(queries);
+    EXPECT_EQ(masks.ToFlatVector<bool>(),
+              std::vector<bool>({true, true, true}));
+    EXPECT_EQ(hashmap.Size(), 4);
+    EXPECT_EQ(hashmap.GetCapacity(), 10);
+    EXPECT_EQ(hashmap.GetActiveIndices().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2, 3}));
+    arena = hashmap.GetValueTensor().ToFlatVector<float>();
+    for (int64_t addr : addrs.ToFlatVector<int64_t>()) {
+        EXPECT_EQ(arena[addr], 0);
+    }
+}
+
+TEST_P(HashmapPermuteDevices, LargeBatchesAndRehash) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        return;
+    }
+
+    // Enough keys for the parallel path, with every key repeated twice, and
+    // starting from a capacity which requires several rehashes.
+    int64_t n = 100000;
+    std::vector<int64_t> key_vals(2 * n);
+    std::vector<int64_t> value_vals(2 * n);
+    for (int64_t i = 0; i < 2 * n; ++i) {
+        key_vals[i] = (i % n) * 7919 - n;
+        value_vals[i] = i % n;
+    }
+    Tensor keys(key_vals, {2 * n}, Dtype::Int64, device);
+    Tensor values(value_vals, {2 * n}, Dtype::Int64, device);
+
+    Hashmap hashmap(1, Dtype::Int64, {}, Dtype::Int64, {}, device);
+    Tensor addrs, masks;
+    std::tie(addrs, masks) = hashmap.Insert(keys, values);
+    EXPECT_EQ(hashmap.Size(), n);
+    EXPECT_GE(hashmap.GetCapacity(), n);
+    std::vector<bool> masks_vec = masks.ToFlatVector<bool>();
+    std::vector<int64_t> addrs_vec = addrs.ToFlatVector<int64_t>();
+    std::vector<int64_t> arena =
+            hashmap.GetValueTensor().ToFlatVector<int64_t>();
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_NE(masks_vec[i], masks_vec[i + n]);
+        EXPECT_EQ(addrs_vec[i], addrs_vec[i + n]);
+        EXPECT_EQ(arena[addrs_vec[i]], i);
+    }
+
+    // Erase every other key, then re-insert them. Erased slots trigger a
+    // rebuild of the table at the same capacity, which keeps the addresses.
+    Tensor even_keys = keys.Slice(0, 0, n, 2);
+    std::vector<int64_t> even_addrs =
+            hashmap.Find(even_keys).first.ToFlatVector<int64_t>();
+    Tensor odd_keys = keys.Slice(0, 1, n, 2);
+    EXPECT_EQ(hashmap.Erase(odd_keys).ToFlatVector<bool>(),
+              std::vector<bool>(n / 2, true));
+    EXPECT_EQ(hashmap.Size(), n / 2);
+    int64_t capacity = hashmap.GetCapacity();
+    for (int round = 0; round < 5; ++round) {
+        hashmap.Erase(odd_keys);
+        std::tie(addrs, masks) = hashmap.Activate(odd_keys);
+        EXPECT_EQ(masks.ToFlatVector<bool>(), std::vector<bool>(n / 2, true));
+        EXPECT_EQ(hashmap.GetCapacity(), capacity);
+    }
+    EXPECT_EQ(hashmap.Size(), n);
+    EXPECT_EQ(hashmap.Find(even_keys).first.ToFlatVector<int64_t>(),
+              even_addrs);
+
+    std::tie(addrs, masks) = hashmap.Find(keys.Slice(0, 0, n));
+    EXPECT_EQ(masks.ToFlatVector<bool>(), std::vector<bool>(n, true));
+    addrs_vec = addrs.ToFlatVector<int64_t>();
+    EXPECT_EQ(std::set<int64_t>(addrs_vec.begin(), addrs_vec.end()).size(),
+              static_cast<size_t>(n));
+    arena = hashmap.GetValueTensor().ToFlatVector<int64_t>();
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_EQ(arena[addrs_vec[i]], i % 2 == 0 ? i : 0);
+    }
+
+    // Explicit rehash keeps all entries.
+    hashmap.Rehash(4 * n);
+    EXPECT_EQ(hashmap.GetCapacity(), 4 * n);
+    std::tie(addrs, masks) = hashmap.Find(keys);
+    EXPECT_EQ(masks.ToFlatVector<bool>(), std::vector<bool>(2 * n, true));
+    EXPECT_EQ(hashmap.GetActiveIndices().GetShape(), SizeVector({n}));
+}
+
+TEST_P(HashmapPermuteDevices, GrowKeepsAddresses) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        return;
+    }
+
+    // Insertions grow the arena and reuse the addresses of erased entries.
+    Hashmap hashmap(1, Dtype::Int32, {}, Dtype::Int32, {}, device);
+    std::vector<int32_t> key_vals;
+    std::vector<int64_t> addrs_vec;
+    for (int32_t batch = 1; batch <= 64; batch *= 2) {
+        std::vector<int32_t> batch_vals(batch);
+        for (int32_t i = 0; i < batch; ++i) {
+            batch_vals[i] = batch + i;
+        }
+        Tensor batch_keys(batch_vals, {batch}, Dtype::Int32, device);
+        std::vector<int64_t> batch_addrs =
+                hashmap.Insert(batch_keys, batch_keys)
+                        .first.ToFlatVector<int64_t>();
+        hashmap.Erase(batch_keys.Slice(0, 0, batch, 2));
+        for (int32_t i = 1; i < batch; i += 2) {
+            key_vals.push_back(batch_vals[i]);
+            addrs_vec.push_back(batch_addrs[i]);
+        }
+    }
+
+    Tensor keys(key_vals, {static_cast<int64_t>(key_vals.size())},
+                Dtype::Int32, device);
+    Tensor addrs, masks;
+    std::tie(addrs, masks) = hashmap.Find(keys);
+    EXPECT_EQ(masks.ToFlatVector<bool>(),
+              std::vector<bool>(key_vals.size(), true));
+    EXPECT_EQ(addrs.ToFlatVector<int64_t>(), addrs_vec);
+    std::vector<int32_t> arena =
+            hashmap.GetValueTensor().ToFlatVector<int32_t>();
+    for (size_t i = 0; i < key_vals.size(); ++i) {
+        EXPECT_EQ(arena[addrs_vec[i]], key_vals[i]);
+    }
+
+    // An explicit Rehash compacts the arena.
+    hashmap.Rehash(hashmap.GetCapacity());
+    std::vector<int64_t> compact_addrs(key_vals.size());
+    std::iota(compact_addrs.begin(), compact_addrs.end(), 0);
+    EXPECT_EQ(hashmap.GetActiveIndices().ToFlatVector<int64_t>(),
+              compact_addrs);
+}
+
+TEST_P(HashmapPermuteDevices, Exceptions) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        return;
+    }
+
+    Hashmap hashmap(10, Dtype::Int32, {3}, Dtype::Float32, {}, device);
+    Tensor keys = Tensor::Zeros({2, 3}, Dtype::Int32, device);
+    Tensor values = Tensor::Zeros({2}, Dtype::Float32, device);
+    EXPECT_NO_THROW(hashmap.Insert(keys, values));
+
+    // Wrong key dtype and shapes.
+    EXPECT_THROW(hashmap.Find(Tensor::Zeros({2, 3}, Dtype::Int64, device)),
+                 std::runtime_error);
+    EXPECT_THROW(hashmap.Find(Tensor::Zeros({2, 2}, Dtype::Int32, device)),
+                 std::runtime_error);
+    EXPECT_THROW(hashmap.Erase(Tensor::Zeros({3}, Dtype::Int32, device)),
+                 std::runtime_error);
+
+    // Wrong value dtype and shapes.
+    EXPECT_THROW(hashmap.Insert(keys, Tensor::Zeros({2}, Dtype::Int32, device)),
+                 std::runtime_error);
+    EXPECT_THROW(
+            hashmap.Insert(keys, Tensor::Zeros({3}, Dtype::Float32, device)),
+            std::runtime_error);
+
+    EXPECT_THROW(hashmap.Rehash(0), std::runtime_error);
+    EXPECT_THROW(Hashmap(-1, Dtype::Int32, {3}, Dtype::Float32, {}, device),
+                 std::runtime_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
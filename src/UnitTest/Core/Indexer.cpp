@@ -184,5 +184,110 @@ TEST_P(IndexerPermuteDevices, GetPointers) {
     EXPECT_EQ(indexer.GetOutputPtr(5), output_base_ptr + 5 * dtype_byte_size);
 }
 
+TEST_P(IndexerPermuteDevices, IsContiguous) {
+    Device device = GetParam();
+
+    Tensor a({2, 1, 3}, Dtype::Float32, device);
+    Tensor b({1, 1, 3}, Dtype::Float32, device);
+    Tensor c({1}, Dtype::Float32, device);
+    Tensor d({2, 1, 3}, Dtype::Float32, device);
+    Indexer indexer({a, b, c}, d, DtypePolicy::ALL_SAME);
+    EXPECT_TRUE(indexer.IsInputContiguous(0));
+    EXPECT_FALSE(indexer.IsInputContiguous(1));
+    EXPECT_FALSE(indexer.IsInputContiguous(2));
+    EXPECT_FALSE(indexer.IsInputScalar(0));
+    EXPECT_FALSE(indexer.IsInputScalar(1));
+    EXPECT_TRUE(indexer.IsInputScalar(2));
+    EXPECT_TRUE(indexer.IsOutputContiguous());
+
+    // Transposed input is not contiguous in the iteration order.
+    Tensor e({3, 2}, Dtype::Float32, device);
+    Tensor f({2, 3}, Dtype::Float32, device);
+    Indexer indexer_t({e.T()}, f, DtypePolicy::ALL_SAME);
+    EXPECT_FALSE(indexer_t.IsInputContiguous(0));
+    EXPECT_TRUE(indexer_t.IsOutputContiguous());
+}
+
+TEST_P(IndexerPermuteDevices, GetCoalescedIndexer) {
+    Device device = GetParam();
+
+    // Contiguous operands coalesce to a single dimension.
+    Tensor a({2, 3, 4}, Dtype::Float32, device);
+    Tensor b({2, 3, 4}, Dtype::Float32, device);
+    Indexer contiguous = Indexer({a}, b).GetCoalescedIndexer();
+    EXPECT_EQ(contiguous.NumDims(), 1);
+    EXPECT_EQ(contiguous.GetMasterShape()[0], 24);
+    EXPECT_EQ(contiguous.GetInput(0).byte_strides_[0], 4);
+
+    // Broadcasted rows keep the row dimension.
+    Tensor row({4}, Dtype::Float32, device);
+    Indexer broadcast = Indexer({a, row}, b).GetCoalescedIndexer();
+    EXPECT_EQ(broadcast.NumDims(), 2);
+    EXPECT_EQ(SizeVector(broadcast.GetMasterShape(),
+                         broadcast.GetMasterShape() + 2),
+              SizeVector({6, 4}));
+    EXPECT_EQ(SizeVector(broadcast.GetInput(1).byte_strides_,
+                         broadcast.GetInput(1).byte_strides_ + 2),
+              SizeVector({0, 4}));
+    EXPECT_EQ(SizeVector(broadcast.GetInput(1).shape_,
+                         broadcast.GetInput(1).shape_ + 2),
+              SizeVector({1, 4}));
+
+    // Size-1 dimensions are dropped, 0-dim tensors have one dimension.
+    Tensor c({1, 5, 1}, Dtype::Float32, device);
+    Tensor d({1, 5, 1}, Dtype::Float32, device);
+    EXPECT_EQ(Indexer({c}, d).GetCoalescedIndexer().NumDims(), 1);
+    Tensor e({}, Dtype::Float32, device);
+    Indexer scalar = Indexer({e}, e).GetCoalescedIndexer();
+    EXPECT_EQ(scalar.NumDims(), 1);
+    EXPECT_EQ(scalar.NumWorkloads(), 1);
+
+    // The pointers of every workload are unchanged.
+    Tensor f({3, 4, 5}, Dtype::Float32, device);
+    Tensor g = f.Permute({0, 2, 1}).Slice(0, 0, 3, 2);
+    Tensor h({2, 5, 4}, Dtype::Float32, device);
+    Indexer indexer({g, row}, h);
+    Indexer coalesced = indexer.GetCoalescedIndexer();
+    EXPECT_EQ(coalesced.NumWorkloads(), indexer.NumWorkloads());
+    for (int64_t i = 0; i < indexer.NumWorkloads(); ++i) {
+        EXPECT_EQ(coalesced.GetInputPtr(0, i), indexer.GetInputPtr(0, i));
+        EXPECT_EQ(coalesced.GetInputPtr(1, i), indexer.GetInputPtr(1, i));
+        EXPECT_EQ(coalesced.GetOutputPtr(i), indexer.GetOutputPtr(i));
+    }
+}
+
+TEST_P(IndexerPermuteDevices, StaticIndexer) {
+    Device device = GetParam();
+
+    Tensor src({3, 4, 5}, Dtype::Float32, device);
+    Tensor lhs = src.Permute({2, 0, 1}).Slice(0, 0, 5, 2);
+    Tensor rhs({4}, Dtype::Float32, device);
+    Tensor dst({3, 3, 4}, Dtype::Float32, device);
+    Indexer indexer({lhs, rhs}, dst);
+    Indexer coalesced = indexer.GetCoalescedIndexer();
+    ASSERT_EQ(coalesced.NumDims(), 3);
+
+    StaticIndexer<3, 2> static_indexer(coalesced);
+    int64_t num_workloads = indexer.NumWorkloads();
+    for (int64_t begin : {0, 1, 4, 7, 35}) {
+        for (int64_t end : {begin, begin + 1, begin + 6, num_workloads}) {
+            int64_t workload_idx = begin;
+            static_indexer.ForEach(
+                    begin, end, [&](char* const* input_ptrs, char* output_ptr) {
+                        EXPECT_EQ(input_ptrs[0],
+                                  indexer.GetInputPtr(0, workload_idx));
+                        EXPECT_EQ(input_ptrs[1],
+                                  indexer.GetInputPtr(1, workload_idx));
+                        EXPECT_EQ(output_ptr,
+                                  indexer.GetOutputPtr(workload_idx));
+                        workload_idx++;
+                    });
+            EXPECT_EQ(workload_idx, std::max(begin, end));
+        }
+    }
+
+    EXPECT_THROW((StaticIndexer<2, 2>(coalesced)), std::runtime_error);
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -77,5 +77,61 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST_P(MemoryManagerPermuteDevices, CacheReuse) {
+    Device device = GetParam();
+
+    MemoryManager::EnableCache(device);
+    MemoryManager::ReleaseCache(device);
+    MemoryManager::ResetCacheStatistics(device);
+    EXPECT_TRUE(MemoryManager::IsCacheEnabled(device));
+
+    // 1000 and 900 bytes fall into the same bucket.
+    void* ptr = MemoryManager::Malloc(1000, device);
+    MemoryManager::Free(ptr, device);
+    MemoryCacheStatistics stats = MemoryManager::GetCacheStatistics(device);
+    EXPECT_EQ(stats.num_misses, 1);
+    EXPECT_EQ(stats.num_cached_blocks, 1);
+    EXPECT_EQ(stats.cached_byte_size, 1024);
+
+    void* reused_ptr = MemoryManager::Malloc(900, device);
+    EXPECT_EQ(reused_ptr, ptr);
+    stats = MemoryManager::GetCacheStatistics(device);
+    EXPECT_EQ(stats.num_hits, 1);
+    EXPECT_EQ(stats.num_cached_blocks, 0);
+
+    // Disabling the cache while a block is in use frees it normally.
+    MemoryManager::DisableCache(device);
+    EXPECT_FALSE(MemoryManager::IsCacheEnabled(device));
+    MemoryManager::Free(reused_ptr, device);
+    stats = MemoryManager::GetCacheStatistics(device);
+    EXPECT_EQ(stats.num_cached_blocks, 0);
+    EXPECT_EQ(stats.cached_byte_size, 0);
+}
+
+TEST_P(MemoryManagerPermuteDevices, CacheRelease) {
+    Device device = GetParam();
+
+    MemoryManager::EnableCache(device);
+    void* ptr_a = MemoryManager::Malloc(100, device);
+    void* ptr_b = MemoryManager::Malloc(5 << 20, device);
+    MemoryManager::Free(ptr_a, device);
+    MemoryManager::Free(ptr_b, device);
+    EXPECT_EQ(MemoryManager::GetCacheStatistics(device).num_cached_blocks, 2);
+
+    MemoryManager::ReleaseCache(device);
+    EXPECT_EQ(MemoryManager::GetCacheStatistics(device).num_cached_blocks, 0);
+    EXPECT_EQ(MemoryManager::GetCacheStatistics(device).cached_byte_size, 0);
+    MemoryManager::DisableCache(device);
+}
+
+TEST(MemoryManager, CacheBucketSize) {
+    EXPECT_EQ(CachedMemoryManager::BucketSize(1), 512);
+    EXPECT_EQ(CachedMemoryManager::BucketSize(512), 512);
+    EXPECT_EQ(CachedMemoryManager::BucketSize(513), 1024);
+    EXPECT_EQ(CachedMemoryManager::BucketSize((1 << 20) + 1),
+              (1 << 20) + (1 << 18));
+    EXPECT_EQ(CachedMemoryManager::BucketSize(3 << 20), 3 << 20);
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -0,0 +1,232 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/NumpyIO.h"
+
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Open3D/Utility/FileSystem.h"
+
+#include "Core/CoreTest.h"
+#include "UnitTest/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class NumpyIOPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(NumpyIO,
+                         NumpyIOPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static void WriteRawFile(const std::string& file_name,
+                         const std::string& bytes) {
+    FILE* file = utility::filesystem::FOpen(file_name, "wb");
+    fwrite(bytes.data(), 1, bytes.size(), file);
+    fclose(file);
+}
+
+static std::string ReadRawFile(const std::string& file_name) {
+    std::vector<char> bytes;
+    utility::filesystem::FReadToBuffer(file_name, bytes, nullptr);
+    return std::string(bytes.begin(), bytes.end());
+}
+
+/// A version 1.0 .npy header with \p padding spaces after the dict.
+static std::string MakeHeader(const std::string& dict, size_t padding) {
+    std::string header = dict + std::string(padding, ' ') + "\n";
+    std::string bytes("\x93NUMPY\x01\x00", 8);
+    bytes += static_cast<char>(header.size() & 0xFF);
+    bytes += static_cast<char>(header.size() >> 8);
+    return bytes + header;
+}
+
+TEST_P(NumpyIOPermuteDevices, NpyRoundTrip) {
+    Device device = GetParam();
+
+    Tensor floats(std::vector<float>{0, 1, 2, 3, 4, 5}, {2, 3}, Dtype::Float32,
+                  device);
+    // Non-contiguous tensors are written in C order.
+    floats.T().Save("tmp.npy");
+    Tensor loaded = Tensor::Load("tmp.npy");
+    EXPECT_EQ(loaded.GetDevice(), Device("CPU:0"));
+    EXPECT_EQ(loaded.GetDtype(), Dtype::Float32);
+    EXPECT_EQ(loaded.GetShape(), SizeVector({3, 2}));
+    EXPECT_EQ(loaded.ToFlatVector<float>(),
+              std::vector<float>({0, 3, 1, 4, 2, 5}));
+
+    // The header is padded such that the data is 64-byte aligned.
+    std::string bytes = ReadRawFile("tmp.npy");
+    EXPECT_EQ(bytes.size(), 128 + 6 * sizeof(float));
+    EXPECT_EQ(bytes.substr(10, 59),
+              "{'descr': '<f4', 'fortran_order': False, 'shape': (3, 2), }");
+
+    // The memory-mapped tensor can be modified without changing the file.
+    loaded.Fill(7);
+    EXPECT_EQ(Tensor::Load("tmp.npy").ToFlatVector<float>(),
+              std::vector<float>({0, 3, 1, 4, 2, 5}));
+
+    std::vector<Tensor> tensors = {
+            Tensor(std::vector<double>{1.5}, {}, Dtype::Float64, device),
+            Tensor(std::vector<int32_t>{}, {0}, Dtype::Int32, device),
+            Tensor(std::vector<int64_t>{-1, 2, -3, 4}, {4}, Dtype::Int64,
+                   device),
+            Tensor(std::vector<uint8_t>{1, 2, 3, 4, 5, 6, 7, 8}, {2, 2, 2},
+                   Dtype::UInt8, device),
+            Tensor(std::vector<bool>{true, false, true}, {3, 1}, Dtype::Bool,
+                   device),
+            Tensor(std::vector<Half>{0.5f, -2.f, 1024.f}, {3}, Dtype::Float16,
+                   device),
+            Tensor(std::vector<int8_t>{-128, 0, 127}, {3}, Dtype::Int8,
+                   device),
+            Tensor(std::vector<int16_t>{-300, 300}, {2}, Dtype::Int16, device),
+            Tensor(std::vector<uint16_t>{0, 1000, 65535}, {3}, Dtype::UInt16,
+                   device)};
+    for (const Tensor& tensor : tensors) {
+        WriteNpy("tmp.npy", tensor);
+        loaded = ReadNpy("tmp.npy");
+        EXPECT_EQ(loaded.GetDtype(), tensor.GetDtype());
+        EXPECT_EQ(loaded.GetShape(), tensor.GetShape());
+        EXPECT_EQ(loaded.Copy(device).ToString(false),
+                  tensor.ToString(false));
+    }
+    utility::filesystem::RemoveFile("tmp.npy");
+}
+
+TEST(NumpyIO, NpyHeaders) {
+    // Fortran order, data not aligned to 64 bytes.
+    std::string bytes = MakeHeader(
+            "{'descr': '<i4', 'fortran_order': True, 'shape': (2, 3), }", 1);
+    std::vector<int32_t> data{0, 3, 1, 4, 2, 5};
+    bytes += std::string(reinterpret_cast<const char*>(data.data()),
+                         data.size() * sizeof(int32_t));
+    WriteRawFile("tmp.npy", bytes);
+    Tensor loaded = ReadNpy("tmp.npy");
+    EXPECT_EQ(loaded.GetShape(), SizeVector({2, 3}));
+    EXPECT_FALSE(loaded.IsContiguous());
+    EXPECT_EQ(loaded.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 2, 3, 4, 5}));
+
+    // Data not aligned to the element size is copied.
+    bytes = MakeHeader("{'descr': '<f8', 'fortran_order': False, "
+                       "'shape': (2,), }",
+                       2);
+    std::vector<double> doubles{0.5, -2};
+    bytes += std::string(reinterpret_cast<const char*>(doubles.data()),
+                         doubles.size() * sizeof(double));
+    WriteRawFile("tmp.npy", bytes);
+    EXPECT_EQ(ReadNpy("tmp.npy").ToFlatVector<double>(), doubles);
+
+    // Errors.
+    EXPECT_THROW(ReadNpy("tmp.npy.missing"), std::runtime_error);
+    WriteRawFile("tmp.npy", "NUMPY");
+    EXPECT_THROW(ReadNpy("tmp.npy"), std::runtime_error);
+    WriteRawFile("tmp.npy",
+                 MakeHeader("{'descr': '>f4', 'fortran_order': False, "
+                            "'shape': (1,), }",
+                            0) +
+                         std::string(4, '\0'));
+    EXPECT_THROW(ReadNpy("tmp.npy"), std::runtime_error);
+    WriteRawFile("tmp.npy",
+                 MakeHeader("{'descr': '<f4', 'fortran_order': False, "
+                            "'shape': (3,), }",
+                            0) +
+                         std::string(8, '\0'));
+    EXPECT_THROW(ReadNpy("tmp.npy"), std::runtime_error);
+    // Malformed shapes, including negative dimensions whose product is the
+    // number of elements in the file.
+    for (const char* shape : {"(-2,)", "(-1, -4)", "(2, x)"}) {
+        WriteRawFile("tmp.npy",
+                     MakeHeader(std::string("{'descr': '<f4', "
+                                            "'fortran_order': False, "
+                                            "'shape': ") +
+                                        shape + ", }",
+                                0) +
+                             std::string(16, '\0'));
+        EXPECT_THROW(ReadNpy("tmp.npy"), std::runtime_error);
+    }
+    EXPECT_THROW(Tensor::Load("tmp.ply"), std::runtime_error);
+    utility::filesystem::RemoveFile("tmp.npy");
+}
+
+TEST_P(NumpyIOPermuteDevices, Npz) {
+    Device device = GetParam();
+
+    std::unordered_map<std::string, Tensor> tensors = {
+            {"points", Tensor(std::vector<float>{0, 1, 2, 3, 4, 5}, {2, 3},
+                              Dtype::Float32, device)},
+            {"labels",
+             Tensor(std::vector<int64_t>{7, 8}, {2}, Dtype::Int64, device)},
+            {"empty", Tensor(std::vector<uint8_t>{}, {0, 3}, Dtype::UInt8,
+                             device)}};
+    WriteNpz("tmp.npz", tensors);
+    std::unordered_map<std::string, Tensor> loaded = ReadNpz("tmp.npz");
+    EXPECT_EQ(loaded.size(), 3);
+    for (const auto& name_tensor : tensors) {
+        const Tensor& tensor = loaded.at(name_tensor.first);
+        EXPECT_EQ(tensor.GetShape(), name_tensor.second.GetShape());
+        EXPECT_EQ(tensor.Copy(device).ToString(false),
+                  name_tensor.second.ToString(false));
+    }
+    // Arrays are aligned within the archive and memory-mapped.
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(
+                      loaded.at("points").GetDataPtr()) % 64,
+              0);
+    EXPECT_THROW(Tensor::Load("tmp.npz"), std::runtime_error);
+
+    tensors.at("labels").Save("tmp.npz");
+    EXPECT_EQ(ReadNpz("tmp.npz").count("arr_0"), 1);
+    EXPECT_EQ(Tensor::Load("tmp.npz").ToFlatVector<int64_t>(),
+              std::vector<int64_t>({7, 8}));
+
+    // Compressed entries are not supported: set the compression method of
+    // the central directory entry to deflate.
+    const std::string original = ReadRawFile("tmp.npz");
+    std::string bytes = original;
+    bytes[bytes.find("PK\x01\x02") + 10] = 8;
+    WriteRawFile("tmp.npz", bytes);
+    EXPECT_THROW(ReadNpz("tmp.npz"), std::runtime_error);
+
+    // A ZIP64 extra field larger than the extra data: turn the ".npy" suffix
+    // of the entry name into a field header claiming 16 bytes, and mark the
+    // compressed size as stored in the field.
+    bytes = original;
+    size_t entry = bytes.find("PK\x01\x02");
+    bytes.replace(entry + 20, 4, "\xFF\xFF\xFF\xFF");
+    bytes[entry + 28] = 5;
+    bytes[entry + 30] = 4;
+    bytes.replace(entry + 46 + 5, 4, std::string("\x01\x00\x10\x00", 4));
+    WriteRawFile("tmp.npz", bytes);
+    EXPECT_THROW(ReadNpz("tmp.npz"), std::runtime_error);
+    WriteRawFile("tmp.npz", "PK");
+    EXPECT_THROW(ReadNpz("tmp.npz"), std::runtime_error);
+    utility::filesystem::RemoveFile("tmp.npz");
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/ParallelUtil.h"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "UnitTest/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+using namespace kernel::parallel_util;
+
+TEST(ParallelUtil, SetNumThreads) {
+    int default_num_threads = GetNumThreads();
+    EXPECT_GE(default_num_threads, 1);
+#ifdef _OPENMP
+    int omp_max_threads = omp_get_max_threads();
+#endif
+    SetNumThreads(3);
+    EXPECT_EQ(GetNumThreads(), 3);
+    EXPECT_EQ(GetMaxThreads(), 3);
+#ifdef _OPENMP
+    // OpenMP loops are not governed by the pool.
+    EXPECT_EQ(omp_get_max_threads(), omp_max_threads);
+#endif
+    SetNumThreads(0);
+    EXPECT_EQ(GetNumThreads(), default_num_threads);
+}
+
+TEST(ParallelUtil, ParallelFor) {
+    for (int num_threads : {1, 4}) {
+        SetNumThreads(num_threads);
+
+        // Every element is visited exactly once, also with irregular work.
+        int64_t n = 100003;
+        std::vector<int> visits(n, 0);
+        ParallelFor(0, n, 16, [&](int64_t begin, int64_t end) {
+            EXPECT_LT(begin, end);
+            for (int64_t i = begin; i < end; ++i) {
+                volatile int64_t work = 0;
+                for (int64_t j = 0; j < (i % 1000 == 0 ? 10000 : 1); ++j) {
+                    work = work + j;
+                }
+                visits[i]++;
+            }
+        });
+        EXPECT_EQ(visits, std::vector<int>(n, 1));
+
+        // Ranges smaller than the grain size run in one call.
+        std::atomic<int> num_calls(0);
+        ParallelFor(5, 105, 1000,
+                    [&](int64_t begin, int64_t end) { num_calls++; });
+        EXPECT_EQ(num_calls.load(), 1);
+
+        // Empty ranges.
+        ParallelFor(10, 10, 1, [&](int64_t begin, int64_t end) {
+            ADD_FAILURE() << "Empty range must not call the function.";
+        });
+
+        // Nested calls run serially.
+        std::vector<int64_t> sums(64, 0);
+        ParallelFor(0, 64, 1, [&](int64_t begin, int64_t end) {
+            for (int64_t i = begin; i < end; ++i) {
+                EXPECT_EQ(InParallel(), num_threads > 1);
+                ParallelFor(0, 1000, 1, [&](int64_t inner_begin,
+                                            int64_t inner_end) {
+                    for (int64_t j = inner_begin; j < inner_end; ++j) {
+                        sums[i] += j;
+                    }
+                });
+            }
+        });
+        EXPECT_EQ(sums, std::vector<int64_t>(64, 499500));
+    }
+    SetNumThreads(0);
+    EXPECT_FALSE(InParallel());
+}
+
+TEST(ParallelUtil, ParallelReduceAndScan) {
+    for (int num_threads : {1, 4}) {
+        SetNumThreads(num_threads);
+
+        int64_t n = 1 << 20;
+        std::vector<int64_t> vals(n);
+        for (int64_t i = 0; i < n; ++i) {
+            vals[i] = i % 7 - 3;
+        }
+        int64_t sum = ParallelReduce(
+                int64_t(0), n, 1024, int64_t(0),
+                [&](int64_t begin, int64_t end, int64_t init) {
+                    for (int64_t i = begin; i < end; ++i) {
+                        init += vals[i];
+                    }
+                    return init;
+                },
+                [](int64_t a, int64_t b) { return a + b; });
+        EXPECT_EQ(sum, std::accumulate(vals.begin(), vals.end(), int64_t(0)));
+
+        std::vector<int64_t> scanned(n);
+        int64_t total = ParallelScan(
+                int64_t(0), n, 1024, int64_t(0),
+                [&](int64_t begin, int64_t end, int64_t prefix,
+                    bool is_final) {
+                    for (int64_t i = begin; i < end; ++i) {
+                        prefix += vals[i];
+                        if (is_final) {
+                            scanned[i] = prefix;
+                        }
+                    }
+                    return prefix;
+                },
+                [](int64_t a, int64_t b) { return a + b; });
+        std::vector<int64_t> expected(n);
+        std::partial_sum(vals.begin(), vals.end(), expected.begin());
+        EXPECT_EQ(total, expected.back());
+        EXPECT_EQ(scanned, expected);
+    }
+    SetNumThreads(0);
+}
+
+TEST(ParallelUtil, Exceptions) {
+    SetNumThreads(4);
+    EXPECT_THROW(ParallelFor(0, 1000, 1,
+                             [](int64_t begin, int64_t end) {
+                                 if (begin == 0) {
+                                     throw std::runtime_error("error");
+                                 }
+                             }),
+                 std::runtime_error);
+
+    // The pool remains usable.
+    std::atomic<int64_t> count(0);
+    ParallelFor(0, 1000, 1, [&](int64_t begin, int64_t end) {
+        count += end - begin;
+    });
+    EXPECT_EQ(count.load(), 1000);
+
+    ParallelFor(0, 100, 1, [&](int64_t begin, int64_t end) {
+        EXPECT_THROW(SetNumThreads(2), std::runtime_error);
+    });
+    SetNumThreads(0);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
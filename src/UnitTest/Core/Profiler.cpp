@@ -0,0 +1,170 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Profiler.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "Open3D/Core/MemoryManager.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/FileSystem.h"
+
+#include "UnitTest/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(Profiler, DisabledByDefault) {
+    EXPECT_FALSE(Profiler::IsEnabled());
+    Profiler::Reset();
+    Tensor a = Tensor::Ones({10}, Dtype::Float32, Device("CPU:0"));
+    Tensor b = a + a;
+    EXPECT_TRUE(Profiler::GetOpStatistics().empty());
+    EXPECT_TRUE(Profiler::GetMemoryStatistics().empty());
+}
+
+TEST(Profiler, OpStatistics) {
+    Device device("CPU:0");
+    Tensor a = Tensor::Ones({100, 10}, Dtype::Float32, device);
+
+    Profiler::Reset();
+    Profiler::Enable();
+    Tensor b = a + a;
+    Tensor c = b + a;
+    Tensor s = c.Sum({0});
+    Profiler::Disable();
+
+    // Ops after Disable() are not recorded.
+    Tensor d = a * a;
+
+    std::map<std::string, ProfilerOpStatistics> ops =
+            Profiler::GetOpStatistics();
+    ASSERT_EQ(ops.count("Add"), 1);
+    EXPECT_EQ(ops["Add"].num_calls, 2);
+    EXPECT_EQ(ops["Add"].num_bytes, 2 * 3 * 1000 * 4);
+    EXPECT_GE(ops["Add"].time_ms, 0);
+    ASSERT_EQ(ops.count("Sum"), 1);
+    EXPECT_EQ(ops["Sum"].num_calls, 1);
+    EXPECT_EQ(ops["Sum"].num_bytes, (1000 + 10) * 4);
+    EXPECT_EQ(ops.count("Mul"), 0);
+
+    // The outputs are allocated before the kernels are called.
+    std::map<std::string, ProfilerMemoryStatistics> memory =
+            Profiler::GetMemoryStatistics();
+    ASSERT_EQ(memory.count("CPU:0"), 1);
+    EXPECT_GE(memory["CPU:0"].num_allocations, 3);
+    EXPECT_GE(memory["CPU:0"].allocated_byte_size, 2 * 1000 * 4 + 10 * 4);
+    EXPECT_EQ(memory["CPU:0"].max_allocation_byte_size, 1000 * 4);
+
+    std::string summary = Profiler::GetSummary();
+    EXPECT_NE(summary.find("Add"), std::string::npos);
+    EXPECT_NE(summary.find("CPU:0"), std::string::npos);
+
+    Profiler::Reset();
+    EXPECT_TRUE(Profiler::GetOpStatistics().empty());
+}
+
+TEST(Profiler, MemoryStatistics) {
+    Device device("CPU:0");
+    bool cache_enabled = MemoryManager::IsCacheEnabled(device);
+    MemoryManager::DisableCache(device);
+
+    Profiler::Reset();
+    Profiler::Enable();
+    {
+        Tensor a = Tensor::Empty({1000}, Dtype::Float64, device);
+        Tensor b = Tensor::Empty({500}, Dtype::Float64, device);
+    }
+    Tensor c = Tensor::Empty({100}, Dtype::Float64, device);
+    Profiler::Disable();
+
+    ProfilerMemoryStatistics memory =
+            Profiler::GetMemoryStatistics()["CPU:0"];
+    EXPECT_EQ(memory.num_allocations, 3);
+    EXPECT_EQ(memory.allocated_byte_size, 1600 * 8);
+    EXPECT_EQ(memory.max_allocation_byte_size, 1000 * 8);
+    EXPECT_EQ(memory.peak_byte_size, 1500 * 8);
+    EXPECT_EQ(memory.current_byte_size, 100 * 8);
+
+    // Frees of tracked allocations are recorded after Disable(), while
+    // untracked allocations are not.
+    EXPECT_TRUE(Profiler::HasTrackedAllocations());
+    Tensor d = Tensor::Empty({10}, Dtype::Float64, device);
+    c = Tensor();
+    d = Tensor();
+    EXPECT_FALSE(Profiler::HasTrackedAllocations());
+    memory = Profiler::GetMemoryStatistics()["CPU:0"];
+    EXPECT_EQ(memory.num_allocations, 3);
+    EXPECT_EQ(memory.current_byte_size, 0);
+    c = Tensor::Empty({100}, Dtype::Float64, device);
+
+    // Allocations made inside an op are attributed to it.
+    Profiler::Reset();
+    Profiler::Enable();
+    {
+        ProfilerScope scope("Custom", {c});
+        Tensor temporary = Tensor::Empty({10}, Dtype::Float64, device);
+    }
+    Profiler::Disable();
+    ProfilerOpStatistics op = Profiler::GetOpStatistics()["Custom"];
+    EXPECT_EQ(op.num_calls, 1);
+    EXPECT_EQ(op.num_bytes, 100 * 8);
+    EXPECT_EQ(op.num_allocations, 1);
+    EXPECT_EQ(op.allocated_byte_size, 10 * 8);
+
+    Profiler::Reset();
+    if (cache_enabled) {
+        MemoryManager::EnableCache(device);
+    }
+}
+
+TEST(Profiler, ExportChromeTrace) {
+    Tensor a = Tensor::Ones({10}, Dtype::Float32, Device("CPU:0"));
+    Profiler::Reset();
+    Profiler::Enable();
+    Tensor b = a.Sqrt();
+    Profiler::Disable();
+
+    std::string file_name = "profiler_trace.json";
+    Profiler::ExportChromeTrace(file_name);
+    std::ifstream file(file_name);
+    std::stringstream trace;
+    trace << file.rdbuf();
+    EXPECT_EQ(trace.str().find("{\"traceEvents\": ["), 0);
+    EXPECT_NE(trace.str().find("\"name\": \"Sqrt\""), std::string::npos);
+    EXPECT_NE(trace.str().find("\"name\": \"Memory CPU:0\""),
+              std::string::npos);
+    utility::filesystem::RemoveFile(file_name);
+    Profiler::Reset();
+
+    EXPECT_THROW(Profiler::ExportChromeTrace("/non_existent_dir/trace.json"),
+                 std::runtime_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -24,13 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
+#include <tuple>
 
 #include "Open3D/Core/AdvancedIndexing.h"
 #include "Open3D/Core/Dtype.h"
 #include "Open3D/Core/Kernel/Kernel.h"
 #include "Open3D/Core/MemoryManager.h"
+#include "Open3D/Core/ParallelUtil.h"
 #include "Open3D/Core/SizeVector.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Helper.h"
@@ -216,6 +220,124 @@ TEST_P(TensorPermuteDevices, To) {
     EXPECT_EQ(dst_t.ToFlatVector<int>(), dst_vals);
 }
 
+TEST(Tensor, Half) {
+    EXPECT_EQ(Half(1.f).GetBits(), 0x3C00);
+    EXPECT_EQ(Half(-2.f).GetBits(), 0xC000);
+    EXPECT_EQ(Half(65504.f).GetBits(), 0x7BFF);
+    // Rounding to nearest even, overflow to infinity and subnormals.
+    EXPECT_EQ(Half(1.f + 1.f / 2048).GetBits(), 0x3C00);
+    EXPECT_EQ(Half(1.f + 3.f / 2048).GetBits(), 0x3C02);
+    EXPECT_EQ(Half(65520.f).GetBits(), 0x7C00);
+    EXPECT_EQ(Half(-1e10f).GetBits(), 0xFC00);
+    EXPECT_EQ(Half(5.9604645e-8f).GetBits(), 0x0001);
+    EXPECT_EQ(Half(1e-8f).GetBits(), 0x0000);
+    EXPECT_EQ(Half(-0.f).GetBits(), 0x8000);
+    EXPECT_TRUE(std::isnan(float(Half(std::nanf("")))));
+
+    for (uint16_t bits : {0x0001, 0x03FF, 0x0400, 0x3555, 0x7BFF, 0x7C00,
+                          0x8001, 0xBC00, 0xFBFF, 0xFC00}) {
+        EXPECT_EQ(Half(float(Half::FromBits(bits))).GetBits(), bits);
+    }
+    EXPECT_EQ(float(std::numeric_limits<Half>::max()), 65504.f);
+    EXPECT_EQ(float(std::numeric_limits<Half>::lowest()), -65504.f);
+}
+
+TEST_P(TensorPermuteDevices, Float16) {
+    Device device = GetParam();
+
+    Tensor a(std::vector<float>{0.5, 1.5, -2, 3.25}, {2, 2}, Dtype::Float32,
+             device);
+    Tensor a_half = a.To(Dtype::Float16);
+    EXPECT_EQ(a_half.GetDtype(), Dtype::Float16);
+    EXPECT_EQ(DtypeUtil::ByteSize(a_half.GetDtype()), 2);
+    EXPECT_EQ(a_half.To(Dtype::Float32).ToFlatVector<float>(),
+              a.ToFlatVector<float>());
+    EXPECT_EQ(a_half.ToString(false), "[[0.5 1.5],\n [-2 3.25]]");
+
+    // Arithmetic is computed in float and rounded to Float16.
+    Tensor b = Tensor::Full({2}, 1.f / 3, Dtype::Float16, device);
+    Tensor c = (a_half * b + a_half).To(Dtype::Float32);
+    std::vector<float> expected;
+    for (float v : a.ToFlatVector<float>()) {
+        expected.push_back(float(Half(float(Half(v * float(Half(1.f / 3)))) +
+                                      v)));
+    }
+    EXPECT_EQ(c.ToFlatVector<float>(), expected);
+    EXPECT_EQ(a_half.Gt(b).ToFlatVector<bool>(),
+              std::vector<bool>({true, true, false, true}));
+    EXPECT_EQ(a_half.Sum({0, 1}).Item<Half>(), Half(3.25f));
+    EXPECT_EQ(a_half.Max({0, 1}).Item<Half>(), Half(3.25f));
+    EXPECT_EQ(a_half.Abs().To(Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({0.5, 1.5, 2, 3.25}));
+
+    // Float-only unary ops are computed in float and rounded to Float16.
+    Tensor d = a_half.Abs();
+    std::vector<float> d_vals = d.To(Dtype::Float32).ToFlatVector<float>();
+    auto expect_unary = [&](const Tensor& result, float (*f)(float)) {
+        std::vector<float> expected;
+        for (float v : d_vals) {
+            expected.push_back(float(Half(f(v))));
+        }
+        EXPECT_EQ(result.GetDtype(), Dtype::Float16);
+        EXPECT_EQ(result.To(Dtype::Float32).ToFlatVector<float>(), expected);
+    };
+    expect_unary(d.Sqrt(), [](float v) { return std::sqrt(v); });
+    expect_unary(d.Sin(), [](float v) { return std::sin(v); });
+    expect_unary(d.Cos(), [](float v) { return std::cos(v); });
+    expect_unary(d.Exp(), [](float v) { return std::exp(v); });
+    expect_unary(d.Log(), [](float v) { return std::log(v); });
+
+    // Sorting is CPU-only.
+    if (device.GetType() != Device::DeviceType::CPU) {
+        return;
+    }
+    EXPECT_EQ(a_half.Reshape({4}).Sort().To(Dtype::Float32)
+                      .ToFlatVector<float>(),
+              std::vector<float>({-2, 0.5, 1.5, 3.25}));
+    Tensor halfs = Tensor(std::vector<float>{1, std::nanf(""), -1, 2}, {4},
+                          Dtype::Float32, device)
+                           .To(Dtype::Float16);
+    EXPECT_EQ(halfs.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 3, 1}));
+    EXPECT_EQ(halfs.ArgSort(0, true).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({3, 0, 2, 1}));
+}
+
+TEST_P(TensorPermuteDevices, SmallIntegerDtypes) {
+    Device device = GetParam();
+
+    // 16-bit depth image in millimeters to meters.
+    Tensor depth(std::vector<uint16_t>{0, 1000, 2500, 65535}, {2, 2},
+                 Dtype::UInt16, device);
+    EXPECT_EQ(DtypeUtil::ByteSize(depth.GetDtype()), 2);
+    EXPECT_EQ(depth.To(Dtype::Float32).Div(1000.f).ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2.5, 65.535f}));
+    EXPECT_EQ(depth.Max({0, 1}).Item<uint16_t>(), 65535);
+    EXPECT_EQ((depth > Tensor::Full({}, uint16_t(2000), Dtype::UInt16, device))
+                      .ToFlatVector<bool>(),
+              std::vector<bool>({false, false, true, true}));
+
+    Tensor int8s(std::vector<int8_t>{-128, -1, 0, 127}, {4}, Dtype::Int8,
+                 device);
+    EXPECT_EQ(int8s.ToString(false), "[-128 -1 0 127]");
+    EXPECT_EQ(int8s.To(Dtype::Int64).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({-128, -1, 0, 127}));
+
+    Tensor int16s(std::vector<int16_t>{300, -300, 7}, {3}, Dtype::Int16,
+                  device);
+    EXPECT_EQ((int16s * int16s).ToFlatVector<int16_t>(),
+              std::vector<int16_t>({24464, 24464, 49}));
+
+    // Sorting is CPU-only.
+    if (device.GetType() != Device::DeviceType::CPU) {
+        return;
+    }
+    EXPECT_EQ(int8s.Neg().Sort().ToFlatVector<int8_t>(),
+              std::vector<int8_t>({-128, -127, 0, 1}));
+    EXPECT_EQ(int16s.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 2, 0}));
+}
+
 TEST_P(TensorPermuteDevicePairs, CopyBroadcast) {
     Device dst_device;
     Device src_device;
@@ -1064,6 +1186,74 @@ TEST_P(TensorPermuteDevices, Add_) {
               std::vector<float>({10, 12, 14, 16, 18, 20}));
 }
 
+TEST_P(TensorPermuteDevices, AddOut) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>({0, 1, 2}), {3}, Dtype::Float32, device);
+    Tensor b(std::vector<float>({10, 11, 12, 13, 14, 15}), {2, 3},
+             Dtype::Float32, device);
+    Tensor dst = Tensor::Empty({2, 3}, Dtype::Float32, device);
+    void* dst_ptr = dst.GetDataPtr();
+    for (int i = 0; i < 3; ++i) {
+        a.Add(b, dst);
+    }
+    EXPECT_EQ(dst.GetDataPtr(), dst_ptr);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({10, 12, 14, 13, 15, 17}));
+
+    // The broadcasted right operand is updated in-place, which Add_ on the
+    // left operand a cannot do.
+    a.Mul(b, b);
+    EXPECT_EQ(b.ToFlatVector<float>(),
+              std::vector<float>({0, 11, 24, 0, 14, 30}));
+    b.Sub(a, dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({0, 10, 22, 0, 13, 28}));
+    dst.Div(Tensor::Full({}, 2.f, Dtype::Float32, device), dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({0, 5, 11, 0, 6.5, 14}));
+
+    // dst must have the broadcasted shape and the same dtype.
+    Tensor wrong_shape = Tensor::Empty({3}, Dtype::Float32, device);
+    EXPECT_THROW(a.Add(b, wrong_shape), std::runtime_error);
+    Tensor wrong_dtype = Tensor::Empty({2, 3}, Dtype::Float64, device);
+    EXPECT_THROW(a.Add(b, wrong_dtype), std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, ElementWiseOut) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>({0, 1, 4, 9}), {2, 2}, Dtype::Float32, device);
+    Tensor b(std::vector<float>({1, 4}), {2}, Dtype::Float32, device);
+
+    Tensor mask = Tensor::Empty({2, 2}, Dtype::Bool, device);
+    a.Gt(b, mask);
+    EXPECT_EQ(mask.ToFlatVector<bool>(),
+              std::vector<bool>({false, false, true, true}));
+    a.Eq(b, mask);
+    EXPECT_EQ(mask.ToFlatVector<bool>(),
+              std::vector<bool>({false, false, false, false}));
+    a.LogicalAnd(b, mask);
+    EXPECT_EQ(mask.ToFlatVector<bool>(),
+              std::vector<bool>({false, true, true, true}));
+    mask.LogicalNot(mask);
+    EXPECT_EQ(mask.ToFlatVector<bool>(),
+              std::vector<bool>({true, false, false, false}));
+
+    Tensor float_mask = Tensor::Empty({2, 2}, Dtype::Float32, device);
+    a.Le(b, float_mask);
+    EXPECT_EQ(float_mask.ToFlatVector<float>(),
+              std::vector<float>({1, 1, 0, 0}));
+    Tensor wrong_dtype = Tensor::Empty({2, 2}, Dtype::Int32, device);
+    EXPECT_THROW(a.Lt(b, wrong_dtype), std::runtime_error);
+
+    Tensor dst = Tensor::Empty({2, 2}, Dtype::Float32, device);
+    a.Sqrt(dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3}));
+    dst.Neg(dst);
+    dst.Abs(a);
+    EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3}));
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({0, -1, -2, -3}));
+}
+
 TEST_P(TensorPermuteDevices, Add_BroadcastException) {
     // A.shape = (   3, 4)
     // B.shape = (2, 3, 4)
@@ -1148,6 +1338,82 @@ TEST_P(TensorPermuteDevices, Div_) {
     EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3, 4, 5}));
 }
 
+TEST_P(TensorPermuteDevices, BinaryEWContiguousAndScalar) {
+    Device device = GetParam();
+
+    // Odd number of elements spanning multiple parallel chunks, such that the
+    // vectorized loop, the scalar tail loop and chunking are all exercised.
+    int64_t n = 70001;
+    std::vector<float> a_vals(n);
+    std::vector<float> b_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        a_vals[i] = static_cast<float>(i % 97);
+        b_vals[i] = static_cast<float>(i % 13 + 1);
+    }
+    Tensor a(a_vals, {n}, Dtype::Float32, device);
+    Tensor b(b_vals, {n}, Dtype::Float32, device);
+
+    // Both contiguous.
+    std::vector<float> c_vals = (a * b - a / b).ToFlatVector<float>();
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_FLOAT_EQ(c_vals[i],
+                        a_vals[i] * b_vals[i] - a_vals[i] / b_vals[i]);
+    }
+
+    // Broadcasted single element on either side.
+    Tensor s(std::vector<float>({2}), {1}, Dtype::Float32, device);
+    std::vector<float> lhs_scalar_vals = (s - a).ToFlatVector<float>();
+    std::vector<float> rhs_scalar_vals = (a + s).ToFlatVector<float>();
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_EQ(lhs_scalar_vals[i], 2 - a_vals[i]);
+        EXPECT_EQ(rhs_scalar_vals[i], a_vals[i] + 2);
+    }
+
+    // Non-contiguous inputs fall back to the generic kernel.
+    Tensor ab = Tensor::Empty({n, 2}, Dtype::Float64, device);
+    ab.Slice(1, 0, 1) = a.To(Dtype::Float64).Reshape({n, 1});
+    ab.Slice(1, 1, 2) = b.To(Dtype::Float64).Reshape({n, 1});
+    std::vector<double> d_vals =
+            (ab.Slice(1, 0, 1) + ab.Slice(1, 1, 2)).ToFlatVector<double>();
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_EQ(d_vals[i], static_cast<double>(a_vals[i] + b_vals[i]));
+    }
+
+    // Integer dtypes and in-place ops.
+    Tensor x(std::vector<int32_t>({1, 2, 3, 4, 5}), {5}, Dtype::Int32, device);
+    x *= Tensor(std::vector<int32_t>({3}), {}, Dtype::Int32, device);
+    EXPECT_EQ(x.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 6, 9, 12, 15}));
+}
+
+TEST_P(TensorPermuteDevices, UnaryEWContiguous) {
+    Device device = GetParam();
+
+    std::vector<double> src_vals{-4, -1, 0, 1, 4, 9, 16};
+    Tensor src(src_vals, {7}, Dtype::Float64, device);
+    EXPECT_EQ(src.Abs().ToFlatVector<double>(),
+              std::vector<double>({4, 1, 0, 1, 4, 9, 16}));
+    EXPECT_EQ(src.Neg().ToFlatVector<double>(),
+              std::vector<double>({4, 1, -0., -1, -4, -9, -16}));
+    EXPECT_EQ(src.Abs().Sqrt().ToFlatVector<double>(),
+              std::vector<double>({2, 1, 0, 1, 2, 3, 4}));
+    std::vector<double> exp_vals = src.Exp().ToFlatVector<double>();
+    for (size_t i = 0; i < src_vals.size(); ++i) {
+        EXPECT_DOUBLE_EQ(exp_vals[i], std::exp(src_vals[i]));
+    }
+
+    // Contiguous dtype conversion.
+    EXPECT_EQ(src.To(Dtype::Int32).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-4, -1, 0, 1, 4, 9, 16}));
+
+    // Non-contiguous input.
+    Tensor src_t = Tensor(std::vector<float>({-1, -2, -3, -4, -5, -6}), {2, 3},
+                          Dtype::Float32, device)
+                           .T();
+    EXPECT_EQ(src_t.Abs().ToFlatVector<float>(),
+              std::vector<float>({1, 4, 2, 5, 3, 6}));
+}
+
 TEST_P(TensorPermuteDevices, ReduceSumKeepDim) {
     Device device = GetParam();
     Tensor src(
@@ -1496,6 +1762,81 @@ TEST_P(TensorPermuteDevices, ReduceSumLargeArray) {
     }
 }
 
+TEST_P(TensorPermuteDevices, ReduceContiguous) {
+    Device device = GetParam();
+
+    // Reductions of contiguous tensors over consecutive dims must match the
+    // generic kernels, used here for a non-contiguous copy.
+    SizeVector shape{3, 517, 7};
+    std::vector<int64_t> vals(shape.NumElements());
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = utility::UniformRandInt(-1, 2);
+    }
+    Tensor src(vals, shape, Dtype::Int64, device);
+    Tensor strided = Tensor::Empty({7, 517, 3}, Dtype::Int64, device)
+                             .Permute({2, 1, 0});
+    strided.AsRvalue() = src;
+    ASSERT_FALSE(strided.IsContiguous());
+    for (const SizeVector& dims :
+         std::vector<SizeVector>{{0}, {1}, {2}, {0, 1}, {1, 2}, {0, 1, 2}}) {
+        for (bool keepdim : {true, false}) {
+            EXPECT_EQ(src.Sum(dims, keepdim).ToString(false),
+                      strided.Sum(dims, keepdim).ToString(false));
+            EXPECT_EQ(src.Min(dims, keepdim).ToString(false),
+                      strided.Min(dims, keepdim).ToString(false));
+            EXPECT_EQ(src.Max(dims, keepdim).ToString(false),
+                      strided.Max(dims, keepdim).ToString(false));
+        }
+    }
+    Tensor ones_and_twos = src.Abs() + Tensor::Ones({}, Dtype::Int64, device);
+    EXPECT_EQ(ones_and_twos.Slice(1, 0, 40).Contiguous().Prod({1}).ToString(
+                      false),
+              ones_and_twos.Permute({1, 0, 2})
+                      .Slice(0, 0, 40)
+                      .Prod({0})
+                      .ToString(false));
+
+    // Pairwise summation keeps float32 sums accurate, where accumulating
+    // serially gives about 100958.
+    Tensor tenths = Tensor::Full({1000000}, 0.1f, Dtype::Float32, device);
+    EXPECT_NEAR(tenths.Sum({0}).Item<float>(), 100000.f, 1.f);
+    EXPECT_NEAR(tenths.Reshape({1000, 1000}).Sum({0}).Mean({0}).Item<float>(),
+                100.f, 1e-3f);
+
+    // Float16 is accumulated in float.
+    Tensor halves = Tensor::Full({4000}, 0.1f, Dtype::Float16, device);
+    EXPECT_NEAR(float(halves.Sum({0}).Item<Half>()), 399.9f, 0.2f);
+}
+
+TEST_P(TensorPermuteDevices, ReduceDeterministic) {
+    Device device = GetParam();
+
+    std::vector<float> vals(3 * 200000);
+    for (float& v : vals) {
+        v = static_cast<float>(utility::UniformRandInt(0, 1000000)) / 7.f;
+    }
+    Tensor src(vals, {3, 200000}, Dtype::Float32, device);
+    Tensor src_t = src.T();
+    auto reduce_all = [&]() {
+        return std::vector<Tensor>{src.Sum({0, 1}), src.Sum({1}),
+                                   src_t.Sum({0}), src_t.Sum({0, 1})};
+    };
+
+    kernel::SetDeterministicReduction(true);
+    kernel::parallel_util::SetNumThreads(1);
+    std::vector<Tensor> expected = reduce_all();
+    for (int num_threads : {2, 3, 4, 7}) {
+        kernel::parallel_util::SetNumThreads(num_threads);
+        std::vector<Tensor> results = reduce_all();
+        for (size_t i = 0; i < results.size(); ++i) {
+            EXPECT_EQ(results[i].ToFlatVector<float>(),
+                      expected[i].ToFlatVector<float>());
+        }
+    }
+    kernel::parallel_util::SetNumThreads(0);
+    kernel::SetDeterministicReduction(false);
+}
+
 TEST_P(TensorPermuteDevices, ReduceProd) {
     Device device = GetParam();
     Tensor src(
@@ -1859,6 +2200,64 @@ TEST_P(TensorPermuteDevices, Abs) {
     EXPECT_EQ(src.ToFlatVector<float>(), dst_vals);
 }
 
+TEST_P(TensorPermuteDevices, Floor) {
+    Device device = GetParam();
+
+    std::vector<float> src_vals{-2.5, -1, -0.5, 0.5, 1, 2.7};
+    std::vector<float> dst_vals;
+    std::transform(src_vals.begin(), src_vals.end(),
+                   std::back_inserter(dst_vals),
+                   [](float v) -> float { return std::floor(v); });
+
+    Tensor src(src_vals, {2, 3}, Dtype::Float32, device);
+    Tensor dst = src.Floor();
+    EXPECT_EQ(dst.ToFlatVector<float>(), dst_vals);
+
+    // Non-contiguous input.
+    EXPECT_EQ(src.T().Floor().ToFlatVector<float>(),
+              src.T().Contiguous().Floor().ToFlatVector<float>());
+
+    // Inplace version.
+    src.Floor_();
+    EXPECT_EQ(src.ToFlatVector<float>(), dst_vals);
+
+    // Integer types are unchanged.
+    Tensor src_int(std::vector<int32_t>{-3, 0, 5}, {3}, Dtype::Int32, device);
+    EXPECT_EQ(src_int.Floor().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-3, 0, 5}));
+    src_int.Floor_();
+    EXPECT_EQ(src_int.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-3, 0, 5}));
+
+    // Large integers are not rounded through floating point.
+    int64_t big = (int64_t(1) << 53) + 1;
+    Tensor src_big(std::vector<int64_t>{big, -big}, {2}, Dtype::Int64, device);
+    EXPECT_EQ(src_big.Floor().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({big, -big}));
+}
+
+TEST_P(TensorPermuteDevices, Log) {
+    Device device = GetParam();
+
+    std::vector<float> src_vals{0.5, 1, 2, 3, 4, 5};
+    std::vector<float> dst_vals;
+    std::transform(src_vals.begin(), src_vals.end(),
+                   std::back_inserter(dst_vals),
+                   [](float v) -> float { return std::log(v); });
+
+    Tensor src(src_vals, {2, 3}, Dtype::Float32, device);
+    Tensor dst = src.Log();
+    EXPECT_EQ(dst.ToFlatVector<float>(), dst_vals);
+
+    // Inplace version.
+    src.Log_();
+    EXPECT_EQ(src.ToFlatVector<float>(), dst_vals);
+
+    // Only works for float types, throws exception otherwise.
+    src = Tensor({2, 3}, Dtype::Int32, device);
+    EXPECT_THROW(src.Log(), std::runtime_error);
+}
+
 TEST_P(TensorPermuteDevices, LogicalNot) {
     Device device = GetParam();
 
@@ -2127,6 +2526,201 @@ TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     EXPECT_EQ(results[1].GetShape(), SizeVector{3});
 }
 
+TEST_P(TensorPermuteDevices, NonZeroLarge) {
+    Device device = GetParam();
+
+    // Chunks are counted and scattered in parallel.
+    kernel::parallel_util::SetNumThreads(4);
+    SizeVector shape{7, 300, 100};
+    int64_t n = shape.NumElements();
+    std::vector<int32_t> vals(n);
+    std::vector<std::vector<int64_t>> expected(3);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = (i * 7919) % 5 == 0 ? -static_cast<int32_t>(i) : 0;
+        if (vals[i] != 0) {
+            expected[0].push_back(i / 30000);
+            expected[1].push_back(i / 100 % 300);
+            expected[2].push_back(i % 100);
+        }
+    }
+    Tensor a(vals, shape, Dtype::Int32, device);
+    std::vector<Tensor> results = a.NonZeroNumpy();
+    for (int64_t dim = 0; dim < 3; ++dim) {
+        EXPECT_EQ(results[dim].ToFlatVector<int64_t>(), expected[dim]);
+    }
+
+    // Non-contiguous input.
+    results = a.Permute({2, 0, 1}).NonZeroNumpy();
+    EXPECT_EQ(results[0].NumElements(),
+              static_cast<int64_t>(expected[0].size()));
+    kernel::parallel_util::SetNumThreads(0);
+
+    EXPECT_EQ(Tensor::Zeros({0, 3}, Dtype::Float32, device)
+                      .NonZero()
+                      .GetShape(),
+              SizeVector({2, 0}));
+}
+
+TEST_P(TensorPermuteDevices, MaskedSelect) {
+    Device device = GetParam();
+
+    Tensor a(std::vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}, {4, 3},
+             Dtype::Float32, device);
+    Tensor row_mask(std::vector<bool>{true, false, false, true}, {4},
+                    Dtype::Bool, device);
+    Tensor b = a.MaskedSelect(row_mask);
+    EXPECT_EQ(b.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(b.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 9, 10, 11}));
+
+    // Element mask over all dimensions, on a non-contiguous tensor.
+    Tensor at = a.T();
+    Tensor element_mask =
+            at.Gt(Tensor::Full({3, 4}, 4.f, Dtype::Float32, device));
+    b = at.MaskedSelect(element_mask);
+    EXPECT_EQ(b.ToFlatVector<float>(),
+              std::vector<float>({6, 9, 7, 10, 5, 8, 11}));
+    EXPECT_EQ(at.IndexGet({element_mask}).ToFlatVector<float>(),
+              b.ToFlatVector<float>());
+
+    // Many rows, selected in parallel and through IndexGet.
+    kernel::parallel_util::SetNumThreads(4);
+    int64_t n = 200000;
+    std::vector<int64_t> vals(n * 2);
+    std::vector<bool> mask_vals(n);
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < n; ++i) {
+        vals[2 * i] = i;
+        vals[2 * i + 1] = -i;
+        mask_vals[i] = i % 3 == 1;
+        if (mask_vals[i]) {
+            expected.push_back(i);
+            expected.push_back(-i);
+        }
+    }
+    Tensor mask(mask_vals, {n}, Dtype::Bool, device);
+    EXPECT_EQ(Tensor(vals, {n, 2}, Dtype::Int64, device)
+                      .IndexGet({mask})
+                      .ToFlatVector<int64_t>(),
+              expected);
+    kernel::parallel_util::SetNumThreads(0);
+
+    EXPECT_EQ(a.MaskedSelect(Tensor::Zeros({4}, Dtype::Bool, device))
+                      .GetShape(),
+              SizeVector({0, 3}));
+    EXPECT_THROW(a.MaskedSelect(Tensor::Zeros({3}, Dtype::Bool, device)),
+                 std::runtime_error);
+    EXPECT_THROW(a.MaskedSelect(Tensor::Zeros({4}, Dtype::UInt8, device)),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, IndexGetSetRows) {
+    Device device = GetParam();
+
+    Tensor points(std::vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+                  {4, 3}, Dtype::Float32, device);
+    Tensor index(std::vector<int64_t>{3, -4, 1, 3}, {4}, Dtype::Int64, device);
+    EXPECT_EQ(points.IndexGet({index}).ToFlatVector<float>(),
+              std::vector<float>({9, 10, 11, 0, 1, 2, 3, 4, 5, 9, 10, 11}));
+
+    // 2D index and rows with a non-default stride.
+    Tensor index_2d(std::vector<int64_t>{1, 0}, {2, 1}, Dtype::Int64, device);
+    Tensor every_other = points.Slice(0, 0, 4, 2);
+    Tensor rows = every_other.IndexGet({index_2d});
+    EXPECT_EQ(rows.GetShape(), SizeVector({2, 1, 3}));
+    EXPECT_EQ(rows.ToFlatVector<float>(),
+              std::vector<float>({6, 7, 8, 0, 1, 2}));
+
+    Tensor values(std::vector<float>{-1, -2, -3, -4, -5, -6}, {2, 3},
+                  Dtype::Float32, device);
+    Tensor set_index(std::vector<int64_t>{-1, 1}, {2}, Dtype::Int64, device);
+    every_other.IndexSet({set_index}, values);
+    EXPECT_EQ(points.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5, -4, -5, -6, 9, 10, 11}));
+
+    EXPECT_THROW(points.IndexGet({Tensor(std::vector<int64_t>{4}, {1},
+                                         Dtype::Int64, device)}),
+                 std::runtime_error);
+    EXPECT_THROW(points.IndexSet({Tensor(std::vector<int64_t>{-5}, {1},
+                                         Dtype::Int64, device)},
+                                 Tensor::Ones({1, 3}, Dtype::Float32, device)),
+                 std::runtime_error);
+
+    // Many rows in parallel.
+    kernel::parallel_util::SetNumThreads(4);
+    int64_t n = 100000;
+    std::vector<int64_t> vals(n * 3);
+    std::vector<int64_t> index_vals(n);
+    std::vector<int64_t> expected(n * 3);
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t k = 0; k < 3; ++k) {
+            vals[3 * i + k] = 3 * i + k;
+        }
+        index_vals[i] = (i * 7919) % n;
+        for (int64_t k = 0; k < 3; ++k) {
+            expected[3 * i + k] = 3 * index_vals[i] + k;
+        }
+    }
+    Tensor large(vals, {n, 3}, Dtype::Int64, device);
+    Tensor large_index(index_vals, {n}, Dtype::Int64, device);
+    EXPECT_EQ(large.IndexGet({large_index}).ToFlatVector<int64_t>(),
+              expected);
+    kernel::parallel_util::SetNumThreads(0);
+}
+
+TEST_P(TensorPermuteDevices, IndexAdd) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        Tensor dst = Tensor::Zeros({3, 2}, Dtype::Float32, device);
+        Tensor index = Tensor::Zeros({1}, Dtype::Int64, device);
+        Tensor src = Tensor::Ones({1, 2}, Dtype::Float32, device);
+        EXPECT_THROW(dst.IndexAdd_(index, src), std::runtime_error);
+        return;
+    }
+
+    Tensor dst = Tensor::Zeros({3, 2}, Dtype::Float32, device);
+    Tensor index(std::vector<int64_t>{2, 0, 2, -1}, {4}, Dtype::Int64, device);
+    Tensor src(std::vector<float>{1, 2, 3, 4, 5, 6, 7, 8}, {4, 2},
+               Dtype::Float32, device);
+    dst.IndexAdd_(index, src);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({3, 4, 0, 0, 13, 16}));
+
+    // Non-contiguous destination.
+    Tensor dst_t = Tensor::Zeros({2, 3}, Dtype::Float32, device).T();
+    dst_t.IndexAdd_(index, src);
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({3, 4, 0, 0, 13, 16}));
+
+    EXPECT_THROW(dst.IndexAdd_(index, Tensor::Ones({3, 2}, Dtype::Float32,
+                                                   device)),
+                 std::runtime_error);
+    EXPECT_THROW(dst.IndexAdd_(Tensor(std::vector<int64_t>{3}, {1},
+                                      Dtype::Int64, device),
+                               Tensor::Ones({1, 2}, Dtype::Float32, device)),
+                 std::runtime_error);
+
+    // Many duplicates accumulated in parallel, e.g. points into voxels.
+    kernel::parallel_util::SetNumThreads(4);
+    int64_t n = 200000;
+    int64_t num_bins = 1000;
+    std::vector<int64_t> index_vals(n);
+    std::vector<int64_t> src_vals(n * 2);
+    std::vector<int64_t> expected(num_bins * 2, 0);
+    for (int64_t i = 0; i < n; ++i) {
+        index_vals[i] = (i * 7919) % num_bins;
+        src_vals[2 * i] = i;
+        src_vals[2 * i + 1] = 1;
+        expected[2 * index_vals[i]] += i;
+        expected[2 * index_vals[i] + 1] += 1;
+    }
+    Tensor bins = Tensor::Zeros({num_bins, 2}, Dtype::Int64, device);
+    bins.IndexAdd_(Tensor(index_vals, {n}, Dtype::Int64, device),
+                   Tensor(src_vals, {n, 2}, Dtype::Int64, device));
+    kernel::parallel_util::SetNumThreads(0);
+    EXPECT_EQ(bins.ToFlatVector<int64_t>(), expected);
+}
+
 TEST_P(TensorPermuteDevices, CreationEmpty) {
     Device device = GetParam();
 
@@ -2380,5 +2974,734 @@ TEST_P(TensorPermuteDevices, ReduceMean) {
     EXPECT_TRUE(std::isnan(dst.ToFlatVector<float>()[0]));
 }
 
+TEST_P(TensorPermuteDevices, Matmul) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        Tensor a = Tensor::Ones({2, 2}, Dtype::Float32, device);
+        EXPECT_THROW(a.Matmul(a), std::runtime_error);
+        return;
+    }
+
+    // Reference matrix product of row-major (m, k) and (k, n) matrices.
+    auto naive_matmul = [](const std::vector<double>& a,
+                           const std::vector<double>& b, int64_t m, int64_t k,
+                           int64_t n) {
+        std::vector<double> c(m * n, 0);
+        for (int64_t i = 0; i < m; ++i) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t l = 0; l < k; ++l) {
+                    c[i * n + j] += a[i * k + l] * b[l * n + j];
+                }
+            }
+        }
+        return c;
+    };
+
+    // 2D.
+    Tensor a(std::vector<float>{1, 2, 3, 4, 5, 6}, {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>{1, 0, 0, 1, 1, 1}, {3, 2}, Dtype::Float32,
+             device);
+    Tensor c = a.Matmul(b);
+    EXPECT_EQ(c.GetShape(), SizeVector({2, 2}));
+    EXPECT_EQ(c.ToFlatVector<float>(), std::vector<float>({4, 5, 10, 11}));
+
+    // Integer dtypes.
+    Tensor a_int = a.To(Dtype::Int32);
+    Tensor b_int = b.To(Dtype::Int32);
+    EXPECT_EQ(a_int.Matmul(b_int).ToFlatVector<int>(),
+              std::vector<int>({4, 5, 10, 11}));
+
+    // Non-contiguous inputs.
+    Tensor a_t(std::vector<float>{1, 4, 2, 5, 3, 6}, {3, 2}, Dtype::Float32,
+               device);
+    EXPECT_EQ(a_t.T().Matmul(b).ToFlatVector<float>(),
+              std::vector<float>({4, 5, 10, 11}));
+
+    // Sizes larger than one cache block, with a batched lhs and 2D rhs.
+    int64_t m = 70, k = 150, n = 260;
+    std::vector<double> a_vals(2 * m * k);
+    std::vector<double> b_vals(k * n);
+    for (size_t i = 0; i < a_vals.size(); ++i) {
+        a_vals[i] = static_cast<double>(i % 7) - 3;
+    }
+    for (size_t i = 0; i < b_vals.size(); ++i) {
+        b_vals[i] = static_cast<double>(i % 5) - 2;
+    }
+    Tensor a_big(a_vals, {2, m, k}, Dtype::Float64, device);
+    Tensor b_big(b_vals, {k, n}, Dtype::Float64, device);
+    Tensor c_big = a_big.Matmul(b_big);
+    EXPECT_EQ(c_big.GetShape(), SizeVector({2, m, n}));
+    std::vector<double> c_ref = naive_matmul(a_vals, b_vals, 2 * m, k, n);
+    EXPECT_EQ(c_big.ToFlatVector<double>(), c_ref);
+
+    // Batched square matrices of the fixed (3, 4, 6) and dynamic (5) sizes,
+    // with a broadcasted batch dimension.
+    for (int64_t size : {3, 4, 5, 6}) {
+        std::vector<double> lhs_vals(4 * size * size);
+        std::vector<double> rhs_vals(size * size);
+        for (size_t i = 0; i < lhs_vals.size(); ++i) {
+            lhs_vals[i] = static_cast<double>(i % 11) - 5;
+        }
+        for (size_t i = 0; i < rhs_vals.size(); ++i) {
+            rhs_vals[i] = static_cast<double>(i % 3) + 1;
+        }
+        Tensor lhs(lhs_vals, {4, size, size}, Dtype::Float64, device);
+        Tensor rhs(rhs_vals, {1, size, size}, Dtype::Float64, device);
+        Tensor dst = lhs.Matmul(rhs);
+        EXPECT_EQ(dst.GetShape(), SizeVector({4, size, size}));
+        EXPECT_EQ(dst.ToFlatVector<double>(),
+                  naive_matmul(lhs_vals, rhs_vals, 4 * size, size, size));
+    }
+
+    // Incompatible shapes and dtypes.
+    EXPECT_THROW(a.Matmul(a), std::runtime_error);
+    EXPECT_THROW(a.Matmul(Tensor::Ones({3}, Dtype::Float32, device)),
+                 std::runtime_error);
+    EXPECT_THROW(a.Matmul(b_int), std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, InverseSolveSymmetricEigen) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        Tensor a = Tensor::Ones({3, 3}, Dtype::Float32, device);
+        EXPECT_THROW(a.Inverse(), std::runtime_error);
+        EXPECT_THROW(a.Solve(a), std::runtime_error);
+        EXPECT_THROW(a.SymmetricEigen(), std::runtime_error);
+        return;
+    }
+
+    auto expect_near = [](const Tensor& t, const std::vector<double>& ref,
+                          double tol) {
+        std::vector<double> vals = t.To(Dtype::Float64).ToFlatVector<double>();
+        ASSERT_EQ(vals.size(), ref.size());
+        for (size_t i = 0; i < vals.size(); ++i) {
+            EXPECT_NEAR(vals[i], ref[i], tol);
+        }
+    };
+
+    // Batches of diagonally dominant symmetric matrices of the fixed (3, 4, 6)
+    // and dynamic (5) sizes.
+    for (int64_t size : {3, 4, 5, 6}) {
+        int64_t batch = 3;
+        std::vector<double> a_vals(batch * size * size);
+        std::vector<double> eye_vals(batch * size * size, 0);
+        for (int64_t b = 0; b < batch; ++b) {
+            for (int64_t i = 0; i < size; ++i) {
+                for (int64_t j = 0; j < size; ++j) {
+                    a_vals[(b * size + i) * size + j] =
+                            i == j ? 10.0 + b + i
+                                   : 1.0 / static_cast<double>(1 + i + j);
+                }
+                eye_vals[(b * size + i) * size + i] = 1;
+            }
+        }
+        Tensor a(a_vals, {batch, size, size}, Dtype::Float64, device);
+
+        Tensor a_inv = a.Inverse();
+        EXPECT_EQ(a_inv.GetShape(), SizeVector({batch, size, size}));
+        expect_near(a.Matmul(a_inv), eye_vals, 1e-10);
+
+        Tensor b = Tensor::Ones({batch, size, 2}, Dtype::Float64, device);
+        Tensor x = a.Solve(b);
+        EXPECT_EQ(x.GetShape(), SizeVector({batch, size, 2}));
+        expect_near(a.Matmul(x), b.ToFlatVector<double>(), 1e-10);
+
+        Tensor eigenvalues, eigenvectors;
+        std::tie(eigenvalues, eigenvectors) = a.SymmetricEigen();
+        EXPECT_EQ(eigenvalues.GetShape(), SizeVector({batch, size}));
+        EXPECT_EQ(eigenvectors.GetShape(), SizeVector({batch, size, size}));
+        // A V = V diag(lambda), where diag(lambda) is applied by broadcasting
+        // the eigenvalues over the rows of V.
+        Tensor v_lambda = eigenvectors * eigenvalues.Reshape({batch, 1, size});
+        expect_near(a.Matmul(eigenvectors), v_lambda.ToFlatVector<double>(),
+                    1e-10);
+        std::vector<double> values = eigenvalues.ToFlatVector<double>();
+        for (int64_t i = 1; i < size; ++i) {
+            EXPECT_LE(values[i - 1], values[i]);
+        }
+
+        // Float32 goes through the same kernels.
+        Tensor a_float = a.To(Dtype::Float32);
+        expect_near(a_float.Matmul(a_float.Inverse()), eye_vals, 1e-5);
+    }
+
+    // Non-square, mismatched and integer inputs.
+    Tensor a = Tensor::Ones({2, 3}, Dtype::Float32, device);
+    EXPECT_THROW(a.Inverse(), std::runtime_error);
+    EXPECT_THROW(a.SymmetricEigen(), std::runtime_error);
+    Tensor sq = Tensor::Ones({3, 3}, Dtype::Float32, device);
+    EXPECT_THROW(sq.Solve(Tensor::Ones({2, 1}, Dtype::Float32, device)),
+                 std::runtime_error);
+    EXPECT_THROW(sq.Solve(Tensor::Ones({3, 1}, Dtype::Float64, device)),
+                 std::runtime_error);
+    EXPECT_THROW(Tensor::Ones({3, 3}, Dtype::Int32, device).Inverse(),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, Cumsum) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        Tensor src = Tensor::Ones({2, 3}, Dtype::Int32, device);
+        EXPECT_THROW(src.Cumsum(0), std::runtime_error);
+        EXPECT_THROW(src.Cumprod(0), std::runtime_error);
+        return;
+    }
+
+    Tensor src(std::vector<int32_t>({1, 2, 3, 4, 5, 6}), {2, 3}, Dtype::Int32,
+               device);
+    EXPECT_EQ(src.Cumsum(0).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, 3, 5, 7, 9}));
+    EXPECT_EQ(src.Cumsum(1).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 3, 6, 4, 9, 15}));
+    EXPECT_EQ(src.Cumsum(-1, true).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 3, 0, 4, 9}));
+    EXPECT_EQ(src.Cumprod(1).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, 6, 4, 20, 120}));
+    EXPECT_EQ(src.Cumprod(0, true).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 1, 1, 1, 2, 3}));
+
+    // Non-contiguous input.
+    EXPECT_EQ(src.T().Cumsum(0).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 4, 3, 9, 6, 15}));
+
+    // 0-D and empty tensors.
+    EXPECT_EQ(Tensor::Full({}, 5, Dtype::Float32, device)
+                      .Cumsum(0)
+                      .ToFlatVector<float>(),
+              std::vector<float>({5}));
+    EXPECT_EQ(Tensor::Ones({0, 3}, Dtype::Float32, device)
+                      .Cumsum(0)
+                      .GetShape(),
+              SizeVector({0, 3}));
+
+    EXPECT_THROW(src.Cumsum(2), std::runtime_error);
+    EXPECT_THROW(Tensor::Ones({3}, Dtype::Bool, device).Cumsum(0),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, CumsumLarge) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        return;
+    }
+
+    // Few long lines go through the two-pass parallel scan.
+    kernel::parallel_util::SetNumThreads(4);
+    int64_t n = 300001;
+    std::vector<int64_t> vals(2 * n);
+    for (int64_t i = 0; i < 2 * n; ++i) {
+        vals[i] = i % 5 - 2;
+    }
+    Tensor src(vals, {n, 2}, Dtype::Int64, device);
+    std::vector<int64_t> expected(2 * n);
+    std::vector<int64_t> expected_exclusive(2 * n);
+    for (int64_t c = 0; c < 2; ++c) {
+        int64_t sum = 0;
+        for (int64_t r = 0; r < n; ++r) {
+            expected_exclusive[r * 2 + c] = sum;
+            sum += vals[r * 2 + c];
+            expected[r * 2 + c] = sum;
+        }
+    }
+    EXPECT_EQ(src.Cumsum(0).ToFlatVector<int64_t>(), expected);
+    EXPECT_EQ(src.Cumsum(0, true).ToFlatVector<int64_t>(), expected_exclusive);
+    EXPECT_EQ(src.Reshape({2 * n}).Cumsum(0).ToFlatVector<int64_t>().back(),
+              expected[2 * n - 2] + expected[2 * n - 1]);
+    kernel::parallel_util::SetNumThreads(0);
+}
+
+TEST_P(TensorPermuteDevices, SegmentReduction) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        Tensor prefix_sum = Tensor::Zeros({1}, Dtype::Int64, device);
+        EXPECT_THROW(Tensor::Ones({2, 2}, Dtype::Float32, device)
+                             .SegmentSum(prefix_sum),
+                     std::runtime_error);
+        return;
+    }
+
+    // Segments [0, 2), [2, 2), [2, 5), [5, 6).
+    Tensor prefix_sum(std::vector<int64_t>({0, 2, 2, 5}), {4}, Dtype::Int64,
+                      device);
+    Tensor values(std::vector<float>({1, -1, 2, -2, 3, -3, 0, 0, 2, -2, 4, -4}),
+                  {6, 2}, Dtype::Float32, device);
+    EXPECT_EQ(values.SegmentSum(prefix_sum).GetShape(), SizeVector({4, 2}));
+    EXPECT_EQ(values.SegmentSum(prefix_sum).ToFlatVector<float>(),
+              std::vector<float>({3, -3, 0, 0, 5, -5, 4, -4}));
+    EXPECT_EQ(values.SegmentMean(prefix_sum).ToFlatVector<float>(),
+              std::vector<float>({1.5, -1.5, 0, 0, 5.f / 3, -5.f / 3, 4, -4}));
+    EXPECT_EQ(values.SegmentMin(prefix_sum).ToFlatVector<float>(),
+              std::vector<float>({1, -2, 0, 0, 0, -3, 4, -4}));
+    EXPECT_EQ(values.SegmentMax(prefix_sum).ToFlatVector<float>(),
+              std::vector<float>({2, -1, 0, 0, 3, 0, 4, -4}));
+    // Ties resolve to the first row.
+    EXPECT_EQ(values.SegmentArgMin(prefix_sum).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, -1, -1, 3, 2, 5, 5}));
+    EXPECT_EQ(values.SegmentArgMax(prefix_sum).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 0, -1, -1, 2, 3, 5, 5}));
+
+    // Integer values.
+    EXPECT_EQ(values.To(Dtype::Int32)
+                      .SegmentSum(prefix_sum)
+                      .ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, -3, 0, 0, 5, -5, 4, -4}));
+
+    // Invalid prefix sums.
+    EXPECT_THROW(values.SegmentSum(prefix_sum.To(Dtype::Int32)),
+                 std::runtime_error);
+    EXPECT_THROW(values.SegmentSum(Tensor(std::vector<int64_t>({1, 2}), {2},
+                                          Dtype::Int64, device)),
+                 std::runtime_error);
+    EXPECT_THROW(values.SegmentSum(Tensor(std::vector<int64_t>({0, 3, 2}), {3},
+                                          Dtype::Int64, device)),
+                 std::runtime_error);
+    EXPECT_THROW(values.SegmentSum(Tensor(std::vector<int64_t>({0, 7}), {2},
+                                          Dtype::Int64, device)),
+                 std::runtime_error);
+    EXPECT_THROW(values.To(Dtype::Int32).SegmentMean(prefix_sum),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, SegmentReductionLarge) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        return;
+    }
+
+    // A long segment spanning many tasks, followed by many short and empty
+    // segments.
+    kernel::parallel_util::SetNumThreads(4);
+    int64_t n = 500000;
+    std::vector<int64_t> vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = (i * 7919) % 10007;
+    }
+    std::vector<int64_t> offsets{0};
+    for (int64_t begin = n / 2; begin < n; begin += offsets.size() % 3) {
+        offsets.push_back(begin);
+    }
+    int64_t num_segments = static_cast<int64_t>(offsets.size());
+    Tensor values(vals, {n}, Dtype::Int64, device);
+    Tensor prefix_sum(offsets, {num_segments}, Dtype::Int64, device);
+
+    std::vector<int64_t> sums = values.SegmentSum(prefix_sum)
+                                        .ToFlatVector<int64_t>();
+    std::vector<int64_t> arg_maxs = values.SegmentArgMax(prefix_sum)
+                                            .ToFlatVector<int64_t>();
+    for (int64_t s = 0; s < num_segments; ++s) {
+        int64_t begin = offsets[s];
+        int64_t end = s + 1 < num_segments ? offsets[s + 1] : n;
+        int64_t sum = 0;
+        int64_t arg_max = -1;
+        for (int64_t i = begin; i < end; ++i) {
+            sum += vals[i];
+            if (arg_max < 0 || vals[i] > vals[arg_max]) {
+                arg_max = i;
+            }
+        }
+        EXPECT_EQ(sums[s], sum);
+        EXPECT_EQ(arg_maxs[s], arg_max);
+    }
+    kernel::parallel_util::SetNumThreads(0);
+}
+
+TEST_P(TensorPermuteDevices, SortArgSort) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        Tensor src = Tensor::Ones({2, 3}, Dtype::Float32, device);
+        EXPECT_THROW(src.Sort(), std::runtime_error);
+        EXPECT_THROW(src.ArgSort(), std::runtime_error);
+        return;
+    }
+
+    Tensor src(std::vector<float>{3, 1, 2, 1, 0, 5}, {2, 3}, Dtype::Float32,
+               device);
+    EXPECT_EQ(src.Sort().ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3, 0, 1, 5}));
+    EXPECT_EQ(src.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 2, 0, 1, 0, 2}));
+    EXPECT_EQ(src.Sort(0).ToFlatVector<float>(),
+              std::vector<float>({1, 0, 2, 3, 1, 5}));
+    EXPECT_EQ(src.ArgSort(0).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 1, 0, 0, 0, 1}));
+    EXPECT_EQ(src.Sort(1, true).ToFlatVector<float>(),
+              std::vector<float>({3, 2, 1, 5, 1, 0}));
+
+    // Non-contiguous input.
+    EXPECT_EQ(src.T().Sort(0).ToFlatVector<float>(),
+              std::vector<float>({1, 0, 2, 1, 3, 5}));
+
+    // Stable, also in descending order.
+    Tensor ties(std::vector<int32_t>{2, -1, 2, -1, 2}, {5}, Dtype::Int32,
+                device);
+    EXPECT_EQ(ties.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 0, 2, 4}));
+    EXPECT_EQ(ties.ArgSort(0, true).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 4, 1, 3}));
+
+    // NaNs are sorted last, -0.0 and 0.0 are equal.
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    float inf = std::numeric_limits<float>::infinity();
+    Tensor floats(std::vector<float>{nan, 0.f, -inf, -0.f, inf, -2.5f}, {6},
+                  Dtype::Float32, device);
+    EXPECT_EQ(floats.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 5, 1, 3, 4, 0}));
+    EXPECT_EQ(floats.ArgSort(0, true).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({4, 1, 3, 5, 2, 0}));
+    Tensor doubles(std::vector<double>{1, nan, -1, nan, 2}, {5},
+                   Dtype::Float64, device);
+    EXPECT_EQ(doubles.ArgSort(0, true).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({4, 0, 2, 1, 3}));
+
+    Tensor bools(std::vector<bool>{true, false, true, false}, {4},
+                 Dtype::Bool, device);
+    EXPECT_EQ(bools.Sort().ToFlatVector<bool>(),
+              std::vector<bool>({false, false, true, true}));
+
+    Tensor bytes(std::vector<uint8_t>{200, 3, 255, 0}, {4}, Dtype::UInt8,
+                 device);
+    EXPECT_EQ(bytes.Sort(0, true).ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({255, 200, 3, 0}));
+
+    EXPECT_EQ(Tensor::Ones({}, Dtype::Float64, device).Sort().GetShape(),
+              SizeVector({}));
+    EXPECT_EQ(Tensor::Ones({0, 3}, Dtype::Float64, device).Sort(0).GetShape(),
+              SizeVector({0, 3}));
+    EXPECT_THROW(src.Sort(2), std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, SortLarge) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        return;
+    }
+
+    // Long lines use the parallel radix sort, many lines are sorted in
+    // parallel.
+    kernel::parallel_util::SetNumThreads(4);
+    for (const SizeVector& shape : {SizeVector{200000}, SizeVector{64, 3000}}) {
+        int64_t n = shape.NumElements();
+        int64_t len = shape[shape.size() - 1];
+        std::vector<int64_t> int_vals(n);
+        std::vector<double> double_vals(n);
+        for (int64_t i = 0; i < n; ++i) {
+            int_vals[i] = ((i * 7919) % 10007 - 5000) * 1000003;
+            double_vals[i] = static_cast<double>((i * 7919) % 10007) / 7 - 700;
+        }
+        Tensor ints(int_vals, shape, Dtype::Int64, device);
+        Tensor doubles(double_vals, shape, Dtype::Float64, device);
+        std::vector<int64_t> int_indices =
+                ints.ArgSort().ToFlatVector<int64_t>();
+        std::vector<int64_t> double_indices =
+                doubles.ArgSort(-1, true).ToFlatVector<int64_t>();
+        for (int64_t line = 0; line < n / len; ++line) {
+            std::vector<int64_t> expected(len);
+            std::iota(expected.begin(), expected.end(), 0);
+            const int64_t* ip = int_vals.data() + line * len;
+            std::stable_sort(expected.begin(), expected.end(),
+                             [&](int64_t a, int64_t b) {
+                                 return ip[a] < ip[b];
+                             });
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                                   int_indices.begin() + line * len));
+
+            std::iota(expected.begin(), expected.end(), 0);
+            const double* dp = double_vals.data() + line * len;
+            std::stable_sort(expected.begin(), expected.end(),
+                             [&](int64_t a, int64_t b) {
+                                 return dp[a] > dp[b];
+                             });
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                                   double_indices.begin() + line * len));
+        }
+    }
+
+    // NaNs are sorted last by the radix sort in both orders.
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> float_vals(3000);
+    for (int64_t i = 0; i < 3000; ++i) {
+        float_vals[i] =
+                i % 3 == 0 ? nan : static_cast<float>((i * 7919) % 10007);
+    }
+    Tensor floats(float_vals, {3000}, Dtype::Float32, device);
+    for (bool descending : {false, true}) {
+        std::vector<float> sorted =
+                floats.Sort(0, descending).ToFlatVector<float>();
+        EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.begin() + 2000,
+                                   [&](float a, float b) {
+                                       return descending ? a > b : a < b;
+                                   }));
+        EXPECT_TRUE(std::all_of(sorted.begin() + 2000, sorted.end(),
+                                [](float v) { return std::isnan(v); }));
+    }
+    kernel::parallel_util::SetNumThreads(0);
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        EXPECT_THROW(Tensor::Ones({6}, Dtype::Int32, device).Unique(),
+                     std::runtime_error);
+        return;
+    }
+
+    Tensor src(std::vector<int32_t>{3, 1, 3, -2, 1, 3}, {6}, Dtype::Int32,
+               device);
+    Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = src.Unique();
+    EXPECT_EQ(unique.ToFlatVector<int32_t>(), std::vector<int32_t>({-2, 1, 3}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 1, 2, 0, 1, 2}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 2, 3}));
+
+    // Unique rows in lexicographic order.
+    Tensor rows(std::vector<float>{1, 2, 0, 5, 1, 2, 1, 0, 0, 5},
+                {5, 2}, Dtype::Float32, device);
+    std::tie(unique, inverse, counts) = rows.Unique();
+    EXPECT_EQ(unique.GetShape(), SizeVector({3, 2}));
+    EXPECT_EQ(unique.ToFlatVector<float>(),
+              std::vector<float>({0, 5, 1, 0, 1, 2}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 2, 1, 0}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 1, 2}));
+
+    // Many rows with few distinct values use the parallel radix sort.
+    kernel::parallel_util::SetNumThreads(4);
+    int64_t n = 100000;
+    std::vector<int64_t> vals(n * 2);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[2 * i] = (i * 7919) % 13;
+        vals[2 * i + 1] = (i * 104729) % 7 - 3;
+    }
+    std::tie(unique, inverse, counts) =
+            Tensor(vals, {n, 2}, Dtype::Int64, device).Unique();
+    kernel::parallel_util::SetNumThreads(0);
+    EXPECT_EQ(unique.GetShape(), SizeVector({91, 2}));
+    std::vector<int64_t> unique_vals = unique.ToFlatVector<int64_t>();
+    std::vector<int64_t> inverse_vals = inverse.ToFlatVector<int64_t>();
+    std::vector<int64_t> count_vals = counts.ToFlatVector<int64_t>();
+    for (int64_t u = 0; u < 91; ++u) {
+        EXPECT_EQ(unique_vals[2 * u], u / 7);
+        EXPECT_EQ(unique_vals[2 * u + 1], u % 7 - 3);
+    }
+    std::vector<int64_t> expected_counts(91, 0);
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_EQ(unique_vals[2 * inverse_vals[i]], vals[2 * i]);
+        EXPECT_EQ(unique_vals[2 * inverse_vals[i] + 1], vals[2 * i + 1]);
+        expected_counts[inverse_vals[i]]++;
+    }
+    EXPECT_EQ(count_vals, expected_counts);
+
+    EXPECT_THROW(Tensor::Ones({}, Dtype::Int32, device).Unique(),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, TopK) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        EXPECT_THROW(Tensor::Ones({2, 4}, Dtype::Float32, device).TopK(2),
+                     std::runtime_error);
+        return;
+    }
+
+    Tensor src(std::vector<float>{3, 1, 4, 1, 5, 9, 2, 6}, {2, 4},
+               Dtype::Float32, device);
+    Tensor values, indices;
+    std::tie(values, indices) = src.TopK(2);
+    EXPECT_EQ(values.GetShape(), SizeVector({2, 2}));
+    EXPECT_EQ(values.ToFlatVector<float>(), std::vector<float>({4, 3, 9, 6}));
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 1, 3}));
+    std::tie(values, indices) = src.TopK(1, 0, false);
+    EXPECT_EQ(values.GetShape(), SizeVector({1, 4}));
+    EXPECT_EQ(values.ToFlatVector<float>(), std::vector<float>({3, 1, 2, 1}));
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 0, 1, 0}));
+
+    // Ties are resolved to the smallest index.
+    std::tie(values, indices) =
+            Tensor(std::vector<int32_t>{7, 8, 8, 7, 8}, {5}, Dtype::Int32,
+                   device)
+                    .TopK(4);
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 2, 4, 0}));
+
+    // NaNs are ranked after all other values.
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    Tensor nans(std::vector<float>{nan, 1, nan, 3, 2}, {5}, Dtype::Float32,
+                device);
+    EXPECT_EQ(nans.TopK(4).second.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({3, 4, 1, 0}));
+    EXPECT_EQ(nans.TopK(2, 0, false).second.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 4}));
+
+    // A long line is split into chunks of candidates.
+    kernel::parallel_util::SetNumThreads(4);
+    int64_t n = 300000;
+    std::vector<int64_t> vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = (i * 7919) % 100003;
+    }
+    std::tie(values, indices) = Tensor(vals, {n}, Dtype::Int64, device).TopK(5);
+    kernel::parallel_util::SetNumThreads(0);
+    std::vector<int64_t> expected(n);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&](int64_t a, int64_t b) { return vals[a] > vals[b]; });
+    expected.resize(5);
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(), expected);
+
+    EXPECT_EQ(src.TopK(0).first.GetShape(), SizeVector({2, 0}));
+    EXPECT_THROW(src.TopK(5), std::runtime_error);
+    EXPECT_THROW(src.TopK(-1), std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, MaximumMinimum) {
+    Device device = GetParam();
+
+    // Odd number of elements such that the vectorized loop and the scalar
+    // tail loop are both exercised.
+    int64_t n = 1001;
+    std::vector<float> a_vals(n);
+    std::vector<float> b_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        a_vals[i] = static_cast<float>(i % 17) - 8;
+        b_vals[i] = static_cast<float>(i % 11) - 5;
+    }
+    Tensor a(a_vals, {n}, Dtype::Float32, device);
+    Tensor b(b_vals, {n}, Dtype::Float32, device);
+    std::vector<float> max_vals = a.Maximum(b).ToFlatVector<float>();
+    std::vector<float> min_vals = a.Minimum(b).ToFlatVector<float>();
+    std::vector<float> max_scalar_vals = a.Maximum(0.f).ToFlatVector<float>();
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_EQ(max_vals[i], std::max(a_vals[i], b_vals[i]));
+        EXPECT_EQ(min_vals[i], std::min(a_vals[i], b_vals[i]));
+        EXPECT_EQ(max_scalar_vals[i], std::max(a_vals[i], 0.f));
+    }
+
+    // Broadcasted and strided.
+    Tensor c(std::vector<int32_t>{1, 5, 3, 4, 2, 6}, {2, 3}, Dtype::Int32,
+             device);
+    Tensor d(std::vector<int32_t>{3, 3}, {2, 1}, Dtype::Int32, device);
+    EXPECT_EQ(c.Maximum(d).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 5, 3, 4, 3, 6}));
+    EXPECT_EQ(c.T().Minimum(d.T()).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 3, 3, 2, 3, 3}));
+
+    // Inplace version.
+    c.Minimum_(d);
+    EXPECT_EQ(c.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 3, 3, 3, 2, 3}));
+}
+
+TEST_P(TensorPermuteDevices, Pow) {
+    Device device = GetParam();
+
+    Tensor a(std::vector<float>{1, 2, 3, 4, 9, 16}, {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>{2, 2, 2, 0.5, 0.5, 0.5}, {2, 3},
+             Dtype::Float32, device);
+    EXPECT_EQ(a.Pow(b).ToFlatVector<float>(),
+              std::vector<float>({1, 4, 9, 2, 3, 4}));
+    EXPECT_EQ(a.Pow(2.f).ToFlatVector<float>(),
+              std::vector<float>({1, 4, 9, 16, 81, 256}));
+
+    Tensor c(std::vector<int64_t>{2, 3, 4}, {3}, Dtype::Int64, device);
+    EXPECT_EQ(c.Pow(3).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({8, 27, 64}));
+
+    // Inplace version.
+    a.Pow_(b);
+    EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>({1, 4, 9, 2, 3, 4}));
+}
+
+TEST_P(TensorPermuteDevices, Clamp) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        EXPECT_THROW(Tensor::Ones({3}, Dtype::Float32, device).Clamp(0.f, 1.f),
+                     std::runtime_error);
+        return;
+    }
+
+    // Scalar bounds.
+    int64_t n = 1001;
+    std::vector<float> src_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        src_vals[i] = static_cast<float>(i % 23) * 0.5f - 5;
+    }
+    Tensor src(src_vals, {n}, Dtype::Float32, device);
+    std::vector<float> dst_vals = src.Clamp(-1.f, 2.5f).ToFlatVector<float>();
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_EQ(dst_vals[i], std::min(std::max(src_vals[i], -1.f), 2.5f));
+    }
+
+    // NaNs are propagated.
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> nan_vals =
+            Tensor(std::vector<float>{nan, 3, -3, nan, 0, nan, 1, 2, nan},
+                   {9}, Dtype::Float32, device)
+                    .Clamp(-1.f, 1.f)
+                    .ToFlatVector<float>();
+    EXPECT_TRUE(std::isnan(nan_vals[0]));
+    EXPECT_TRUE(std::isnan(nan_vals[8]));
+    EXPECT_EQ(nan_vals[1], 1);
+    EXPECT_EQ(nan_vals[2], -1);
+
+    // Broadcasted tensor bounds and a strided input.
+    Tensor a(std::vector<int32_t>{0, 5, 10, 15, 20, 25}, {2, 3}, Dtype::Int32,
+             device);
+    Tensor lo(std::vector<int32_t>{2, 12}, {2, 1}, Dtype::Int32, device);
+    Tensor hi(std::vector<int32_t>{8, 18, 28}, {3}, Dtype::Int32, device);
+    EXPECT_EQ(a.Clamp(lo, hi).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({2, 5, 10, 8, 18, 25}));
+    EXPECT_EQ(a.T().Clamp(lo.T(), hi.Reshape({3, 1})).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({2, 8, 5, 18, 10, 25}));
+
+    // Inplace version.
+    a.Clamp_(4, 16);
+    EXPECT_EQ(a.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({4, 5, 10, 15, 16, 16}));
+
+    EXPECT_THROW(a.Clamp(lo.To(Dtype::Float32), hi), std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, Where) {
+    Device device = GetParam();
+    if (device.GetType() != Device::DeviceType::CPU) {
+        Tensor a = Tensor::Ones({3}, Dtype::Float32, device);
+        EXPECT_THROW(Tensor::Where(a > a, a, a), std::runtime_error);
+        return;
+    }
+
+    Tensor depth(std::vector<float>{0.5, 2, 0, 3.5, 1, 6}, {2, 3},
+                 Dtype::Float32, device);
+    Tensor zero = Tensor::Zeros({}, Dtype::Float32, device);
+    Tensor min_depth = Tensor::Full({}, 0.8f, Dtype::Float32, device);
+    Tensor max_depth = Tensor::Full({}, 5.f, Dtype::Float32, device);
+    Tensor valid = (depth > min_depth).LogicalAnd(depth < max_depth);
+    EXPECT_EQ(Tensor::Where(valid, depth, zero).ToFlatVector<float>(),
+              std::vector<float>({0, 2, 0, 3.5, 1, 0}));
+
+    // Broadcasted condition and strided inputs.
+    Tensor cond(std::vector<bool>{true, false, true}, {3}, Dtype::Bool, device);
+    Tensor other = depth.Neg();
+    EXPECT_EQ(Tensor::Where(cond, depth.T().T(), other).ToFlatVector<float>(),
+              std::vector<float>({0.5, -2, 0, 3.5, -1, 6}));
+    EXPECT_EQ(Tensor::Where(cond.Reshape({3, 1}), depth.T(), other.T())
+                      .ToFlatVector<float>(),
+              std::vector<float>({0.5, 3.5, -2, -1, 0, 6}));
+
+    // Bool values.
+    Tensor t = Tensor::Full({3}, true, Dtype::Bool, device);
+    Tensor f = Tensor::Full({3}, false, Dtype::Bool, device);
+    EXPECT_EQ(Tensor::Where(cond, f, t).ToFlatVector<bool>(),
+              std::vector<bool>({false, true, false}));
+
+    EXPECT_THROW(Tensor::Where(depth, depth, zero), std::runtime_error);
+    EXPECT_THROW(Tensor::Where(valid, depth, zero.To(Dtype::Int32)),
+                 std::runtime_error);
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -0,0 +1,267 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/TensorExpr.h"
+
+#include <cmath>
+#include <vector>
+
+#include "Core/CoreTest.h"
+#include "UnitTest/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class TensorExprPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorExpr,
+                         TensorExprPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static void ExpectNear(const std::vector<float>& actual,
+                       const std::vector<float>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_NEAR(actual[i], expected[i], 1e-4 * (1 + std::abs(expected[i])));
+    }
+}
+
+TEST_P(TensorExprPermuteDevices, ElementWise) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>({1, 1, 1}), {3}, Dtype::Float32, device);
+
+    TensorExpr diff = TensorExpr(a) - b;
+    TensorExpr expr = (diff * diff + 1.f).Sqrt() / 2.f - a.Neg();
+    EXPECT_FALSE(expr.IsEvaluated());
+    EXPECT_EQ(expr.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(expr.GetDtype(), Dtype::Float32);
+    EXPECT_EQ(expr.GetDevice(), device);
+
+    Tensor expected = ((a - b) * (a - b) + 1.f).Sqrt() / 2.f - a.Neg();
+    Tensor result = expr.Eval();
+    EXPECT_TRUE(expr.IsEvaluated());
+    EXPECT_EQ(result.GetShape(), SizeVector({2, 3}));
+    ExpectNear(result.ToFlatVector<float>(), expected.ToFlatVector<float>());
+
+    // The result is cached.
+    EXPECT_EQ(expr.Eval().GetDataPtr(), result.GetDataPtr());
+
+    // Non-contiguous inputs, integer dtype and Tensor on the lhs.
+    Tensor c(std::vector<int32_t>({-1, 2, -3, 4, -5, 6}), {2, 3}, Dtype::Int32,
+             device);
+    Tensor ct = c.T();
+    EXPECT_EQ((ct * TensorExpr(ct).Abs() - 1).Eval().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-2, 15, 3, -26, -10, 35}));
+}
+
+TEST_P(TensorExprPermuteDevices, MinMaxPowFloorLog) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>({0.5, 1.5, 2.25, 3, 4.75, 5}), {2, 3},
+             Dtype::Float32, device);
+    Tensor b(std::vector<float>({1, 2, 4}), {3}, Dtype::Float32, device);
+
+    TensorExpr expr = TensorExpr(a).Maximum(b).Pow(2.f) +
+                      TensorExpr(a).Minimum(b).Floor() - TensorExpr(a).Log();
+    Tensor expected = a.Maximum(b).Pow(2.f) + a.Minimum(b).Floor() - a.Log();
+    ExpectNear(expr.Eval().ToFlatVector<float>(),
+               expected.ToFlatVector<float>());
+    ExpectNear(TensorExpr(a).Maximum(2.f).Minimum(4.f).Eval()
+                       .ToFlatVector<float>(),
+               {2, 2, 2.25, 3, 4, 4});
+
+    // Floor, Maximum, Minimum and Pow also apply to integers.
+    Tensor c(std::vector<int64_t>({-3, 2, 5}), {3}, Dtype::Int64, device);
+    EXPECT_EQ((TensorExpr(c).Floor().Maximum(0).Pow(int64_t(2)) + c)
+                      .Eval()
+                      .ToFlatVector<int64_t>(),
+              std::vector<int64_t>({-3, 6, 30}));
+    EXPECT_THROW((TensorExpr(c) + c).Log().Eval(), std::runtime_error);
+}
+
+TEST_P(TensorExprPermuteDevices, Reduction) {
+    Device device = GetParam();
+    std::vector<float> a_vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    Tensor a(a_vals, {2, 2, 3}, Dtype::Float32, device);
+    Tensor b(std::vector<float>({3, 2, 1}), {3}, Dtype::Float32, device);
+
+    TensorExpr diff = TensorExpr(a) - b;
+    TensorExpr sq = diff * diff;
+    Tensor sq_eager = (a - b) * (a - b);
+
+    // The example from the docs: row-wise Euclidean distance.
+    Tensor dist = sq.Sum({2}).Sqrt().Eval();
+    EXPECT_EQ(dist.GetShape(), SizeVector({2, 2}));
+    ExpectNear(dist.ToFlatVector<float>(),
+               sq_eager.Sum({2}).Sqrt().ToFlatVector<float>());
+
+    for (const SizeVector& dims :
+         std::vector<SizeVector>({{0}, {1}, {2}, {0, 2}, {0, 1, 2}})) {
+        for (bool keepdim : {false, true}) {
+            Tensor sum = sq.Sum(dims, keepdim).Eval();
+            EXPECT_EQ(sum.GetShape(), sq_eager.Sum(dims, keepdim).GetShape());
+            ExpectNear(sum.ToFlatVector<float>(),
+                       sq_eager.Sum(dims, keepdim).ToFlatVector<float>());
+            ExpectNear(diff.Prod(dims, keepdim).Eval().ToFlatVector<float>(),
+                       (a - b).Prod(dims, keepdim).ToFlatVector<float>());
+            ExpectNear(diff.Min(dims, keepdim).Eval().ToFlatVector<float>(),
+                       (a - b).Min(dims, keepdim).ToFlatVector<float>());
+            ExpectNear(diff.Max(dims, keepdim).Eval().ToFlatVector<float>(),
+                       (a - b).Max(dims, keepdim).ToFlatVector<float>());
+        }
+    }
+
+    // Reduction of a leaf and of an empty tensor.
+    ExpectNear(TensorExpr(a).Sum({0, 1, 2}).Eval().ToFlatVector<float>(),
+               {66});
+    Tensor empty({0, 3}, Dtype::Float32, device);
+    ExpectNear((TensorExpr(empty) * 2.f).Sum({0}).Eval().ToFlatVector<float>(),
+               {0, 0, 0});
+    EXPECT_THROW((TensorExpr(empty) * 2.f).Max({0}).Eval(),
+                 std::runtime_error);
+}
+
+TEST_P(TensorExprPermuteDevices, LargeExpression) {
+    Device device = GetParam();
+
+    // Spans multiple blocks and more distinct inputs than a single fused
+    // kernel accepts.
+    int64_t n = 100003;
+    std::vector<float> vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = static_cast<float>(i % 101) / 10.f;
+    }
+    std::vector<Tensor> inputs;
+    TensorExpr expr(Tensor(vals, {n}, Dtype::Float32, device));
+    Tensor expected(vals, {n}, Dtype::Float32, device);
+    for (int i = 0; i < 12; ++i) {
+        Tensor t = Tensor::Full({n}, static_cast<float>(i), Dtype::Float32,
+                                device);
+        expr = expr + t;
+        expected = expected + t;
+    }
+    ExpectNear(expr.Eval().ToFlatVector<float>(),
+               expected.ToFlatVector<float>());
+    ExpectNear(expr.Sum({0}).Eval().ToFlatVector<float>(),
+               expected.Sum({0}).ToFlatVector<float>());
+
+    // Reductions with many outputs, along either dimension.
+    Tensor m = Tensor(std::vector<float>(vals.begin(), vals.begin() + 67000),
+                      {1000, 67}, Dtype::Float32, device);
+    TensorExpr m_expr = TensorExpr(m) * m - m;
+    Tensor m_expected = m * m - m;
+    ExpectNear(m_expr.Sum({1}).Eval().ToFlatVector<float>(),
+               m_expected.Sum({1}).ToFlatVector<float>());
+    ExpectNear(m_expr.Max({0}).Eval().ToFlatVector<float>(),
+               m_expected.Max({0}).ToFlatVector<float>());
+}
+
+TEST_P(TensorExprPermuteDevices, LongChain) {
+    Device device = GetParam();
+
+    // Long chains are evaluated and destroyed without deep recursion, both
+    // fused and op by op (Int16 is not fused).
+    int64_t n = 100000;
+    Tensor one = Tensor::Ones({}, Dtype::Float32, device);
+    TensorExpr fused(Tensor::Zeros({4}, Dtype::Float32, device));
+    for (int64_t i = 0; i < n; ++i) {
+        fused = fused + one;
+    }
+    EXPECT_EQ(fused.Eval().ToFlatVector<float>(),
+              std::vector<float>(4, static_cast<float>(n)));
+
+    int64_t m = 30000;
+    Tensor one_int16 = Tensor::Ones({}, Dtype::Int16, device);
+    TensorExpr eager(Tensor::Zeros({4}, Dtype::Int16, device));
+    for (int64_t i = 0; i < m; ++i) {
+        eager = eager + one_int16;
+    }
+    EXPECT_EQ(eager.Eval().ToFlatVector<int16_t>(),
+              std::vector<int16_t>(4, static_cast<int16_t>(m)));
+
+    // Unevaluated chains are destroyed iteratively as well.
+    TensorExpr unevaluated(one);
+    for (int64_t i = 0; i < n; ++i) {
+        unevaluated = unevaluated - one;
+    }
+    unevaluated = TensorExpr(one);
+}
+
+TEST_P(TensorExprPermuteDevices, SharedSubexpressions) {
+    Device device = GetParam();
+
+    // Each square uses the previous one twice. Shared nodes are compiled and
+    // evaluated once, otherwise the work would double with every square.
+    int64_t n = 40;
+    TensorExpr fused(Tensor(std::vector<double>{1, -1, 0.5, 0}, {4},
+                            Dtype::Float64, device));
+    TensorExpr eager(Tensor(std::vector<int16_t>{1, -1, 0, 0}, {4},
+                            Dtype::Int16, device));
+    for (int64_t i = 0; i < n; ++i) {
+        fused = fused * fused;
+        eager = eager * eager;
+    }
+    EXPECT_EQ(fused.Eval().ToFlatVector<double>(),
+              std::vector<double>({1, 1, 0, 0}));
+    EXPECT_EQ(eager.Eval().ToFlatVector<int16_t>(),
+              std::vector<int16_t>({1, 1, 0, 0}));
+    EXPECT_EQ((fused.Sum({0}) * fused.Sum({0})).Eval().ToFlatVector<double>(),
+              std::vector<double>({4}));
+
+    // Shared operations and reductions within a fused program.
+    Tensor a(std::vector<float>{1, 2, 3, 4, 5, 6}, {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>{0.5, 0, 1, -1, 2, 3}, {2, 3}, Dtype::Float32,
+             device);
+    TensorExpr diff = TensorExpr(a) - b;
+    TensorExpr sq = diff * diff;
+    TensorExpr sum = sq.Sum({1}, true);
+    Tensor sq_eager = (a - b) * (a - b);
+    Tensor sum_eager = sq_eager.Sum({1}, true);
+    ExpectNear((sq + sq * diff).Eval().ToFlatVector<float>(),
+               (sq_eager + sq_eager * (a - b)).ToFlatVector<float>());
+    ExpectNear((sq / sum + sum).Eval().ToFlatVector<float>(),
+               (sq_eager / sum_eager + sum_eager).ToFlatVector<float>());
+}
+
+TEST_P(TensorExprPermuteDevices, Exceptions) {
+    Device device = GetParam();
+    Tensor a({2, 3}, Dtype::Float32, device);
+    Tensor b({4}, Dtype::Float32, device);
+    Tensor c({2, 3}, Dtype::Int32, device);
+
+    // Errors on shapes and dtypes are raised when recording.
+    EXPECT_THROW(TensorExpr(a) + b, std::runtime_error);
+    EXPECT_THROW(TensorExpr(a) + c, std::runtime_error);
+    EXPECT_THROW(TensorExpr(a).Sum({2}), std::runtime_error);
+
+    // Float-only ops on integers are raised when evaluating.
+    TensorExpr expr = (TensorExpr(c) + c).Sqrt();
+    EXPECT_THROW(expr.Eval(), std::runtime_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
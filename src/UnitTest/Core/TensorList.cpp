@@ -330,5 +330,114 @@ TEST_P(TensorListPermuteDevices, Clear) {
     EXPECT_EQ(tensor_list.GetReservedSize(), 1);
 }
 
+TEST_P(TensorListPermuteDevices, GrowthFactor) {
+    Device device = GetParam();
+
+    Tensor t(std::vector<float>(3, 1), {3}, Dtype::Float32, device);
+    TensorList tensor_list({3}, Dtype::Float32, device);
+    EXPECT_EQ(tensor_list.GetGrowthFactor(), 0);
+    EXPECT_THROW(tensor_list.SetGrowthFactor(1), std::runtime_error);
+
+    tensor_list.SetGrowthFactor(1.5);
+    std::vector<int64_t> reserved_sizes;
+    for (int i = 0; i < 10; ++i) {
+        tensor_list.PushBack(t);
+        reserved_sizes.push_back(tensor_list.GetReservedSize());
+    }
+    EXPECT_EQ(reserved_sizes,
+              std::vector<int64_t>({1, 2, 3, 5, 5, 8, 8, 8, 12, 12}));
+    EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(),
+              std::vector<float>(30, 1));
+
+    // Requests beyond the grown size are reserved exactly.
+    tensor_list.Resize(100);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 100);
+
+    TensorList copy(tensor_list);
+    EXPECT_EQ(copy.GetGrowthFactor(), 1.5);
+}
+
+TEST_P(TensorListPermuteDevices, Chunked) {
+    Device device = GetParam();
+
+    Tensor t0(std::vector<float>(2, 0), {2}, Dtype::Float32, device);
+    Tensor t1(std::vector<float>(2, 1), {2}, Dtype::Float32, device);
+    Tensor t2(std::vector<float>(2, 2), {2}, Dtype::Float32, device);
+
+    EXPECT_THROW(TensorList::Chunked({2}, Dtype::Float32, 0, device),
+                 std::runtime_error);
+    TensorList tensor_list =
+            TensorList::Chunked({2}, Dtype::Float32, 2, device);
+    EXPECT_TRUE(tensor_list.IsChunked());
+    EXPECT_EQ(tensor_list.GetChunkSize(), 2);
+    EXPECT_EQ(tensor_list.GetSize(), 0);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 0);
+    EXPECT_EQ(tensor_list.AsTensor().GetShape(), SizeVector({0, 2}));
+
+    // A single block is returned as a view.
+    tensor_list.PushBack(t0);
+    tensor_list.PushBack(t1);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 2);
+    EXPECT_EQ(tensor_list.AsTensor().GetDataPtr(),
+              tensor_list.GetChunks()[0].GetDataPtr());
+
+    // Existing blocks are never reallocated.
+    const void* first_chunk = tensor_list.GetChunks()[0].GetDataPtr();
+    tensor_list.PushBack(t2);
+    EXPECT_EQ(tensor_list.GetSize(), 3);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 4);
+    EXPECT_EQ(tensor_list.GetChunks().size(), 2);
+    EXPECT_EQ(tensor_list.GetChunks()[0].GetDataPtr(), first_chunk);
+    EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({0, 0, 1, 1, 2, 2}));
+    EXPECT_EQ(tensor_list[2].ToFlatVector<float>(),
+              std::vector<float>({2, 2}));
+
+    // Elements can be written through operator[].
+    tensor_list[-1] = t1;
+    EXPECT_EQ(tensor_list[2].ToFlatVector<float>(),
+              std::vector<float>({1, 1}));
+    tensor_list[2] = t2;
+
+    // Extending with itself and with a contiguous list.
+    tensor_list += tensor_list;
+    EXPECT_EQ(tensor_list.GetSize(), 6);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 6);
+    TensorList contiguous(std::vector<Tensor>({t1}), device);
+    tensor_list.Extend(contiguous);
+    EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 1, 1}));
+
+    // Extending a contiguous list with a chunked one.
+    contiguous.Extend(tensor_list);
+    EXPECT_FALSE(contiguous.IsChunked());
+    EXPECT_EQ(contiguous.GetSize(), 8);
+    EXPECT_EQ(contiguous.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({1, 1, 0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2,
+                                  1, 1}));
+
+    // Deep copies do not share blocks.
+    TensorList copy(tensor_list);
+    EXPECT_TRUE(copy.IsChunked());
+    copy[0] = t2;
+    EXPECT_EQ(tensor_list[0].ToFlatVector<float>(),
+              std::vector<float>({0, 0}));
+    EXPECT_EQ(copy.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({2, 2, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 1, 1}));
+
+    // Shrinking releases unused blocks, growing fills zeros.
+    tensor_list.Resize(3);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 4);
+    tensor_list.Resize(5);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 6);
+    EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({0, 0, 1, 1, 2, 2, 0, 0, 0, 0}));
+
+    tensor_list.Clear();
+    EXPECT_TRUE(tensor_list.IsChunked());
+    EXPECT_EQ(tensor_list.GetSize(), 0);
+    EXPECT_EQ(tensor_list.GetReservedSize(), 0);
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -143,5 +143,166 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, SearchBatch) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(10, 10, 10),
+         0);
+    geometry::KDTreeFlann kdtree(pc);
+
+    // Queries in column-major layout, one per column; half of them are
+    // points of the cloud.
+    Eigen::MatrixXd queries(3, 200);
+    for (int i = 0; i < 200; i++) {
+        queries.col(i) = i % 2 == 0 ? pc.points_[i]
+                                    : Eigen::Vector3d::Random() * 5 +
+                                              Eigen::Vector3d::Constant(5);
+    }
+
+    geometry::KDTreeSearchParamKNN param_knn(7);
+    geometry::KDTreeSearchParamRadius param_radius(1.0);
+    geometry::KDTreeSearchParamHybrid param_hybrid(1.5, 5);
+    for (const geometry::KDTreeSearchParam *param :
+         {static_cast<const geometry::KDTreeSearchParam *>(&param_knn),
+          static_cast<const geometry::KDTreeSearchParam *>(&param_radius),
+          static_cast<const geometry::KDTreeSearchParam *>(&param_hybrid)}) {
+        std::vector<int64_t> offsets;
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        int64_t total = kdtree.SearchBatch(queries, *param, offsets, indices,
+                                           distance2);
+        ASSERT_EQ(offsets.size(), 201u);
+        EXPECT_EQ(offsets[0], 0);
+        EXPECT_EQ(offsets[200], total);
+        EXPECT_EQ(int64_t(indices.size()), total);
+        EXPECT_EQ(int64_t(distance2.size()), total);
+        EXPECT_GT(total, 0);
+        for (int i = 0; i < 200; i++) {
+            std::vector<int> ref_indices;
+            std::vector<double> ref_distance2;
+            Eigen::Vector3d query = queries.col(i);
+            kdtree.Search(query, *param, ref_indices, ref_distance2);
+            ExpectEQ(std::vector<int>(indices.begin() + offsets[i],
+                                      indices.begin() + offsets[i + 1]),
+                     ref_indices);
+            ExpectEQ(std::vector<double>(distance2.begin() + offsets[i],
+                                         distance2.begin() + offsets[i + 1]),
+                     ref_distance2);
+        }
+    }
+
+    // Queries mapped from the points of the cloud, without copying.
+    std::vector<int64_t> offsets;
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    Eigen::Map<const Eigen::MatrixXd> points((const double *)pc.points_.data(),
+                                             3, pc.points_.size());
+    EXPECT_EQ(kdtree.SearchKNNBatch(points, 1, offsets, indices, distance2),
+              1000);
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(indices[i], i);
+    }
+
+    // More neighbors requested than points in the tree.
+    geometry::PointCloud small_pc;
+    small_pc.points_ = {{0, 0, 0}, {1, 0, 0}, {0, 2, 0}};
+    geometry::KDTreeFlann small_kdtree(small_pc);
+    EXPECT_EQ(small_kdtree.SearchKNNBatch(queries.leftCols(2), 10, offsets,
+                                          indices, distance2),
+              6);
+    EXPECT_EQ(offsets, std::vector<int64_t>({0, 3, 6}));
+
+    // Invalid and empty queries.
+    EXPECT_EQ(kdtree.SearchKNNBatch(Eigen::MatrixXd(2, 5), 1, offsets, indices,
+                                    distance2),
+              -1);
+    EXPECT_EQ(kdtree.SearchRadiusBatch(Eigen::MatrixXd(3, 0), 1.0, offsets,
+                                       indices, distance2),
+              0);
+    EXPECT_EQ(offsets, std::vector<int64_t>({0}));
+}
+
+TEST(KDTreeFlann, Float32) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(10, 10, 10),
+         0);
+    geometry::KDTreeFlann kdtree(pc);
+
+    // The tree keeps its own copy of the points.
+    std::unique_ptr<geometry::PointCloud> pc_copy(
+            new geometry::PointCloud(pc));
+    geometry::KDTreeFlann kdtree_float(*pc_copy, true);
+    pc_copy.reset();
+
+    Eigen::MatrixXd queries(3, 100);
+    for (int i = 0; i < 100; i++) {
+        queries.col(i) =
+                Eigen::Vector3d::Random() * 5 + Eigen::Vector3d::Constant(5);
+    }
+
+    // Single precision neighbors match the double precision ones up to float
+    // rounding of the distances.
+    for (int i = 0; i < 100; i++) {
+        Eigen::Vector3d query = queries.col(i);
+        std::vector<int> ref_indices, indices;
+        std::vector<double> ref_distance2, distance2;
+        EXPECT_EQ(kdtree.SearchKNN(query, 10, ref_indices, ref_distance2), 10);
+        EXPECT_EQ(kdtree_float.SearchKNN(query, 10, indices, distance2), 10);
+        ExpectEQ(ref_indices, indices);
+        ExpectEQ(ref_distance2, distance2, 1e-4);
+    }
+
+    // Batched and single searches on the single precision tree agree.
+    geometry::KDTreeSearchParamKNN param_knn(7);
+    geometry::KDTreeSearchParamRadius param_radius(1.0);
+    geometry::KDTreeSearchParamHybrid param_hybrid(1.5, 5);
+    for (const geometry::KDTreeSearchParam *param :
+         {static_cast<const geometry::KDTreeSearchParam *>(&param_knn),
+          static_cast<const geometry::KDTreeSearchParam *>(&param_radius),
+          static_cast<const geometry::KDTreeSearchParam *>(&param_hybrid)}) {
+        std::vector<int64_t> offsets;
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        int64_t total = kdtree_float.SearchBatch(queries, *param, offsets,
+                                                 indices, distance2);
+        ASSERT_EQ(offsets.size(), 101u);
+        EXPECT_EQ(offsets[100], total);
+        EXPECT_GT(total, 0);
+        for (int i = 0; i < 100; i++) {
+            std::vector<int> ref_indices;
+            std::vector<double> ref_distance2;
+            Eigen::Vector3d query = queries.col(i);
+            kdtree_float.Search(query, *param, ref_indices, ref_distance2);
+            ExpectEQ(std::vector<int>(indices.begin() + offsets[i],
+                                      indices.begin() + offsets[i + 1]),
+                     ref_indices);
+            ExpectEQ(std::vector<double>(distance2.begin() + offsets[i],
+                                         distance2.begin() + offsets[i + 1]),
+                     ref_distance2);
+        }
+    }
+
+    // Features of arbitrary dimension.
+    registration::Feature feature;
+    feature.Resize(33, 50);
+    for (int i = 0; i < 50; i++) {
+        feature.data_.col(i) = Eigen::VectorXd::Constant(33, double(i));
+    }
+    geometry::KDTreeFlann kdtree_feature(feature, true);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    Eigen::VectorXd query = Eigen::VectorXd::Constant(33, 20.2);
+    EXPECT_EQ(kdtree_feature.SearchKNN(query, 2, indices, distance2), 2);
+    ExpectEQ(indices, std::vector<int>({20, 21}));
+    ExpectEQ(distance2, std::vector<double>({33 * 0.04, 33 * 0.64}), 1e-4);
+
+    // Rebuilding without data leaves an empty tree.
+    EXPECT_FALSE(kdtree_float.SetMatrixData(Eigen::MatrixXd(3, 0), true));
+    EXPECT_EQ(kdtree_float.SearchKNN(queries.col(0).eval(), 1, indices,
+                                     distance2),
+              -1);
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -593,6 +593,63 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ApplyIndices(pc_down->colors_, sort_indices), colors_down);
 }
 
+TEST(PointCloud, VoxelDownSampleOrdering) {
+    // voxel_size: 1
+    // points_min_bound: (0.3, 0.3, 0.3)
+    // voxel_min_bound: (-0.2, -0.2, -0.2)
+    // voxel_{i,j,k}: 0 <= i, j, k <= 2, each containing the 8 corners of
+    // [i + 0.3, i + 0.7] x [j + 0.3, j + 0.7] x [k + 0.3, k + 0.7]
+    // Points are added with x varying slowest, the output has x fastest.
+    geometry::PointCloud pcd;
+    geometry::PointCloud pcd_sparse;
+    for (int i = 2; i >= 0; i--) {
+        for (int j = 0; j < 3; j++) {
+            for (int k = 2; k >= 0; k--) {
+                for (int c = 0; c < 8; c++) {
+                    pcd.points_.push_back(
+                            Eigen::Vector3d(i + 0.3 + 0.4 * (c & 1),
+                                            j + 0.3 + 0.4 * ((c >> 1) & 1),
+                                            k + 0.3 + 0.4 * ((c >> 2) & 1)));
+                    pcd.colors_.push_back(Eigen::Vector3d(i, j, k) / 2.0);
+                }
+                pcd_sparse.points_.push_back(
+                        Eigen::Vector3d(i + 0.5, j + 0.5, k + 0.5));
+            }
+        }
+    }
+
+    // Ground-truth reference
+    std::vector<Eigen::Vector3d> points_down;
+    std::vector<Eigen::Vector3d> colors_down;
+    for (int k = 0; k < 3; k++) {
+        for (int j = 0; j < 3; j++) {
+            for (int i = 0; i < 3; i++) {
+                points_down.push_back(
+                        Eigen::Vector3d(i + 0.5, j + 0.5, k + 0.5));
+                colors_down.push_back(Eigen::Vector3d(i, j, k) / 2.0);
+            }
+        }
+    }
+
+    // 216 points in 27 voxels.
+    std::shared_ptr<geometry::PointCloud> pc_down = pcd.VoxelDownSample(1.0);
+    ExpectEQ(pc_down->points_, points_down);
+    ExpectEQ(pc_down->colors_, colors_down);
+    EXPECT_FALSE(pc_down->HasNormals());
+
+    // One point per voxel.
+    pc_down = pcd_sparse.VoxelDownSample(1.0);
+    ExpectEQ(pc_down->points_, points_down);
+    EXPECT_FALSE(pc_down->HasColors());
+
+    // Voxel grid too large for a single 64-bit voxel key.
+    geometry::PointCloud pcd_large;
+    pcd_large.points_ = {{1e6, 0, 0}, {0, 0, 1e6}, {0, 0, 0}, {1e6, 0, 0}};
+    pc_down = pcd_large.VoxelDownSample(1e-3);
+    ExpectEQ(pc_down->points_, std::vector<Eigen::Vector3d>{
+                                       {0, 0, 0}, {1e6, 0, 0}, {0, 0, 1e6}});
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RaycastingScene.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "UnitTest/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(RaycastingScene, CastRays) {
+    // box0 covers [0, 1]^3, box1 covers [2, 3] x [0, 1] x [0, 1]
+    auto box0 = geometry::TriangleMesh::CreateBox();
+    auto box1 = geometry::TriangleMesh::CreateBox();
+    box1->Translate(Eigen::Vector3d(2, 0, 0));
+    geometry::RaycastingScene scene;
+    EXPECT_EQ(scene.AddTriangles(*box0), 0);
+    EXPECT_EQ(scene.AddTriangles(*box1), 1);
+    EXPECT_EQ(scene.GetNumGeometries(), 2);
+
+    std::vector<Eigen::Vector3d> origins{
+            {0.5, 0.3, -1}, {2.5, 0.3, -1}, {2.5, 0.3, -1}, {0.5, 0.5, 0.5},
+            {1.5, 0.5, -1}};
+    std::vector<Eigen::Vector3d> directions{
+            {0, 0, 1}, {0, 0, 1}, {0, 0, 4}, {-1, 0, 0}, {0, 0, 1}};
+    auto result = scene.CastRays(origins, directions);
+    ExpectEQ(std::vector<double>(result.t_hit_.begin(),
+                                 result.t_hit_.begin() + 4),
+             std::vector<double>{1, 1, 0.25, 0.5});
+    EXPECT_EQ(result.t_hit_[4], std::numeric_limits<double>::infinity());
+    ExpectEQ(result.geometry_ids_, std::vector<int>{0, 1, 1, 0, -1});
+    ExpectEQ(result.triangle_normals_[0], Eigen::Vector3d(0, 0, -1));
+    ExpectEQ(result.triangle_normals_[3], Eigen::Vector3d(-1, 0, 0));
+    EXPECT_EQ(result.triangle_ids_[4], geometry::RaycastingScene::INVALID_ID);
+
+    // The barycentric coordinates reproduce the hit point.
+    const geometry::TriangleMesh *boxes[] = {box0.get(), box1.get()};
+    for (size_t r = 0; r < 4; ++r) {
+        const auto &mesh = *boxes[result.geometry_ids_[r]];
+        const Eigen::Vector3i &triangle =
+                mesh.triangles_[result.triangle_ids_[r]];
+        const Eigen::Vector2d &uv = result.triangle_uvs_[r];
+        Eigen::Vector3d point =
+                (1 - uv(0) - uv(1)) * mesh.vertices_[triangle(0)] +
+                uv(0) * mesh.vertices_[triangle(1)] +
+                uv(1) * mesh.vertices_[triangle(2)];
+        ExpectEQ(point, Eigen::Vector3d(origins[r] +
+                                        result.t_hit_[r] * directions[r]));
+    }
+}
+
+TEST(RaycastingScene, CountIntersections) {
+    geometry::RaycastingScene scene;
+    scene.AddTriangles(*geometry::TriangleMesh::CreateBox());
+    std::vector<Eigen::Vector3d> origins{
+            {0.35, 0.2, -1}, {0.4, 0.3, 0.5}, {0.4, 0.3, 2}, {3, 3, 3}};
+    std::vector<Eigen::Vector3d> directions{
+            {0.1, 0.2, 1}, {0.1, 0.2, 1}, {0.1, 0.2, 1}, {1, 1, 1}};
+    ExpectEQ(scene.CountIntersections(origins, directions),
+             std::vector<int>{2, 1, 0, 0});
+}
+
+TEST(RaycastingScene, ComputeClosestPoints) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    geometry::RaycastingScene scene;
+    scene.AddTriangles(*sphere);
+
+    std::vector<Eigen::Vector3d> query_points(100);
+    Rand(query_points, Eigen::Vector3d(-2, -2, -2), Eigen::Vector3d(2, 2, 2),
+         0);
+    auto result = scene.ComputeClosestPoints(query_points);
+    std::vector<double> distances = scene.ComputeDistance(query_points);
+    std::vector<double> signed_distances =
+            scene.ComputeSignedDistance(query_points);
+    for (size_t q = 0; q < query_points.size(); ++q) {
+        // The closest point lies on its triangle and no vertex is closer.
+        const Eigen::Vector3i &triangle =
+                sphere->triangles_[result.triangle_ids_[q]];
+        const Eigen::Vector2d &uv = result.triangle_uvs_[q];
+        Eigen::Vector3d point =
+                (1 - uv(0) - uv(1)) * sphere->vertices_[triangle(0)] +
+                uv(0) * sphere->vertices_[triangle(1)] +
+                uv(1) * sphere->vertices_[triangle(2)];
+        ExpectEQ(point, result.points_[q]);
+        EXPECT_GE(uv(0), 0.0);
+        EXPECT_GE(uv(1), 0.0);
+        EXPECT_LE(uv(0) + uv(1), 1.0 + 1e-12);
+        double distance = (result.points_[q] - query_points[q]).norm();
+        for (const Eigen::Vector3d &vertex : sphere->vertices_) {
+            EXPECT_LE(distance, (vertex - query_points[q]).norm() + 1e-12);
+        }
+        EXPECT_NEAR(distances[q], distance, 1e-12);
+        EXPECT_NEAR(std::abs(signed_distances[q]), distance, 1e-12);
+        if (query_points[q].norm() < 0.9) {
+            EXPECT_LT(signed_distances[q], 0.0);
+        } else if (query_points[q].norm() > 1.0) {
+            EXPECT_GT(signed_distances[q], 0.0);
+        }
+    }
+
+    geometry::RaycastingScene box_scene;
+    box_scene.AddTriangles(*geometry::TriangleMesh::CreateBox());
+    ExpectEQ(box_scene.ComputeSignedDistance(
+                     {{0.5, 0.5, 0.5}, {0.5, 0.5, 2}, {2, 2, 2}}),
+             std::vector<double>{-0.5, 1, std::sqrt(3.0)});
+}
+
+TEST(RaycastingScene, ComputeSignedDistanceSharedEdges) {
+    geometry::RaycastingScene scene;
+    scene.AddTriangles(*geometry::TriangleMesh::CreateBox());
+    // Points inside the box whose ray along the oblique direction of the
+    // parity test passes through a diagonal edge shared by two triangles.
+    const Eigen::Vector3d direction(0.5547, 0.6078, 0.5681);
+    std::vector<Eigen::Vector3d> query_points;
+    for (double s : {0.25, 0.5, 0.75}) {
+        for (double t : {0.1, 0.2, 0.3, 0.4}) {
+            query_points.push_back(Eigen::Vector3d(s, 1, s) - t * direction);
+        }
+    }
+    std::vector<double> signed_distances =
+            scene.ComputeSignedDistance(query_points);
+    for (size_t q = 0; q < query_points.size(); ++q) {
+        const Eigen::Vector3d &p = query_points[q];
+        double distance = std::min({p.minCoeff(), 1 - p.maxCoeff()});
+        EXPECT_NEAR(signed_distances[q], -distance, 1e-12);
+    }
+}
+
+TEST(RaycastingScene, CreateDepthImage) {
+    // Plane of 2 x 2 at depth 2, seen from a camera at the origin.
+    auto box = geometry::TriangleMesh::CreateBox(2, 2, 1);
+    box->Translate(Eigen::Vector3d(-1, -1, 2));
+    geometry::RaycastingScene scene;
+    scene.AddTriangles(*box);
+
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 20, 20, 32, 24);
+    auto depth = scene.CreateDepthImage(intrinsic);
+    EXPECT_EQ(depth->width_, 64);
+    EXPECT_EQ(depth->height_, 48);
+    EXPECT_EQ(depth->num_of_channels_, 1);
+    EXPECT_EQ(depth->bytes_per_channel_, 4);
+    // The plane covers the pixels within 10 of the principal point.
+    EXPECT_FLOAT_EQ(*depth->PointerAt<float>(32, 24), 2.0f);
+    EXPECT_FLOAT_EQ(*depth->PointerAt<float>(40, 30), 2.0f);
+    EXPECT_FLOAT_EQ(*depth->PointerAt<float>(1, 1), 0.0f);
+    EXPECT_FLOAT_EQ(*depth->PointerAt<float>(60, 24), 0.0f);
+
+    // Moving the camera back by 1 moves the plane to depth 3.
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(2, 3) = 1;
+    depth = scene.CreateDepthImage(intrinsic, extrinsic);
+    EXPECT_FLOAT_EQ(*depth->PointerAt<float>(32, 24), 3.0f);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "Open3D/Geometry/TriangleBVH.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "UnitTest/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(TriangleBVH, Empty) {
+    geometry::TriangleMesh mesh;
+    geometry::TriangleBVH bvh(mesh);
+    EXPECT_TRUE(bvh.GetNodes().empty());
+    EXPECT_TRUE(bvh.GetTriangleIndices().empty());
+    EXPECT_TRUE(
+            bvh.FindTrianglePairs(bvh, [](int, int) { return true; }).empty());
+}
+
+TEST(TriangleBVH, Structure) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    const int num_triangles = int(mesh->triangles_.size());
+    for (int max_triangles_per_leaf : {1, 4}) {
+        geometry::TriangleBVH bvh(*mesh, max_triangles_per_leaf);
+        const auto &nodes = bvh.GetNodes();
+
+        std::vector<int> triangle_indices = bvh.GetTriangleIndices();
+        std::sort(triangle_indices.begin(), triangle_indices.end());
+        for (int tidx = 0; tidx < num_triangles; ++tidx) {
+            EXPECT_EQ(triangle_indices[tidx], tidx);
+        }
+
+        ASSERT_FALSE(nodes.empty());
+        EXPECT_EQ(nodes[0].begin_, 0);
+        EXPECT_EQ(nodes[0].end_, num_triangles);
+        ExpectEQ(nodes[0].min_bound_, mesh->GetMinBound());
+        ExpectEQ(nodes[0].max_bound_, mesh->GetMaxBound());
+        for (size_t n = 0; n < nodes.size(); ++n) {
+            const auto &node = nodes[n];
+            if (node.IsLeaf()) {
+                EXPECT_LE(node.end_ - node.begin_, max_triangles_per_leaf);
+                continue;
+            }
+            const auto &child0 = nodes[n + 1];
+            const auto &child1 = nodes[node.second_child_];
+            EXPECT_EQ(child0.begin_, node.begin_);
+            EXPECT_EQ(child0.end_, child1.begin_);
+            EXPECT_EQ(child1.end_, node.end_);
+            EXPECT_LT(child0.begin_, child0.end_);
+            EXPECT_LT(child1.begin_, child1.end_);
+            for (const auto *child : {&child0, &child1}) {
+                EXPECT_TRUE((child->min_bound_.array() >=
+                             node.min_bound_.array())
+                                    .all());
+                EXPECT_TRUE((child->max_bound_.array() <=
+                             node.max_bound_.array())
+                                    .all());
+            }
+        }
+    }
+}
+
+TEST(TriangleBVH, FindTrianglePairs) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    auto other = geometry::TriangleMesh::CreateBox(1.0, 1.0, 1.0);
+    auto bounds_overlap = [](const geometry::TriangleMesh &mesh0, int tidx0,
+                             const geometry::TriangleMesh &mesh1, int tidx1) {
+        Eigen::Vector3d min0 = mesh0.vertices_[mesh0.triangles_[tidx0](0)];
+        Eigen::Vector3d max0 = min0;
+        Eigen::Vector3d min1 = mesh1.vertices_[mesh1.triangles_[tidx1](0)];
+        Eigen::Vector3d max1 = min1;
+        for (int i = 1; i < 3; ++i) {
+            min0 = min0.cwiseMin(mesh0.vertices_[mesh0.triangles_[tidx0](i)]);
+            max0 = max0.cwiseMax(mesh0.vertices_[mesh0.triangles_[tidx0](i)]);
+            min1 = min1.cwiseMin(mesh1.vertices_[mesh1.triangles_[tidx1](i)]);
+            max1 = max1.cwiseMax(mesh1.vertices_[mesh1.triangles_[tidx1](i)]);
+        }
+        return (min0.array() <= max1.array()).all() &&
+               (min1.array() <= max0.array()).all();
+    };
+    auto sorted = [](std::vector<Eigen::Vector2i> pairs) {
+        std::sort(pairs.begin(), pairs.end(),
+                  [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                      return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+                  });
+        return pairs;
+    };
+    auto is_even_sum = [](int tidx0, int tidx1) {
+        return (tidx0 + tidx1) % 2 == 0;
+    };
+
+    geometry::TriangleBVH bvh(*mesh, 2);
+    geometry::TriangleBVH other_bvh(*other, 2);
+
+    // Self pairs are unordered and exclude the triangle itself.
+    std::vector<Eigen::Vector2i> self_pairs;
+    for (int tidx0 = 0; tidx0 < int(mesh->triangles_.size()); ++tidx0) {
+        for (int tidx1 = tidx0 + 1; tidx1 < int(mesh->triangles_.size());
+             ++tidx1) {
+            if (bounds_overlap(*mesh, tidx0, *mesh, tidx1) &&
+                is_even_sum(tidx0, tidx1)) {
+                self_pairs.push_back(Eigen::Vector2i(tidx0, tidx1));
+            }
+        }
+    }
+    EXPECT_FALSE(self_pairs.empty());
+    EXPECT_EQ(sorted(bvh.FindTrianglePairs(bvh, is_even_sum)), self_pairs);
+
+    std::vector<Eigen::Vector2i> other_pairs;
+    for (int tidx0 = 0; tidx0 < int(mesh->triangles_.size()); ++tidx0) {
+        for (int tidx1 = 0; tidx1 < int(other->triangles_.size()); ++tidx1) {
+            if (bounds_overlap(*mesh, tidx0, *other, tidx1) &&
+                is_even_sum(tidx0, tidx1)) {
+                other_pairs.push_back(Eigen::Vector2i(tidx0, tidx1));
+            }
+        }
+    }
+    EXPECT_FALSE(other_pairs.empty());
+    EXPECT_EQ(sorted(bvh.FindTrianglePairs(other_bvh, is_even_sum)),
+              other_pairs);
+
+    auto first = bvh.FindTrianglePairs(other_bvh, is_even_sum, true);
+    ASSERT_EQ(first.size(), 1u);
+    EXPECT_TRUE(std::find(other_pairs.begin(), other_pairs.end(), first[0]) !=
+                other_pairs.end());
+}
+
+}  // namespace unit_test
+}  // namespace open3d
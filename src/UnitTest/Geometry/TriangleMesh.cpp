@@ -1080,6 +1080,42 @@ TEST(TriangleMesh, IsSelfIntersecting) {
     EXPECT_EQ(mesh1.IsSelfIntersecting(), true);
 }
 
+TEST(TriangleMesh, GetSelfIntersectingTriangles) {
+    EXPECT_TRUE(geometry::TriangleMesh::CreateSphere()
+                        ->GetSelfIntersectingTriangles()
+                        .empty());
+
+    // two vertical triangles, each crossing one of two neighbouring triangles
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0},      {0, 1, 0},      {1, 0, 0},
+                      {1, 1, 0},      {0.3, 0.3, -1}, {0.3, 0.3, 1},
+                      {0.1, 0.5, 1},  {2, 2, 2},      {3, 2, 2},
+                      {2, 3, 2},      {0.7, 0.7, -1}, {0.7, 0.7, 1},
+                      {0.9, 0.5, 1}};
+    mesh.triangles_ = {
+            {7, 8, 9}, {4, 5, 6}, {0, 1, 2}, {1, 2, 3}, {10, 11, 12}};
+    std::vector<Eigen::Vector2i> ref = {{1, 2}, {3, 4}};
+    EXPECT_EQ(mesh.GetSelfIntersectingTriangles(), ref);
+}
+
+TEST(TriangleMesh, IsIntersecting) {
+    auto box0 = geometry::TriangleMesh::CreateBox();
+    auto box1 = geometry::TriangleMesh::CreateBox();
+    box1->Translate(Eigen::Vector3d(0.5, 0.5, 0.5));
+    EXPECT_TRUE(box0->IsIntersecting(*box1));
+    EXPECT_TRUE(box1->IsIntersecting(*box0));
+
+    box1->Translate(Eigen::Vector3d(1.0, 0.0, 0.0));
+    EXPECT_FALSE(box0->IsIntersecting(*box1));
+
+    // box inside a sphere without touching it
+    auto sphere = geometry::TriangleMesh::CreateSphere(2.0);
+    auto box2 = geometry::TriangleMesh::CreateBox();
+    EXPECT_FALSE(sphere->IsIntersecting(*box2));
+    box2->Translate(Eigen::Vector3d(1.5, 0.0, 0.0));
+    EXPECT_TRUE(sphere->IsIntersecting(*box2));
+}
+
 TEST(TriangleMesh, ClusterConnectedTriangles) {
     // Test 1
 
@@ -101,6 +101,25 @@ def test_dtype():
     assert "{}".format(dtype) == "Dtype.Int32"
 
 
+@pytest.mark.parametrize("device", list_devices())
+def test_small_dtypes(device):
+    for np_dtype, dtype in [(np.float16, o3d.Dtype.Float16),
+                            (np.int8, o3d.Dtype.Int8),
+                            (np.int16, o3d.Dtype.Int16),
+                            (np.uint16, o3d.Dtype.UInt16)]:
+        np_t = np.array([[0, 1, 2], [3, 4, 100]], dtype=np_dtype)
+        o3_t = o3d.Tensor(np_t, device=device)
+        assert o3_t.dtype == dtype
+        assert o3d.DtypeUtil.byte_size(dtype) == np_t.itemsize
+        np.testing.assert_equal(o3_t.cpu().numpy(), np_t)
+        np.testing.assert_equal((o3_t + o3_t).cpu().numpy(), np_t + np_t)
+
+    # Float16 is stored in half precision and rounded like numpy.
+    np_t = np.array([1 / 3, 65504, 1e-7], dtype=np.float32)
+    o3_t = o3d.Tensor(np_t, dtype=o3d.Dtype.Float16, device=device)
+    np.testing.assert_equal(o3_t.cpu().numpy(), np_t.astype(np.float16))
+
+
 def test_device():
     device = o3d.Device()
     assert device.get_type() == o3d.Device.DeviceType.CPU
@@ -241,6 +260,40 @@ def test_tensor_from_to_numpy():
     np.testing.assert_equal(dst_t, o3d_t.numpy())
 
 
+def test_tensor_buffer_protocol():
+    a = np.arange(12, dtype=np.float32).reshape((3, 4))
+    o3d_t = o3d.Tensor(a)  # Copy
+
+    # Buffer protocol and __array_interface__ views share memory.
+    b = np.asarray(o3d_t)
+    m = memoryview(o3d_t)
+    assert m.shape == (3, 4)
+    assert m.format == "f"
+    c = np.array(o3d_t, copy=False)
+    b[0, 0] = 100
+    np.testing.assert_equal(c[0, 0], 100)
+    np.testing.assert_equal(o3d_t.numpy()[0, 0], 100)
+    assert o3d_t.__array_interface__["typestr"] == "<f4"
+    assert o3d_t.__array_interface__["shape"] == (3, 4)
+
+    # Non-contiguous views keep their strides.
+    o3d_t_slice = o3d_t[:, 1:4:2]
+    np.testing.assert_equal(np.asarray(o3d_t_slice), b[:, 1:4:2])
+    assert np.shares_memory(np.asarray(o3d_t_slice), b)
+
+
+def test_tensor_from_numpy_scope():
+
+    def get_o3d_t():
+        np_t = np.array([[10., 11., 12.], [13., 14., 15.]])
+        return o3d.Tensor.from_numpy(np_t)  # Shared memory
+
+    # The NumPy array is kept alive by the tensor.
+    o3d_t = get_o3d_t()
+    np.testing.assert_equal(o3d_t.numpy(),
+                            np.array([[10., 11., 12.], [13., 14., 15.]]))
+
+
 def test_tensor_to_numpy_scope():
     src_t = np.array([[10., 11., 12.], [13., 14., 15.]])
 
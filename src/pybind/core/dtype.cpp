@@ -41,6 +41,10 @@ void pybind_core_dtype(py::module &m) {
             .value("Int64", Dtype::Int64)
             .value("UInt8", Dtype::UInt8)
             .value("Bool", Dtype::Bool)
+            .value("Float16", Dtype::Float16)
+            .value("Int8", Dtype::Int8)
+            .value("Int16", Dtype::Int16)
+            .value("UInt16", Dtype::UInt16)
             .export_values();
 
     py::class_<DtypeUtil> dtype_util(m, "DtypeUtil");
@@ -52,6 +52,28 @@ void bind_templated_constructor(py::class_<Tensor>& tensor) {
                "init_vals"_a, "shape"_a, "dtype"_a, "device"_a);
 }
 
+/// Describes the memory of a CPU tensor for the Python buffer protocol, with
+/// strides in bytes. No data is copied.
+static py::buffer_info TensorToBufferInfo(const Tensor& tensor) {
+    if (tensor.GetDevice().GetType() != Device::DeviceType::CPU) {
+        utility::LogError(
+                "Only CPU Tensor supports the buffer protocol. Copy Tensor to "
+                "CPU first.");
+    }
+    int64_t element_byte_size = DtypeUtil::ByteSize(tensor.GetDtype());
+    std::vector<py::ssize_t> shape(tensor.GetShapeRef().begin(),
+                                   tensor.GetShapeRef().end());
+    std::vector<py::ssize_t> strides(tensor.GetStridesRef().begin(),
+                                     tensor.GetStridesRef().end());
+    for (auto& s : strides) {
+        s *= element_byte_size;
+    }
+    return py::buffer_info(
+            const_cast<void*>(tensor.GetDataPtr()), element_byte_size,
+            pybind_utils::DtypeToArrayFormat(tensor.GetDtype()),
+            tensor.NumDims(), shape, strides);
+}
+
 template <typename T>
 static std::vector<T> ToFlatVector(
         py::array_t<T, py::array::c_style | py::array::forcecast> np_array) {
@@ -62,7 +84,7 @@ static std::vector<T> ToFlatVector(
 
 void pybind_core_tensor(py::module& m) {
     py::class_<Tensor, std::shared_ptr<Tensor>> tensor(
-            m, "Tensor",
+            m, "Tensor", py::buffer_protocol(),
             "A Tensor is a view of a data Blob with shape, stride, data_ptr.");
 
     // Constructor from numpy array
@@ -175,21 +197,52 @@ void pybind_core_tensor(py::module& m) {
                          base_tensor_capsule);
     });
 
+    // Zero-copy views of CPU tensors for the Python buffer protocol (e.g.
+    // memoryview, np.asarray) and for NumPy's __array_interface__. Python
+    // keeps a reference to the Tensor while the views are in use.
+    tensor.def_buffer(
+            [](Tensor& tensor) { return TensorToBufferInfo(tensor); });
+    tensor.def_property_readonly(
+            "__array_interface__", [](const Tensor& tensor) {
+                py::buffer_info info = TensorToBufferInfo(tensor);
+                py::dict interface;
+                interface["version"] = 3;
+                interface["shape"] = py::tuple(py::cast(info.shape));
+                interface["strides"] = py::tuple(py::cast(info.strides));
+                interface["typestr"] = py::dtype(info.format).attr("str");
+                interface["data"] = py::make_tuple(
+                        reinterpret_cast<uintptr_t>(info.ptr), false);
+                return interface;
+            });
+
     tensor.def_static("from_numpy", [](py::array np_array) {
         py::buffer_info info = np_array.request();
 
         SizeVector shape(info.shape.begin(), info.shape.end());
         SizeVector strides(info.strides.begin(), info.strides.end());
         for (size_t i = 0; i < strides.size(); ++i) {
+            if (strides[i] % info.itemsize != 0) {
+                utility::LogError(
+                        "NumPy array strides must be multiples of the item "
+                        "size.");
+            }
             strides[i] /= info.itemsize;
         }
         Dtype dtype = pybind_utils::ArrayFormatToDtype(info.format);
         Device device("CPU:0");
 
-        // Blob expects an std::function<void(void*)> deleter, a
-        // dummy deleter is used here, since the memory is
-        // managed by numpy.
-        std::function<void(void*)> deleter = [](void*) -> void {};
+        // The Blob holds a reference to the NumPy array, which keeps the
+        // buffer alive for as long as any Tensor uses it, even after the
+        // array goes out of scope in Python. The last Tensor may be
+        // destroyed from C++, so the GIL is acquired to release the
+        // reference.
+        py::handle np_array_handle = np_array.inc_ref();
+        std::function<void(void*)> deleter = [np_array_handle](void*) {
+            if (Py_IsInitialized()) {
+                py::gil_scoped_acquire acquire;
+                np_array_handle.dec_ref();
+            }
+        };
         auto blob = std::make_shared<Blob>(device, info.ptr, deleter);
 
         return Tensor(shape, strides, info.ptr, dtype, blob);
@@ -330,24 +383,83 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("div_", &Tensor::Div_<uint8_t>);
     tensor.def("div_", &Tensor::Div_<bool>);
 
+    tensor.def("maximum", [](const Tensor& self, const Tensor& other) {
+        return self.Maximum(other);
+    });
+    tensor.def("maximum_", &Tensor::Maximum_);
+    tensor.def("minimum", [](const Tensor& self, const Tensor& other) {
+        return self.Minimum(other);
+    });
+    tensor.def("minimum_", &Tensor::Minimum_);
+    tensor.def("pow", [](const Tensor& self, const Tensor& other) {
+        return self.Pow(other);
+    });
+    tensor.def("pow", &Tensor::Pow<float>);
+    tensor.def("pow", &Tensor::Pow<double>);
+    tensor.def("pow", &Tensor::Pow<int64_t>);
+    tensor.def("pow_", [](Tensor& self, const Tensor& other) {
+        return self.Pow_(other);
+    });
+    tensor.def("pow_", &Tensor::Pow_<float>);
+    tensor.def("pow_", &Tensor::Pow_<double>);
+    tensor.def("pow_", &Tensor::Pow_<int64_t>);
+
+    // Ternary element-wise ops
+    tensor.def("clamp", [](const Tensor& self, const Tensor& min_val,
+                           const Tensor& max_val) {
+        return self.Clamp(min_val, max_val);
+    });
+    tensor.def("clamp", &Tensor::Clamp<float>);
+    tensor.def("clamp", &Tensor::Clamp<double>);
+    tensor.def("clamp", &Tensor::Clamp<int64_t>);
+    tensor.def("clamp_", [](Tensor& self, const Tensor& min_val,
+                            const Tensor& max_val) {
+        return self.Clamp_(min_val, max_val);
+    });
+    tensor.def("clamp_", &Tensor::Clamp_<float>);
+    tensor.def("clamp_", &Tensor::Clamp_<double>);
+    tensor.def("clamp_", &Tensor::Clamp_<int64_t>);
+    tensor.def_static("where", [](const Tensor& condition, const Tensor& x,
+                                  const Tensor& y) {
+        return Tensor::Where(condition, x, y);
+    });
+
     // Binary boolean element-wise ops
-    tensor.def("logical_and", &Tensor::LogicalAnd);
+    tensor.def("logical_and", [](const Tensor& self, const Tensor& other) {
+        return self.LogicalAnd(other);
+    });
     tensor.def("logical_and_", &Tensor::LogicalAnd_);
-    tensor.def("logical_or", &Tensor::LogicalOr);
+    tensor.def("logical_or", [](const Tensor& self, const Tensor& other) {
+        return self.LogicalOr(other);
+    });
     tensor.def("logical_or_", &Tensor::LogicalOr_);
-    tensor.def("logical_xor", &Tensor::LogicalXor);
+    tensor.def("logical_xor", [](const Tensor& self, const Tensor& other) {
+        return self.LogicalXor(other);
+    });
     tensor.def("logical_xor_", &Tensor::LogicalXor_);
-    tensor.def("gt", &Tensor::Gt);
+    tensor.def("gt", [](const Tensor& self, const Tensor& other) {
+        return self.Gt(other);
+    });
     tensor.def("gt_", &Tensor::Gt_);
-    tensor.def("lt", &Tensor::Lt);
+    tensor.def("lt", [](const Tensor& self, const Tensor& other) {
+        return self.Lt(other);
+    });
     tensor.def("lt_", &Tensor::Lt_);
-    tensor.def("ge", &Tensor::Ge);
+    tensor.def("ge", [](const Tensor& self, const Tensor& other) {
+        return self.Ge(other);
+    });
     tensor.def("ge_", &Tensor::Ge_);
-    tensor.def("le", &Tensor::Le);
+    tensor.def("le", [](const Tensor& self, const Tensor& other) {
+        return self.Le(other);
+    });
     tensor.def("le_", &Tensor::Le_);
-    tensor.def("eq", &Tensor::Eq);
+    tensor.def("eq", [](const Tensor& self, const Tensor& other) {
+        return self.Eq(other);
+    });
     tensor.def("eq_", &Tensor::Eq_);
-    tensor.def("ne", &Tensor::Ne);
+    tensor.def("ne", [](const Tensor& self, const Tensor& other) {
+        return self.Ne(other);
+    });
     tensor.def("ne_", &Tensor::Ne_);
 
     // Getters and setters as peoperty
@@ -363,19 +475,24 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("num_elements", &Tensor::NumElements);
 
     // Unary element-wise ops
-    tensor.def("sqrt", &Tensor::Sqrt);
+    tensor.def("sqrt", [](const Tensor& self) { return self.Sqrt(); });
     tensor.def("sqrt_", &Tensor::Sqrt_);
-    tensor.def("sin", &Tensor::Sin);
+    tensor.def("sin", [](const Tensor& self) { return self.Sin(); });
     tensor.def("sin_", &Tensor::Sin_);
-    tensor.def("cos", &Tensor::Cos);
+    tensor.def("cos", [](const Tensor& self) { return self.Cos(); });
     tensor.def("cos_", &Tensor::Cos_);
-    tensor.def("neg", &Tensor::Neg);
+    tensor.def("neg", [](const Tensor& self) { return self.Neg(); });
     tensor.def("neg_", &Tensor::Neg_);
-    tensor.def("exp", &Tensor::Exp);
+    tensor.def("exp", [](const Tensor& self) { return self.Exp(); });
     tensor.def("exp_", &Tensor::Exp_);
-    tensor.def("abs", &Tensor::Abs);
+    tensor.def("abs", [](const Tensor& self) { return self.Abs(); });
     tensor.def("abs_", &Tensor::Abs_);
-    tensor.def("logical_not", &Tensor::LogicalNot);
+    tensor.def("floor", [](const Tensor& self) { return self.Floor(); });
+    tensor.def("floor_", &Tensor::Floor_);
+    tensor.def("log", [](const Tensor& self) { return self.Log(); });
+    tensor.def("log_", &Tensor::Log_);
+    tensor.def("logical_not",
+               [](const Tensor& self) { return self.LogicalNot(); });
     tensor.def("logical_not_", &Tensor::LogicalNot_);
 
     // Boolean find
@@ -221,6 +221,7 @@ void pybind_geometry(py::module &m) {
     pybind_octree_methods(m_submodule);
     pybind_octree(m_submodule);
     pybind_boundingvolume(m_submodule);
+    pybind_raycastingscene(m_submodule);
 }
 
 }  // namespace open3d
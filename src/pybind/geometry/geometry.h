@@ -50,5 +50,6 @@ void pybind_image_methods(py::module &m);
 void pybind_octree_methods(py::module &m);
 void pybind_octree(py::module &m);
 void pybind_boundingvolume(py::module &m);
+void pybind_raycastingscene(py::module &m);
 
 }  // namespace open3d
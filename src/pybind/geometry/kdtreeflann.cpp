@@ -119,21 +119,29 @@ void pybind_kdtreeflann(py::module &m) {
                      "At maximum, ``max_nn`` neighbors will be searched."},
                     {"knn", "``knn`` neighbors will be searched."},
                     {"feature", "Feature data."},
-                    {"data", "Matrix data."}};
+                    {"data", "Matrix data."},
+                    {"use_float32",
+                     "Builds a single precision tree, which uses half the "
+                     "memory."}};
     py::class_<geometry::KDTreeFlann, std::shared_ptr<geometry::KDTreeFlann>>
             kdtreeflann(m, "KDTreeFlann",
                         "KDTree with FLANN for nearest neighbor search.");
     kdtreeflann.def(py::init<>())
-            .def(py::init<const Eigen::MatrixXd &>(), "data"_a)
+            .def(py::init<const Eigen::MatrixXd &, bool>(), "data"_a,
+                 "use_float32"_a = false)
             .def("set_matrix_data", &geometry::KDTreeFlann::SetMatrixData,
-                 "Sets the data for the KDTree from a matrix.", "data"_a)
-            .def(py::init<const geometry::Geometry &>(), "geometry"_a)
+                 "Sets the data for the KDTree from a matrix.", "data"_a,
+                 "use_float32"_a = false)
+            .def(py::init<const geometry::Geometry &, bool>(), "geometry"_a,
+                 "use_float32"_a = false)
             .def("set_geometry", &geometry::KDTreeFlann::SetGeometry,
-                 "Sets the data for the KDTree from geometry.", "geometry"_a)
-            .def(py::init<const registration::Feature &>(), "feature"_a)
+                 "Sets the data for the KDTree from geometry.", "geometry"_a,
+                 "use_float32"_a = false)
+            .def(py::init<const registration::Feature &, bool>(), "feature"_a,
+                 "use_float32"_a = false)
             .def("set_feature", &geometry::KDTreeFlann::SetFeature,
                  "Sets the data for the KDTree from the feature data.",
-                 "feature"_a)
+                 "feature"_a, "use_float32"_a = false)
             // Although these C++ style functions are fast by orders of
             // magnitudes when similar queries are performed for a large number
             // of times and memory management is involved, we prefer not to
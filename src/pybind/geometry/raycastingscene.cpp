@@ -0,0 +1,176 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/RaycastingScene.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+
+#include "pybind/docstring.h"
+#include "pybind/geometry/geometry.h"
+
+namespace open3d {
+
+void pybind_raycastingscene(py::module &m) {
+    py::class_<geometry::RaycastingScene::RaycastResult> raycast_result(
+            m, "RaycastResult",
+            "Result of RaycastingScene.cast_rays, one entry per ray.");
+    raycast_result
+            .def_readonly("t_hit",
+                          &geometry::RaycastingScene::RaycastResult::t_hit_,
+                          "Distance to the first hit in multiples of the ray "
+                          "direction, inf if the ray misses.")
+            .def_readonly(
+                    "geometry_ids",
+                    &geometry::RaycastingScene::RaycastResult::geometry_ids_,
+                    "Id of the hit geometry, -1 if the ray misses.")
+            .def_readonly(
+                    "triangle_ids",
+                    &geometry::RaycastingScene::RaycastResult::triangle_ids_,
+                    "Index of the hit triangle in its geometry.")
+            .def_readonly(
+                    "triangle_uvs",
+                    &geometry::RaycastingScene::RaycastResult::triangle_uvs_,
+                    "Barycentric coordinates of the hit point.")
+            .def_readonly("triangle_normals",
+                          &geometry::RaycastingScene::RaycastResult::
+                                  triangle_normals_,
+                          "Unit normal of the hit triangle.");
+
+    py::class_<geometry::RaycastingScene::ClosestPointResult>
+            closest_point_result(m, "ClosestPointResult",
+                                 "Result of "
+                                 "RaycastingScene.compute_closest_points, one "
+                                 "entry per query point.");
+    closest_point_result
+            .def_readonly(
+                    "points",
+                    &geometry::RaycastingScene::ClosestPointResult::points_,
+                    "Closest point on the surface of the scene.")
+            .def_readonly("geometry_ids",
+                          &geometry::RaycastingScene::ClosestPointResult::
+                                  geometry_ids_,
+                          "Id of the geometry of the closest point.")
+            .def_readonly("triangle_ids",
+                          &geometry::RaycastingScene::ClosestPointResult::
+                                  triangle_ids_,
+                          "Index of the triangle of the closest point in its "
+                          "geometry.")
+            .def_readonly("triangle_uvs",
+                          &geometry::RaycastingScene::ClosestPointResult::
+                                  triangle_uvs_,
+                          "Barycentric coordinates of the closest point.")
+            .def_readonly("triangle_normals",
+                          &geometry::RaycastingScene::ClosestPointResult::
+                                  triangle_normals_,
+                          "Unit normal of the triangle of the closest point.");
+
+    py::class_<geometry::RaycastingScene,
+               std::shared_ptr<geometry::RaycastingScene>>
+            raycasting_scene(m, "RaycastingScene",
+                             "Scene of triangle meshes for ray casting and "
+                             "closest point queries on the CPU.");
+    raycasting_scene.def(py::init<>())
+            .def("__repr__",
+                 [](const geometry::RaycastingScene &scene) {
+                     return std::string("RaycastingScene with ") +
+                            std::to_string(scene.GetNumGeometries()) +
+                            " geometries.";
+                 })
+            .def("add_triangles", &geometry::RaycastingScene::AddTriangles,
+                 "Adds the triangles of a mesh to the scene and returns the "
+                 "id of the new geometry.",
+                 "mesh"_a)
+            .def("cast_rays", &geometry::RaycastingScene::CastRays,
+                 "Casts rays and returns the first hit of each ray.",
+                 "origins"_a, "directions"_a)
+            .def("count_intersections",
+                 &geometry::RaycastingScene::CountIntersections,
+                 "Counts the triangles hit by each ray.", "origins"_a,
+                 "directions"_a)
+            .def("compute_closest_points",
+                 &geometry::RaycastingScene::ComputeClosestPoints,
+                 "Computes the closest point on the surface of the scene for "
+                 "each query point.",
+                 "query_points"_a)
+            .def("compute_distance",
+                 &geometry::RaycastingScene::ComputeDistance,
+                 "Computes the distance from each query point to the surface "
+                 "of the scene.",
+                 "query_points"_a)
+            .def("compute_signed_distance",
+                 &geometry::RaycastingScene::ComputeSignedDistance,
+                 "Computes the signed distance from each query point to the "
+                 "surface of the scene, negative inside.",
+                 "query_points"_a)
+            .def("create_depth_image",
+                 &geometry::RaycastingScene::CreateDepthImage,
+                 "Renders a float depth image of the scene as seen by a "
+                 "pinhole camera. Pixels without a hit have depth 0.",
+                 "intrinsic"_a, "extrinsic"_a = Eigen::Matrix4d::Identity())
+            .def_static(
+                    "create_rays_pinhole",
+                    [](const camera::PinholeCameraIntrinsic &intrinsic,
+                       const Eigen::Matrix4d &extrinsic) {
+                        std::vector<Eigen::Vector3d> origins;
+                        std::vector<Eigen::Vector3d> directions;
+                        geometry::RaycastingScene::CreateRaysPinhole(
+                                intrinsic, extrinsic, origins, directions);
+                        return std::make_tuple(origins, directions);
+                    },
+                    "Creates one ray per pixel of a pinhole camera and "
+                    "returns the tuple (origins, directions).",
+                    "intrinsic"_a, "extrinsic"_a = Eigen::Matrix4d::Identity())
+            .def_readonly_static("INVALID_ID",
+                                 &geometry::RaycastingScene::INVALID_ID);
+    docstring::ClassMethodDocInject(m, "RaycastingScene", "add_triangles",
+                                    {{"mesh", "The triangle mesh to add."}});
+    docstring::ClassMethodDocInject(
+            m, "RaycastingScene", "cast_rays",
+            {{"origins", "Ray origins."},
+             {"directions", "Ray directions, need not be normalized."}});
+    docstring::ClassMethodDocInject(
+            m, "RaycastingScene", "count_intersections",
+            {{"origins", "Ray origins."},
+             {"directions", "Ray directions, need not be normalized."}});
+    docstring::ClassMethodDocInject(m, "RaycastingScene",
+                                    "compute_closest_points",
+                                    {{"query_points", "A list of points."}});
+    docstring::ClassMethodDocInject(m, "RaycastingScene", "compute_distance",
+                                    {{"query_points", "A list of points."}});
+    docstring::ClassMethodDocInject(m, "RaycastingScene",
+                                    "compute_signed_distance",
+                                    {{"query_points", "A list of points."}});
+    docstring::ClassMethodDocInject(
+            m, "RaycastingScene", "create_depth_image",
+            {{"intrinsic", "Camera intrinsic parameters."},
+             {"extrinsic", "World to camera transformation."}});
+    docstring::ClassMethodDocInject(
+            m, "RaycastingScene", "create_rays_pinhole",
+            {{"intrinsic", "Camera intrinsic parameters."},
+             {"extrinsic", "World to camera transformation."}});
+}
+
+}  // namespace open3d
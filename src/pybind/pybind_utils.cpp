@@ -49,6 +49,15 @@ Dtype ArrayFormatToDtype(const std::string& format) {
         return Dtype::UInt8;
     } else if (format == py::format_descriptor<bool>::format()) {
         return Dtype::Bool;
+    } else if (format == "e") {
+        // pybind11 has no format_descriptor for half, "e" is numpy's float16.
+        return Dtype::Float16;
+    } else if (format == py::format_descriptor<int8_t>::format()) {
+        return Dtype::Int8;
+    } else if (format == py::format_descriptor<int16_t>::format()) {
+        return Dtype::Int16;
+    } else if (format == py::format_descriptor<uint16_t>::format()) {
+        return Dtype::UInt16;
     } else {
         utility::LogError("Unsupported data type.");
     }
@@ -67,6 +76,14 @@ std::string DtypeToArrayFormat(const Dtype& dtype) {
         return py::format_descriptor<uint8_t>::format();
     } else if (dtype == Dtype::Bool) {
         return py::format_descriptor<bool>::format();
+    } else if (dtype == Dtype::Float16) {
+        return "e";
+    } else if (dtype == Dtype::Int8) {
+        return py::format_descriptor<int8_t>::format();
+    } else if (dtype == Dtype::Int16) {
+        return py::format_descriptor<int16_t>::format();
+    } else if (dtype == Dtype::UInt16) {
+        return py::format_descriptor<uint16_t>::format();
     } else {
         utility::LogError("Unsupported data type.");
     }
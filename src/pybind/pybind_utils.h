@@ -43,3 +43,23 @@ std::string DtypeToArrayFormat(const Dtype& dtype);
 }  // namespace pybind_utils
 
 }  // namespace open3d
+
+namespace pybind11 {
+namespace detail {
+
+/// Maps open3d::Half to numpy's float16, so that py::array_t<open3d::Half>
+/// can be used like the other Tensor element types.
+template <>
+struct npy_format_descriptor<open3d::Half> {
+    static constexpr auto name = _("float16");
+    static pybind11::dtype dtype() {
+        // NPY_HALF in numpy's C API.
+        constexpr int kNpyHalf = 23;
+        handle ptr = npy_api::get().PyArray_DescrFromType_(kNpyHalf);
+        return reinterpret_borrow<pybind11::dtype>(ptr);
+    }
+    static std::string format() { return "e"; }
+};
+
+}  // namespace detail
+}  // namespace pybind11